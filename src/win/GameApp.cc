@@ -7,6 +7,13 @@
 #include "tests/BunnyTest.h"
 #include "tests/ClearScreenTest.h"
 #include "tests/DepthTest.h"
+#include "tests/MeshLoadTest.h"
+#include "tests/MeshletTest.h"
+#include "tests/VertexThroughputTest.h"
+#include "tests/InstancedBunnyTest.h"
+#include "tests/OcclusionTest.h"
+#include "tests/DepthPrepassTest.h"
+#include "tests/PostProcessTest.h"
 #include "tests/ParticleTest.h"
 #include "tests/StencilTest.h"
 #include "tests/StressTest.h"
@@ -118,6 +125,13 @@ bool GameApp::initialize() {
             BlendTest::create,
             ParticleTest::create,
             BunnyTest::create,
+            MeshLoadTest::create,
+            MeshletTest::create,
+            VertexThroughputTest::create,
+            InstancedBunnyTest::create,
+            OcclusionTest::create,
+            DepthPrepassTest::create,
+            PostProcessTest::create,
         };
         _test = _tests[_nextIndex](_windowInfo);
         if (_test == nullptr)
@@ -1,7 +1,49 @@
 #include "BasicTextureTest.h"
+#include "PixelConvert.h"
+#include "RenderPassAnalyzer.h"
+
+// 1 times the RGB to RGBA expansion at a range of image sizes before the textures load
+#define RGB2RGBA_BENCHMARK 0
 
 namespace cc {
 
+namespace {
+void benchmarkRGB2RGBA() {
+    // 2048x2048 peaks at about 60MB, the 4096 step would hold 240MB and take low end Android devices down
+    for (uint size : {64u, 256u, 1024u, 2048u}) {
+        uint pixels = size * size;
+        // enough repeats for the small sizes to show above the timer
+        uint repeats = std::max(4u, (1u << 24u) / pixels);
+        vector<uint8_t> src(pixels * 3u);
+        for (uint i = 0u; i < src.size(); ++i) src[i] = static_cast<uint8_t>((i * 2654435761u) >> 24u);
+        vector<uint8_t> reference(pixels * 4u);
+        vector<uint8_t> staging(pixels * 4u);
+
+        // what RGB2RGBA used to do: a fresh allocation filled a byte at a time
+        auto start = std::chrono::steady_clock::now();
+        for (uint i = 0u; i < repeats; ++i) {
+            uint8_t *data = new uint8_t[pixels * 4u];
+            expandRGB8ToRGBA8Scalar(src.data(), data, pixels);
+            delete[] data;
+        }
+        float allocating = TestBaseI::millisecondsSince(start) / repeats;
+
+        start = std::chrono::steady_clock::now();
+        for (uint i = 0u; i < repeats; ++i) expandRGB8ToRGBA8Scalar(src.data(), reference.data(), pixels);
+        float scalar = TestBaseI::millisecondsSince(start) / repeats;
+
+        start = std::chrono::steady_clock::now();
+        for (uint i = 0u; i < repeats; ++i) expandRGB8ToRGBA8(src.data(), staging.data(), pixels);
+        float kernel = TestBaseI::millisecondsSince(start) / repeats;
+
+        CCASSERT(staging == reference, "RGB2RGBA kernel disagrees with the scalar loop");
+        CC_LOG_INFO("RGB2RGBA %ux%u: %.3fms allocating byte loop, %.3fms byte loop into staging, %.3fms %s (%.1fx), %.0f Mpixels/s",
+                    size, size, allocating, scalar, kernel, getRGB8ToRGBA8Kernel(), allocating / std::max(kernel, 1e-6f),
+                    pixels / std::max(kernel, 1e-6f) / 1000.0f);
+    }
+}
+} // namespace
+
 void BasicTexture::destroy() {
     CC_SAFE_DESTROY(_shader);
     CC_SAFE_DESTROY(_vertexBuffer);
@@ -18,6 +60,9 @@ void BasicTexture::destroy() {
 }
 
 bool BasicTexture::initialize() {
+#if RGB2RGBA_BENCHMARK
+    benchmarkRGB2RGBA();
+#endif
     createShader();
     createVertexBuffer();
     createInputAssembler();
@@ -204,7 +249,8 @@ void BasicTexture::createTexture() {
     bool valid = img->initWithImageFile("uv_checker_01.jpg");
     CCASSERT(valid, "BasicTexture load image failed");
 
-    auto data = TestBaseI::RGB2RGBA(img);
+    unsigned char *data = TestBaseI::getUploadStaging(img->getWidth() * img->getHeight() * 4u);
+    TestBaseI::RGB2RGBA(img, data);
 
     gfx::TextureInfo textureInfo;
     textureInfo.usage = gfx::TextureUsage::SAMPLED | gfx::TextureUsage::TRANSFER_DST;
@@ -230,7 +276,9 @@ void BasicTexture::createTexture() {
     bool valid2 = img2->initWithImageFile("uv_checker_02.jpg");
     CCASSERT(valid2, "BasicTexture load image failed");
 
-    auto data2 = TestBaseI::RGB2RGBA(img2);
+    // the first upload is done with the staging memory, the second image reuses it
+    unsigned char *data2 = TestBaseI::getUploadStaging(img2->getWidth() * img2->getHeight() * 4u);
+    TestBaseI::RGB2RGBA(img2, data2);
 
     gfx::TextureInfo textureInfo2;
     textureInfo2.usage = gfx::TextureUsage::SAMPLED | gfx::TextureUsage::TRANSFER_DST;
@@ -254,8 +302,6 @@ void BasicTexture::createTexture() {
     //create sampler
     gfx::SamplerInfo samplerInfo;
     _sampler = _device->createSampler(samplerInfo);
-
-    delete[] data;
 }
 
 void BasicTexture::tick() {
@@ -274,6 +320,7 @@ void BasicTexture::tick() {
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("BasicTextureTest", _fbo, renderArea);
     commandBuffer->bindInputAssembler(_inputAssembler);
     commandBuffer->bindPipelineState(_pipelineState);
     commandBuffer->bindDescriptorSet(0, _descriptorSet);
@@ -1,4 +1,5 @@
 #include "BasicTriangleTest.h"
+#include "RenderPassAnalyzer.h"
 
 namespace cc {
 
@@ -237,6 +238,7 @@ void BasicTriangle::tick() {
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("BasicTriangleTest", _fbo, renderArea);
     commandBuffer->bindInputAssembler(_inputAssembler);
     commandBuffer->bindPipelineState(_pipelineState);
     commandBuffer->bindDescriptorSet(0, _descriptorSet);
@@ -1,4 +1,12 @@
 #include "BlendTest.h"
+#include "RenderPassAnalyzer.h"
+
+// 1 renders at a resolution that follows the frame time and upscales to the screen
+#define USE_DYNAMIC_RESOLUTION 1
+// 1 steps the scene through MSAA on the shared swapchain passes, a stats window each, and logs what each
+// costs; only the sample counts the backend guarantees are measured, 1x/2x/4x on GLES3 and 1x/4x on Vulkan
+// and Metal, never 8x. Those passes go straight to the screen, so dynamic resolution is off meanwhile
+#define MSAA_BENCHMARK 0
 
 namespace cc {
 
@@ -18,7 +26,12 @@ gfx::Texture *createTexture(gfx::Device *device, const gfx::TextureInfo &texture
     img->autorelease();
     bool valid = img->initWithImageFile(imageFile);
     CCASSERT(valid, "load image failed");
-    auto imgData = img->getRenderFormat() == gfx::Format::RGB8 ? TestBaseI::RGB2RGBA(img) : img->getData();
+    const unsigned char *imgData = img->getData();
+    if (img->getRenderFormat() == gfx::Format::RGB8) {
+        unsigned char *rgba = TestBaseI::getUploadStaging(img->getWidth() * img->getHeight() * 4u);
+        TestBaseI::RGB2RGBA(img, rgba);
+        imgData = rgba;
+    }
 
     auto texture = device->createTexture(textureInfo);
 
@@ -32,12 +45,11 @@ gfx::Texture *createTexture(gfx::Device *device, const gfx::TextureInfo &texture
 
     gfx::BufferDataList imageBuffers = {imgData};
     device->copyBuffersToTexture(imageBuffers, texture, regions);
-    delete[] imgData;
     return texture;
 }
 
 struct Quad : public cc::Object {
-    Quad(gfx::Device *_device, gfx::Framebuffer *_fbo) : device(_device), fbo(_fbo) {
+    Quad(gfx::Device *_device, gfx::RenderPass *_renderPass) : device(_device), renderPass(_renderPass) {
         createShader();
         createVertexBuffer();
         createInputAssembler();
@@ -260,7 +272,7 @@ struct Quad : public cc::Object {
         pipelineInfo[NO_BLEND].primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo[NO_BLEND].shader = shader;
         pipelineInfo[NO_BLEND].inputState = {inputAssembler->getAttributes()};
-        pipelineInfo[NO_BLEND].renderPass = fbo->getRenderPass();
+        pipelineInfo[NO_BLEND].renderPass = renderPass;
         pipelineInfo[NO_BLEND].rasterizerState.cullMode = gfx::CullMode::NONE;
         pipelineInfo[NO_BLEND].depthStencilState.depthWrite = false;
         pipelineInfo[NO_BLEND].blendState.targets[0].blend = true;
@@ -276,7 +288,7 @@ struct Quad : public cc::Object {
         pipelineInfo[NORMAL_BLEND].primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo[NORMAL_BLEND].shader = shader;
         pipelineInfo[NORMAL_BLEND].inputState = {inputAssembler->getAttributes()};
-        pipelineInfo[NORMAL_BLEND].renderPass = fbo->getRenderPass();
+        pipelineInfo[NORMAL_BLEND].renderPass = renderPass;
         pipelineInfo[NORMAL_BLEND].rasterizerState.cullMode = gfx::CullMode::NONE;
         pipelineInfo[NORMAL_BLEND].depthStencilState.depthWrite = false;
 
@@ -300,7 +312,7 @@ struct Quad : public cc::Object {
         pipelineInfo[ADDITIVE_BLEND].primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo[ADDITIVE_BLEND].shader = shader;
         pipelineInfo[ADDITIVE_BLEND].inputState = {inputAssembler->getAttributes()};
-        pipelineInfo[ADDITIVE_BLEND].renderPass = fbo->getRenderPass();
+        pipelineInfo[ADDITIVE_BLEND].renderPass = renderPass;
         pipelineInfo[ADDITIVE_BLEND].rasterizerState.cullMode = gfx::CullMode::NONE;
         pipelineInfo[ADDITIVE_BLEND].depthStencilState.depthWrite = false;
         pipelineInfo[ADDITIVE_BLEND].pipelineLayout = pipelineLayout;
@@ -316,7 +328,7 @@ struct Quad : public cc::Object {
         pipelineInfo[SUBSTRACT_BLEND].primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo[SUBSTRACT_BLEND].shader = shader;
         pipelineInfo[SUBSTRACT_BLEND].inputState = {inputAssembler->getAttributes()};
-        pipelineInfo[SUBSTRACT_BLEND].renderPass = fbo->getRenderPass();
+        pipelineInfo[SUBSTRACT_BLEND].renderPass = renderPass;
         pipelineInfo[SUBSTRACT_BLEND].rasterizerState.cullMode = gfx::CullMode::NONE;
         pipelineInfo[SUBSTRACT_BLEND].depthStencilState.depthWrite = false;
         pipelineInfo[SUBSTRACT_BLEND].pipelineLayout = pipelineLayout;
@@ -332,7 +344,7 @@ struct Quad : public cc::Object {
         pipelineInfo[MULTIPLY_BLEND].primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo[MULTIPLY_BLEND].shader = shader;
         pipelineInfo[MULTIPLY_BLEND].inputState = {inputAssembler->getAttributes()};
-        pipelineInfo[MULTIPLY_BLEND].renderPass = fbo->getRenderPass();
+        pipelineInfo[MULTIPLY_BLEND].renderPass = renderPass;
         pipelineInfo[MULTIPLY_BLEND].rasterizerState.cullMode = gfx::CullMode::NONE;
         pipelineInfo[MULTIPLY_BLEND].depthStencilState.depthWrite = false;
         pipelineInfo[MULTIPLY_BLEND].pipelineLayout = pipelineLayout;
@@ -340,7 +352,7 @@ struct Quad : public cc::Object {
     }
 
     gfx::Device *device = nullptr;
-    gfx::Framebuffer *fbo = nullptr;
+    gfx::RenderPass *renderPass = nullptr;
     gfx::Shader *shader = nullptr;
     gfx::Buffer *vertexBuffer = nullptr;
     gfx::Buffer *indexBuffer = nullptr;
@@ -360,7 +372,8 @@ struct Quad : public cc::Object {
 };
 
 struct BigTriangle : public cc::Object {
-    BigTriangle(gfx::Device *_device, gfx::Framebuffer *_fbo) : device(_device), fbo(_fbo) {
+    BigTriangle(gfx::Device *_device, gfx::RenderPass *_renderPass, bool _offscreen)
+    : device(_device), renderPass(_renderPass), offscreen(_offscreen) {
         createShader();
         createVertexBuffer();
         createInputAssembler();
@@ -487,7 +500,8 @@ struct BigTriangle : public cc::Object {
     }
 
     void createVertexBuffer() {
-        float ySign = device->getScreenSpaceSignY();
+        // flipped like the quads' offscreen projection when drawn into a target the upscale pass samples
+        float ySign = device->getScreenSpaceSignY() * (offscreen ? device->getUVSpaceSignY() : 1.0f);
         float vertexData[] = {-1.0f, 4.0f * ySign, 0.0, -1.5,
                               -1.0f, -1.0f * ySign, 0.0, 1.0,
                               4.0f, -1.0f * ySign, 2.5, 1.0};
@@ -554,14 +568,14 @@ struct BigTriangle : public cc::Object {
         pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo.shader = shader;
         pipelineInfo.inputState = {inputAssembler->getAttributes()};
-        pipelineInfo.renderPass = fbo->getRenderPass();
+        pipelineInfo.renderPass = renderPass;
         pipelineInfo.pipelineLayout = pipelineLayout;
 
         pipelineState = device->createPipelineState(pipelineInfo);
     }
 
     gfx::Device *device = nullptr;
-    gfx::Framebuffer *fbo = nullptr;
+    gfx::RenderPass *renderPass = nullptr;
     gfx::Shader *shader = nullptr;
     gfx::Buffer *vertexBuffer = nullptr;
     gfx::Buffer *timeBuffer = nullptr;
@@ -572,6 +586,7 @@ struct BigTriangle : public cc::Object {
     gfx::DescriptorSetLayout *descriptorSetLayout = nullptr;
     gfx::PipelineLayout *pipelineLayout = nullptr;
     gfx::PipelineState *pipelineState = nullptr;
+    bool offscreen = false;
 };
 
 void createModelTransform(Mat4 &model, const Vec3 &t, const Vec3 &s) {
@@ -584,25 +599,125 @@ Quad *quad = nullptr;
 gfx::Rect renderArea;
 gfx::SurfaceTransform orientation = gfx::SurfaceTransform::IDENTITY;
 gfx::Color clearColor{0, 0, 0, 1};
+
+void createScene(gfx::Device *device, gfx::RenderPass *renderPass, bool offscreen) {
+    CC_SAFE_DESTROY(bigTriangle);
+    CC_SAFE_DESTROY(quad);
+    bigTriangle = CC_NEW(BigTriangle(device, renderPass, offscreen));
+    quad = CC_NEW(Quad(device, renderPass));
+    // the new quad's matrices are uploaded on the next tick
+    renderArea.width = renderArea.height = 0u;
+}
+
+void drawScene(gfx::CommandBuffer *commandBuffer) {
+    // draw background
+    commandBuffer->bindInputAssembler(bigTriangle->inputAssembler);
+    commandBuffer->bindPipelineState(bigTriangle->pipelineState);
+    commandBuffer->bindDescriptorSet(0, bigTriangle->descriptorSet);
+    commandBuffer->draw(bigTriangle->inputAssembler);
+    TestBaseI::getRenderPassAnalyzer()->draw(true);
+
+    commandBuffer->bindInputAssembler(quad->inputAssembler);
+
+    // draw sprite without blending
+    commandBuffer->bindPipelineState(quad->pipelineState[NO_BLEND]);
+    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[NO_BLEND]);
+    commandBuffer->draw(quad->inputAssembler);
+
+    // normal
+    commandBuffer->bindPipelineState(quad->pipelineState[NORMAL_BLEND]);
+    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[NORMAL_BLEND]);
+    commandBuffer->draw(quad->inputAssembler);
+
+    // additive
+    commandBuffer->bindPipelineState(quad->pipelineState[ADDITIVE_BLEND]);
+    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[ADDITIVE_BLEND]);
+    commandBuffer->draw(quad->inputAssembler);
+
+    // substract
+    commandBuffer->bindPipelineState(quad->pipelineState[SUBSTRACT_BLEND]);
+    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[SUBSTRACT_BLEND]);
+    commandBuffer->draw(quad->inputAssembler);
+
+    // multiply
+    commandBuffer->bindPipelineState(quad->pipelineState[MULTIPLY_BLEND]);
+    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[MULTIPLY_BLEND]);
+    commandBuffer->draw(quad->inputAssembler);
+}
 } // namespace
 
 void BlendTest::destroy() {
     CC_SAFE_DESTROY(bigTriangle);
     CC_SAFE_DESTROY(quad);
+    CC_SAFE_DELETE(_dynamicResolution);
+    CC_SAFE_DELETE(_frameGraph);
     renderArea.width = renderArea.height = 1u;
     orientation = gfx::SurfaceTransform::IDENTITY;
 }
 
 bool BlendTest::initialize() {
-    bigTriangle = CC_NEW(BigTriangle(_device, _fbo));
-    quad = CC_NEW(Quad(_device, _fbo));
+#if MSAA_BENCHMARK
+    createScene(_device, TestBaseI::getRenderPass(MSAA_SAMPLE_COUNTS[_msaaVariant]), false);
+#else
+    _frameGraph = CC_NEW(FrameGraph(_device));
+    FrameGraph::Handle scenePass = _frameGraph->addPass("scene", drawScene);
+#if USE_DYNAMIC_RESOLUTION
+    // the full screen background is all fill, the scene is drawn small and stretched when frames run late
+    FrameGraph::Handle sceneColor = _frameGraph->createTexture("scene color", _device->getColorFormat());
+    FrameGraph::Handle sceneDepth = _frameGraph->createTexture("scene depth", _device->getDepthStencilFormat());
+    // the background covers the screen, so the color is never cleared
+    _frameGraph->writeColor(scenePass, sceneColor);
+    _frameGraph->writeDepthStencil(scenePass, sceneDepth, true);
+
+    _dynamicResolution = CC_NEW(DynamicResolution(_device, _frameGraph, "BlendTest"));
+    _dynamicResolution->addTarget(sceneColor);
+    _dynamicResolution->addTarget(sceneDepth);
+    _dynamicResolution->addUpscalePass(sceneColor);
+#else
+    _frameGraph->writeColor(scenePass, FrameGraph::BACKBUFFER);
+#endif
+    _frameGraph->compile();
+#if USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->initialize();
+#endif
+
+    createScene(_device, _frameGraph->getRenderPass(scenePass), USE_DYNAMIC_RESOLUTION);
+#endif
     return true;
 }
 
+void BlendTest::resize(uint width, uint height) {
+    TestBaseI::resize(width, height);
+#if !MSAA_BENCHMARK
+    _frameGraph->resize(width, height);
+#if USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->updateBindings();
+#endif
+#endif
+}
+
 void BlendTest::tick() {
     lookupTime();
 
     _dt += hostThread.dt;
+#if MSAA_BENCHMARK
+    // the first frame of a variant pays for its attachments and pipelines, leave it out
+    if (_statsMsaaFrames++) _statsMsaaTime += hostThread.dt;
+    if (_statsMsaaFrames == 61u) {
+        uint attachmentBytes = 0u;
+        uint resolveBytes = 0u;
+        TestBaseI::getMultisampleCost(MSAA_SAMPLE_COUNTS[_msaaVariant], attachmentBytes, resolveBytes);
+        CC_LOG_INFO("BlendTest MSAA %ux: %.3fms per frame, %.1fMB of multisampled attachments, %.1fMB resolve traffic per frame",
+                    static_cast<uint>(MSAA_SAMPLE_COUNTS[_msaaVariant]), _statsMsaaTime * 1000.f / 60u,
+                    attachmentBytes / 1048576.0f, resolveBytes / 1048576.0f);
+        _msaaVariant = TestBaseI::getNextMultisampleVariant(_msaaVariant);
+        _statsMsaaFrames = 0u;
+        _statsMsaaTime = 0.0f;
+        createScene(_device, TestBaseI::getRenderPass(MSAA_SAMPLE_COUNTS[_msaaVariant]), false);
+    }
+#elif USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->update(hostThread.dt);
+#endif
 
     _device->acquire();
 
@@ -612,7 +727,7 @@ void BlendTest::tick() {
     if (matricesDirty) {
         Mat4 model;
         Mat4 projection;
-        TestBaseI::createOrthographic(0.f, (float)orientedSize.width, (float)orientedSize.height, 0.f, -1.0f, 1.f, &projection);
+        TestBaseI::createOrthographic(0.f, (float)orientedSize.width, (float)orientedSize.height, 0.f, -1.0f, 1.f, &projection, USE_DYNAMIC_RESOLUTION && !MSAA_BENCHMARK);
 
         float size = std::min(orientedSize.width, orientedSize.height) * 0.15f;
         float halfSize = size * 0.5f;
@@ -639,42 +754,17 @@ void BlendTest::tick() {
     if (matricesDirty)
         commandBuffer->updateBuffer(quad->uniformBuffer, quad->models.data(), quad->models.size() * sizeof(float));
 
-    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
-
-    // draw background
-    commandBuffer->bindInputAssembler(bigTriangle->inputAssembler);
-    commandBuffer->bindPipelineState(bigTriangle->pipelineState);
-    commandBuffer->bindDescriptorSet(0, bigTriangle->descriptorSet);
-    commandBuffer->draw(bigTriangle->inputAssembler);
-
-    commandBuffer->bindInputAssembler(quad->inputAssembler);
-
-    // draw sprite without blending
-    commandBuffer->bindPipelineState(quad->pipelineState[NO_BLEND]);
-    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[NO_BLEND]);
-    commandBuffer->draw(quad->inputAssembler);
-
-    // normal
-    commandBuffer->bindPipelineState(quad->pipelineState[NORMAL_BLEND]);
-    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[NORMAL_BLEND]);
-    commandBuffer->draw(quad->inputAssembler);
-
-    // additive
-    commandBuffer->bindPipelineState(quad->pipelineState[ADDITIVE_BLEND]);
-    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[ADDITIVE_BLEND]);
-    commandBuffer->draw(quad->inputAssembler);
-
-    // substract
-    commandBuffer->bindPipelineState(quad->pipelineState[SUBSTRACT_BLEND]);
-    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[SUBSTRACT_BLEND]);
-    commandBuffer->draw(quad->inputAssembler);
-
-    // multiply
-    commandBuffer->bindPipelineState(quad->pipelineState[MULTIPLY_BLEND]);
-    commandBuffer->bindDescriptorSet(0, quad->descriptorSet, 1, &quad->dynamicOffsets[MULTIPLY_BLEND]);
-    commandBuffer->draw(quad->inputAssembler);
-
+#if MSAA_BENCHMARK
+    gfx::Framebuffer *framebuffer = TestBaseI::getFramebuffer(MSAA_SAMPLE_COUNTS[_msaaVariant]);
+    gfx::Color clearColors[] = {clearColor, clearColor};
+    commandBuffer->beginRenderPass(framebuffer->getRenderPass(), framebuffer, renderArea, clearColors, 1.0f, 0);
+    getRenderPassAnalyzer()->record("scene", framebuffer, renderArea);
+    drawScene(commandBuffer);
     commandBuffer->endRenderPass();
+#else
+    _frameGraph->execute(commandBuffer);
+#endif
+
     commandBuffer->end();
 
     _device->getQueue()->submit(_commandBuffers);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TestBase.h"
+#include "DynamicResolution.h"
 
 namespace cc {
 
@@ -15,10 +16,16 @@ public:
      virtual void tick() override;
      virtual bool initialize() override;
      virtual void destroy() override;
+     virtual void resize(uint width, uint height) override;
 
 private:
-   
+    FrameGraph *_frameGraph = nullptr;
+    DynamicResolution *_dynamicResolution = nullptr;
+
     float _dt = 0.0f;
+    uint _msaaVariant = 0u;
+    uint _statsMsaaFrames = 0u;
+    float _statsMsaaTime = 0.0f;
 };
 
 } // namespace cc
@@ -1,30 +0,0 @@
-/****************************************************************************
- Copyright (c) 2018 Xiamen Yaji Software Co., Ltd.
-
- http://www.cocos2d-x.org
-
- Permission is hereby granted, free of charge, to any person obtaining a copy
- of this software and associated documentation files (the "Software"), to deal
- in the Software without restriction, including without limitation the rights
- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- copies of the Software, and to permit persons to whom the Software is
- furnished to do so, subject to the following conditions:
-
- The above copyright notice and this permission notice shall be included in
- all copies or substantial portions of the Software.
-
- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
- THE SOFTWARE.
- ****************************************************************************/
-
-#pragma once
-
-static const float bunny_positions[][3] = {{1.301895f,0.122622f,2.550061f},{1.045326f,0.139058f,2.835156f},{0.569251f,0.155925f,2.805125f},{0.251886f,0.144145f,2.82928f},{0.063033f,0.131726f,3.01408f},{-0.277753f,0.135892f,3.10716f},{-0.441048f,0.277064f,2.594331f},{-1.010956f,0.095285f,2.668983f},{-1.317639f,0.069897f,2.325448f},{-0.751691f,0.264681f,2.381496f},{0.684137f,0.31134f,2.364574f},{1.347931f,0.302882f,2.201434f},{-1.736903f,0.029894f,1.724111f},{-1.319986f,0.11998f,0.912925f},{1.538077f,0.157372f,0.481711f},{1.951975f,0.081742f,1.1641f},{1.834768f,0.095832f,1.602682f},{2.446122f,0.091817f,1.37558f},{2.617615f,0.078644f,0.742801f},{-1.609748f,0.04973,-0.238721f},{-1.281973f,0.230984,-0.180916f},{-1.074501f,0.248204f,0.034007f},{-1.201734f,0.058499f,0.402234f},{-1.444454f,0.054783f,0.149579f},{-4.694605f,5.075882f,1.043427f},{-3.95963f,7.767394f,0.758447f},{-4.753339f,5.339817f,0.665061f},{-1.150325f,9.133327,-0.368552f},{-4.316107f,2.893611f,0.44399f},{-0.809202f,9.312575,-0.466061f},{0.085626f,5.963693f,1.685666f},{-1.314853f,9.00142,-0.1339f},{-4.364182f,3.072556f,1.436712f},{-2.022074f,7.323396f,0.678657f},{1.990887f,6.13023f,0.479643f},{-3.295525f,7.878917f,1.409353f},{0.571308f,6.197569f,0.670657f},{0.89661f,6.20018f,0.337056f},{0.331851f,6.162372f,1.186371f},{-4.840066f,5.599874f,2.296069f},{2.138989f,6.031291f,0.228335f},{0.678923f,6.026173f,1.894052f},{-0.781682f,5.601573f,1.836738f},{1.181315f,6.239007f,0.393293f},{-3.606308f,7.376476f,2.661452f},{-0.579059f,4.042511,-1.540883f},{-3.064069f,8.630253,-2.597539f},{-2.157271f,6.837012f,0.300191f},{-2.966013f,7.821581,-1.13697f},{-2.34426f,8.122965f,0.409043f},{-0.951684f,5.874251f,1.415119f},{-2.834853f,7.748319f,0.182406f},{-3.242493f,7.820096f,0.373674f},{-0.208532f,5.992846f,1.252084f},{-3.048085f,8.431527,-2.129795f},{1.413245f,5.806324f,2.243906f},{-0.051222f,6.064901f,0.696093f},{-4.204306f,2.700062f,0.713875f},{-4.610997f,6.343405f,0.344272f},{-3.291336f,9.30531,-3.340445f},{-3.27211f,7.559239,-2.324016f},{-4.23882f,6.498344f,3.18452f},{-3.945317f,6.377804f,3.38625f},{-4.906378f,5.472265f,1.315193f},{-3.580131f,7.846717f,0.709666f},{-1.995504f,6.645459f,0.688487f},{-2.595651f,7.86054f,0.793351f},{-0.008849f,0.305871f,0.184484f},{-0.029011f,0.314116,-0.257312f},{-2.522424f,7.565392f,1.804212f},{-1.022993f,8.650826,-0.855609f},{-3.831265f,6.595426f,3.266783f},{-4.042525f,6.855724f,3.060663f},{-4.17126f,7.404742f,2.391387f},{3.904526f,3.767693f,0.092179f},{0.268076f,6.086802f,1.469223f},{-3.320456f,8.753222,-2.08969f},{1.203048f,6.26925f,0.612407f},{-4.406479f,2.985974f,0.853691f},{-3.226889f,6.615215,-0.404243f},{0.346326f,1.60211f,3.509858f},{-3.955476f,7.253323f,2.722392f},{-1.23204f,0.068935f,1.68794f},{0.625436f,6.196455f,1.333156f},{4.469132f,2.165298f,1.70525f},{0.950053f,6.262899f,0.922441f},{-2.980404f,5.25474,-0.663155f},{-4.859043f,6.28741f,1.537081f},{-3.077453f,4.641475,-0.892167f},{-0.44002f,8.222503,-0.771454f},{-4.034112f,7.639786f,0.389935f},{-3.696045f,6.242042f,3.394679f},{-1.221806f,7.783617f,0.196451f},{0.71461f,6.149895f,1.656636f},{-4.713539f,6.163154f,0.495369f},{-1.509869f,0.913044,-0.832413f},{-1.547249f,2.066753,-0.852669f},{-3.757734f,5.793742f,3.455794f},{-0.831911f,0.199296f,1.718536f},{-3.062763f,7.52718,-1.550559f},{0.938688f,6.103354f,1.820958f},{-4.037033f,2.412311f,0.988026f},{-4.130746f,2.571806f,1.101689f},{-0.693664f,9.174283,-0.952323f},{-1.286742f,1.079679,-0.751219f},{1.543185f,1.408925f,3.483132f},{1.535973f,2.047979f,3.655029f},{0.93844f,5.84101f,2.195219f},{-0.684401f,5.918492f,1.20109f},{1.28844f,2.008676f,3.710781f},{-3.586722f,7.435506,-1.454737f},{-0.129975f,4.384192f,2.930593f},{-1.030531f,0.281374f,3.214273f},{-3.058751f,8.137238,-3.227714f},{3.649524f,4.592226f,1.340021f},{-3.354828f,7.322425,-1.412086f},{0.936449f,6.209237f,1.512693f},{-1.001832f,3.590411,-1.545892f},{-3.770486f,4.593242f,2.477056f},{-0.971925f,0.067797f,0.921384f},{-4.639832f,6.865407f,2.311791f},{-0.441014f,8.093595,-0.595999f},{-2.004852f,6.37142f,1.635383f},{4.759591f,1.92818f,0.328328f},{3.748064f,1.224074f,2.140484f},{-0.703601f,5.285476f,2.251988f},{0.59532f,6.21893f,0.981004f},{0.980799f,6.257026f,1.24223f},{1.574697f,6.204981f,0.381628f},{1.149594f,6.173608f,1.660763f},{-3.501963f,5.895989f,3.456576f},{1.071122f,5.424198f,2.588717f},{-0.774693f,8.473335,-0.276957f},{3.849959f,4.15542f,0.396742f},{-0.801715f,4.973149,-1.068582f},{-2.927676f,0.625112f,2.326393f},{2.669682f,4.045542f,2.971184f},{-4.391324f,4.74086f,0.343463f},{1.520129f,6.270031f,0.775471f},{1.837586f,6.084731f,0.109188f},{1.271475f,5.975024f,2.032355f},{-3.487968f,4.513249f,2.605871f},{-1.32234f,1.517264,-0.691879f},{-1.080301f,1.648226,-0.805526f},{-3.365703f,6.910166,-0.454902f},{1.36034f,0.432238f,3.075004f},{-3.305013f,5.774685f,3.39142f},{3.88432f,0.654141f,0.12574f},{3.57254f,0.377934f,0.302501f},{4.196136f,0.807999f,0.212229f},{3.932997f,0.543123f,0.380579f},{4.023704f,3.286125f,0.537597f},{1.864455f,4.916544f,2.691677f},{-4.775427f,6.499498f,1.440153f},{-3.464928f,3.68234f,2.766356f},{3.648972f,1.751262f,2.157485f},{1.179111f,3.238846f,3.774796f},{-0.171164f,0.299126,-0.592669f},{-4.502912f,3.316656f,0.875188f},{-0.948454f,9.214025,-0.679508f},{1.237665f,6.288593f,1.046f},{1.523423f,6.268963f,1.139544f},{1.436519f,6.140608f,1.739316f},{3.723607f,1.504355f,2.136762f},{2.009495f,4.045514f,3.22053f},{-1.921944f,7.249905f,0.213973f},{1.254068f,1.205518f,3.474709f},{-0.317087f,5.996269f,0.525872f},{-2.996914f,3.934607f,2.900178f},{-3.316873f,4.028154f,2.785696f},{-3.400267f,4.280157f,2.689268f},{-3.134842f,4.564875f,2.697192f},{1.480563f,4.692567f,2.834068f},{0.873682f,1.315452f,3.541585f},{1.599355f,0.91622f,3.246769f},{-3.292102f,7.125914f,2.768515f},{3.74296f,4.511299f,0.616539f},{4.698935f,1.55336f,0.26921f},{-3.274387f,3.299421f,2.823946f},{-2.88809f,3.410699f,2.955248f},{1.171407f,1.76905f,3.688472f},{1.430276f,3.92483f,3.473666f},{3.916941f,2.553308f,0.018941f},{0.701632f,2.442372f,3.778639f},{1.562657f,2.302778f,3.660957f},{4.476622f,1.152407f,0.182131f},{-0.61136f,5.761367f,1.598838f},{-3.102154f,3.691687f,2.903738f},{1.816012f,5.546167f,2.380308f},{3.853928f,4.25066f,0.750017f},{1.234681f,3.581665f,3.673723f},{1.862271f,1.361863f,3.355209f},{1.346844f,4.146995f,3.327877f},{1.70672f,4.080043f,3.274307f},{0.897242f,1.908983f,3.6969f},{-0.587022f,9.191132,-0.565301f},{-0.217426f,5.674606f,2.019968f},{0.278925f,6.120777f,0.485403f},{1.463328f,3.578742,-2.001464f},{-3.072985f,4.264581f,2.789502f},{3.62353f,4.673843f,0.383452f},{-3.053491f,8.752377,-2.908434f},{-2.628687f,4.505072f,2.755601f},{0.891047f,5.113781f,2.748272f},{-2.923732f,3.06515f,2.866368f},{0.848008f,4.754252f,2.896972f},{-3.319184f,8.811641,-2.327412f},{0.12864f,8.814781,-1.334456f},{1.549501f,4.549331,-1.28243f},{1.647161f,3.738973f,3.507719f},{1.250888f,0.945599f,3.348739f},{3.809662f,4.038822f,0.053142f},{1.483166f,0.673327f,3.09156f},{0.829726f,3.635921f,3.713103f},{1.352914f,5.226651f,2.668113f},{2.237352f,4.37414f,3.016386f},{4.507929f,0.889447f,0.744249f},{4.57304f,1.010981f,0.496588f},{3.931422f,1.720989f,2.088175f},{-0.463177f,5.989835f,0.834346f},{-2.811236f,3.745023f,2.969587f},{-2.805135f,4.219721f,2.841108f},{-2.836842f,4.802543f,2.60826f},{1.776716f,2.084611f,3.568638f},{4.046881f,1.463478f,2.106273f},{0.316265f,5.944313f,1.892785f},{-2.86347f,2.776049f,2.77242f},{-2.673644f,3.116508f,2.907104f},{-2.621149f,4.018502f,2.903409f},{-2.573447f,5.198013f,2.477481f},{1.104039f,2.278985f,3.722469f},{-4.602743f,4.306413f,0.902296f},{-2.684878f,1.510731f,0.535039f},{0.092036f,8.473269,-0.99413f},{-1.280472f,5.602393f,1.928105f},{-1.0279f,4.121582,-1.403103f},{-2.461081f,3.304477f,2.957317f},{-2.375929f,3.659383f,2.953233f},{1.417579f,2.715389f,3.718767f},{0.819727f,2.948823f,3.810639f},{1.329962f,0.761779f,3.203724f},{1.73952f,5.295229f,2.537725f},{0.952523f,3.945016f,3.548229f},{-2.569498f,0.633669f,2.84818f},{-2.276676f,0.757013f,2.780717f},{-2.013147f,7.354429,-0.003202f},{0.93143f,1.565913f,3.600325f},{1.249014f,1.550556f,3.585842f},{2.287252f,4.072353f,3.124544f},{-4.7349f,7.006244f,1.690653f},{-3.500602f,8.80386,-2.009196f},{-0.582629f,5.549138f,2.000923f},{-1.865297f,6.356066f,1.313593f},{-3.212154f,2.376143,-0.565593f},{2.092889f,3.493536,-1.727931f},{-2.528501f,2.784531f,2.833758f},{-2.565697f,4.893154f,2.559605f},{-2.153366f,5.04584f,2.465215f},{1.631311f,2.568241f,3.681445f},{2.150193f,4.699227f,2.807505f},{0.507599f,5.01813f,2.775892f},{4.129862f,1.863698f,2.015101f},{3.578279f,4.50766,-0.009598f},{3.491023f,4.806749f,1.549265f},{0.619485f,1.625336f,3.605125f},{1.107499f,2.932557f,3.790061f},{-2.082292f,6.99321f,0.742601f},{4.839909f,1.379279f,0.945274f},{3.591328f,4.322645,-0.259497f},{1.055245f,0.710686f,3.16553f},{-3.026494f,7.842227f,1.624553f},{0.146569f,6.119214f,0.981673f},{-2.043687f,2.614509f,2.785526f},{-2.302242f,3.047775f,2.936355f},{-2.245686f,4.100424f,2.87794f},{2.116148f,5.063507f,2.572204f},{-1.448406f,7.64559f,0.251692f},{2.550717f,4.9268f,2.517526f},{-2.955456f,7.80293,-1.782407f},{1.882995f,4.637167f,2.895436f},{-2.014924f,3.398262f,2.954896f},{-2.273654f,4.771227f,2.611418f},{-2.162723f,7.876761f,0.702473f},{-0.198659f,5.823062f,1.739272f},{-1.280908f,2.133189,-0.921241f},{2.039932f,4.251568f,3.136579f},{1.477815f,4.354333f,3.108325f},{0.560504f,3.744128f,3.6913f},{-2.234018f,1.054373f,2.352782f},{-3.189156f,7.686661,-2.514955f},{-3.744736f,7.69963f,2.116973f},{-2.283366f,2.878365f,2.87882f},{-2.153786f,4.457481f,2.743529f},{4.933978f,1.677287f,0.713773f},{3.502146f,0.535336f,1.752511f},{1.825169f,4.419253f,3.081198f},{3.072331f,0.280979f,0.106534f},{-0.508381f,1.220392f,2.878049f},{-3.138824f,8.445394,-1.659711f},{-2.056425f,2.954815f,2.897241f},{-2.035343f,5.398477f,2.215842f},{-3.239915f,7.126798,-0.712547f},{-1.867923f,7.989805f,0.526518f},{1.23405f,6.248973f,1.387189f},{-0.216492f,8.320933,-0.862495f},{-2.079659f,3.755709f,2.928563f},{-1.78595f,4.300374f,2.805295f},{-1.856589f,5.10678f,2.386572f},{-1.714362f,5.544778f,2.004623f},{1.722403f,4.200291,-1.408161f},{0.195386f,0.086928,-1.318006f},{1.393693f,3.013404f,3.710686f},{-0.415307f,8.508471,-0.996883f},{-1.853777f,0.755635f,2.757275f},{-1.724057f,3.64533f,2.884251f},{-1.884511f,4.927802f,2.530885f},{-1.017174f,7.783908,-0.227078f},{-1.7798f,2.342513f,2.741749f},{-1.841329f,3.943996f,2.88436f},{1.430388f,5.468067f,2.503467f},{-2.030296f,0.940028f,2.611088f},{-1.677028f,1.215666f,2.607771f},{-1.74092f,2.832564f,2.827295f},{4.144673f,0.631374f,0.503358f},{4.238811f,0.653992f,0.762436f},{-1.847016f,2.082815f,2.642674f},{4.045764f,3.194073f,0.852117f},{-1.563989f,8.112739f,0.303102f},{-1.781627f,1.794836f,2.602338f},{-1.493749f,2.533799f,2.797251f},{-1.934496f,4.690689f,2.658999f},{-1.499174f,5.777946f,1.747498f},{-2.387409f,0.851291f,1.500524f},{-1.872211f,8.269987f,0.392533f},{-4.647726f,6.765771f,0.833653f},{-3.157482f,0.341958,-0.20671f},{-1.725766f,3.24703f,2.883579f},{-1.458199f,4.079031f,2.836325f},{-1.621548f,4.515869f,2.719266f},{-1.607292f,4.918914f,2.505881f},{-1.494661f,5.556239f,1.991599f},{-1.727269f,7.423769f,0.012337f},{-1.382497f,1.161322f,2.640222f},{-1.52129f,4.681714f,2.615467f},{-4.247127f,2.792812f,1.250843f},{-1.576338f,0.742947f,2.769799f},{-1.499257f,2.172763f,2.743142f},{-1.480392f,3.103261f,2.862262f},{1.049137f,2.625836f,3.775384f},{-1.368063f,1.791587f,2.695516f},{-1.307839f,2.344534f,2.767575f},{-1.336758f,5.092221f,2.355225f},{-1.5617f,5.301749f,2.21625f},{-1.483362f,8.537704f,0.196752f},{-1.517348f,8.773614f,0.074053f},{-1.474302f,1.492731f,2.641433f},{2.48718f,0.644247,-0.920226f},{0.818091f,0.422682f,3.171218f},{-3.623398f,6.930094f,3.033045f},{1.676333f,3.531039f,3.591591f},{1.199939f,5.683873f,2.365623f},{-1.223851f,8.841201f,0.025414f},{-1.286307f,3.847643f,2.918044f},{-1.25857f,4.810831f,2.543605f},{2.603662f,5.572146f,1.991854f},{0.138984f,5.779724f,2.077834f},{-1.267039f,3.175169f,2.890889f},{-1.293616f,3.454612f,2.911774f},{-2.60112f,1.277184f,0.07724f},{2.552779f,3.649877f,3.163643f},{-1.038983f,1.248011f,2.605933f},{-1.288709f,4.390967f,2.761214f},{-1.034218f,5.485963f,2.011467f},{-1.185576f,1.464842f,2.624335f},{-1.045682f,2.54896f,2.761102f},{4.259176f,1.660627f,2.018096f},{-0.961707f,1.717183f,2.598342f},{-1.044603f,3.147464f,2.855335f},{-0.891998f,4.685429f,2.669696f},{-1.027561f,5.081672f,2.377939f},{4.386506f,0.832434f,0.510074f},{-1.014225f,9.064991,-0.175352f},{-1.218752f,2.895443f,2.823785f},{-0.972075f,4.432669f,2.788005f},{-2.714986f,0.52425f,1.509798f},{-0.699248f,1.517219f,2.645738f},{-1.161581f,2.078852f,2.722795f},{-0.845249f,3.286247f,2.996471f},{1.068329f,4.443444f,2.993863f},{3.98132f,3.715557f,1.027775f},{1.658097f,3.982428,-1.651688f},{-4.053701f,2.449888f,0.734746f},{-0.910935f,2.214149f,2.702393f},{0.087824f,3.96165f,3.439344f},{-0.779714f,3.724134f,2.993429f},{-1.051093f,3.810797f,2.941957f},{-0.644941f,4.3859f,2.870863f},{-2.98403f,8.666895,-3.691888f},{-0.754304f,2.508325f,2.812999f},{-4.635524f,3.662891f,0.913005f},{-0.983299f,4.125978f,2.915378f},{4.916497f,1.905209f,0.621315f},{4.874983f,1.728429f,0.468521f},{2.33127f,5.181957f,2.441697f},{-0.653711f,2.253387f,2.7949f},{-3.623744f,8.978795,-2.46192f},{-4.555927f,6.160279f,0.215755f},{-4.940628f,5.806712f,1.18383f},{3.308506f,2.40326,-0.910776f},{0.58835f,5.251928,-0.992886f},{2.152215f,5.449733f,2.331679f},{-0.712755f,0.766765f,3.280375f},{-0.741771f,1.9716f,2.657235f},{-4.828957f,5.566946f,2.635623f},{-3.474788f,8.696771,-1.776121f},{1.770417f,6.205561f,1.331627f},{-0.620626f,4.064721f,2.968972f},{-1.499187f,2.307735,-0.978901f},{4.098793f,2.330245f,1.667951f},{1.940444f,6.167057f,0.935904f},{-2.314436f,1.104995f,1.681277f},{-2.733629f,7.742793f,1.7705f},{-0.452248f,4.719868f,2.740834f},{-0.649143f,4.951713f,2.541296f},{-0.479417f,9.43959,-0.676324f},{-2.251853f,6.559275f,0.046819f},{0.033531f,8.316907,-0.789939f},{-0.513125f,0.995673f,3.125462f},{-2.637602f,1.039747f,0.602434f},{1.527513f,6.230089f,1.430903f},{4.036124f,2.609846f,1.506498f},{-3.559828f,7.877892f,1.228076f},{-4.570736f,4.960193f,0.838201f},{-0.432121f,5.157731f,2.467518f},{-1.206735f,4.562511,-1.237054f},{-0.823768f,3.788746,-1.567481f},{-3.095544f,7.353613,-1.024577f},{-4.056088f,7.631119f,2.062001f},{-0.289385f,5.382261f,2.329421f},{1.69752f,6.136483f,1.667037f},{-0.168758f,5.061138f,2.617453f},{2.853576f,1.605528,-1.229958f},{-4.514319f,6.586675f,0.352756f},{-2.558081f,7.741151f,1.29295f},{1.61116f,5.92358f,2.071534f},{3.936921f,3.354857f,0.091755f},{-0.1633f,1.119272f,3.147975f},{0.067551f,1.593475f,3.38212f},{-1.303239f,2.328184,-1.011672f},{-0.438093f,0.73423f,3.398384f},{-4.62767f,3.898187f,0.849573f},{0.286853f,4.165281f,3.284834f},{-2.968052f,8.492812,-3.493693f},{-0.111896f,3.696111f,3.53791f},{-3.808245f,8.451731,-1.574742f},{0.053416f,5.558764f,2.31107f},{3.956269f,3.012071f,0.11121f},{-0.710956f,8.106561,-0.665154f},{0.234725f,2.717326f,3.722379f},{-0.031594f,2.76411f,3.657347f},{-0.017371f,4.700633f,2.81911f},{0.215064f,5.034859f,2.721426f},{-0.111151f,8.480333,-0.649399f},{3.97942f,3.575478f,0.362219f},{0.392962f,4.735392f,2.874321f},{4.17015f,2.085087f,1.865999f},{0.169054f,1.244786f,3.337709f},{0.020049f,3.165818f,3.721736f},{0.248212f,3.595518f,3.698376f},{0.130706f,5.295541f,2.540034f},{-4.541357f,4.798332f,1.026866f},{-1.277485f,1.289518,-0.667272f},{3.892133f,3.54263,-0.078056f},{4.057379f,3.03669f,0.997913f},{0.287719f,0.884758f,3.251787f},{0.535771f,1.144701f,3.400096f},{0.585303f,1.399362f,3.505353f},{0.191551f,2.076246f,3.549355f},{0.328656f,2.394576f,3.649623f},{0.413124f,3.240728f,3.771515f},{0.630361f,4.501549f,2.963623f},{0.529441f,5.854392f,2.120225f},{3.805796f,3.769958,-0.162079f},{3.447279f,4.344846,-0.467276f},{0.377618f,5.551116f,2.426017f},{0.409355f,1.821269f,3.606333f},{0.719959f,2.194726f,3.703851f},{0.495922f,3.501519f,3.755661f},{0.603408f,5.354097f,2.603088f},{-4.605056f,7.531978f,1.19579f},{0.907972f,0.973128f,3.356513f},{0.750134f,3.356137f,3.765847f},{0.4496f,3.993244f,3.504544f},{-3.030738f,7.48947,-1.259169f},{0.707505f,5.602005f,2.43476f},{0.668944f,0.654891f,3.213797f},{0.593244f,2.700978f,3.791427f},{1.467759f,3.30327f,3.71035f},{3.316249f,2.436388f,2.581175f},{3.26138f,1.724425f,2.539028f},{-1.231292f,7.968263f,0.281414f},{-0.108773f,8.712307,-0.790607f},{4.445684f,1.819442f,1.896988f},{1.998959f,2.281499f,3.49447f},{2.162269f,2.113817f,3.365449f},{4.363397f,1.406731f,1.922714f},{4.808f,2.225842f,0.611127f},{2.735919f,0.771812,-0.701142f},{1.897735f,2.878428f,3.583482f},{-3.31616f,5.331985f,3.212394f},{-3.3314f,6.018137f,3.313018f},{-3.503183f,6.480103f,3.222216f},{-1.904453f,5.750392f,1.913324f},{-1.339735f,3.559592,-1.421817f},{-1.044242f,8.22539f,0.037414f},{1.643492f,3.110676f,3.647424f},{3.992832f,3.686244f,0.710946f},{1.774207f,1.71842f,3.475768f},{-3.438842f,5.5713f,3.427818f},{4.602447f,1.2583f,1.619528f},{-0.925516f,7.930042f,0.072336f},{-1.252093f,3.846565,-1.420761f},{-3.426857f,5.072419f,2.97806f},{-3.160408f,6.152629f,3.061869f},{3.739931f,3.367082f,2.041273f},{1.027419f,4.235891f,3.251253f},{4.777703f,1.887452f,1.560409f},{-3.318528f,6.733796f,2.982968f},{2.929265f,4.962579f,2.271079f},{3.449761f,2.838629f,2.474576f},{-3.280159f,5.029875f,2.787514f},{4.068939f,2.993629f,0.741567f},{0.303312f,8.70927,-1.121972f},{0.229852f,8.981322,-1.186075f},{-0.011045f,9.148156,-1.047057f},{-2.942683f,5.579613f,2.929297f},{-3.145409f,5.698727f,3.205778f},{-3.019089f,6.30887f,2.794323f},{-3.217135f,6.468191f,2.970032f},{-3.048298f,6.993641f,2.623378f},{-3.07429f,6.660982f,2.702434f},{3.612011f,2.5574f,2.25349f},{2.54516f,4.553967f,2.75884f},{-1.683759f,7.400787f,0.250868f},{-1.756066f,7.463557f,0.448031f},{-3.023761f,5.149697f,2.673539f},{3.112376f,2.677218f,2.782378f},{2.835327f,4.581196f,2.567146f},{-2.973799f,7.225458f,2.506988f},{-0.591645f,8.740662,-0.505845f},{3.782861f,2.04337f,2.03066f},{3.331604f,3.36343f,2.605047f},{2.966866f,1.205497f,2.537432f},{0.002669f,9.654748,-1.355559f},{2.632801f,0.58497f,2.540311f},{-2.819398f,5.087372f,2.521098f},{2.616193f,5.332961f,2.194288f},{-3.193973f,4.925634f,2.607924f},{-3.12618f,5.27524f,2.944544f},{-0.426003f,8.516354,-0.501528f},{2.802717f,1.387643f,2.751649f},{-3.120597f,7.889111,-2.75431f},{2.636648f,1.71702f,2.991302f},{-2.853151f,6.711792f,2.430276f},{-2.843836f,6.962865f,2.400842f},{1.9696f,3.199023f,3.504514f},{-2.461751f,0.386352f,3.008994f},{1.64127f,0.495758f,3.02958f},{-4.330472f,5.409831f,0.025287f},{-2.912387f,5.980416f,2.844261f},{-2.490069f,0.211078f,2.985391f},{3.581816f,4.809118f,0.733728f},{2.693199f,2.647213f,3.126709f},{-0.182964f,8.184108,-0.638459f},{-2.226855f,0.444711f,2.946552f},{-0.720175f,8.115055f,0.017689f},{2.645302f,4.316212f,2.850139f},{-0.232764f,9.329503,-0.918639f},{4.852365f,1.471901f,0.65275f},{2.76229f,2.014994f,2.957755f},{-2.808374f,5.354301f,2.644695f},{-2.790967f,6.406963f,2.547985f},{-1.342684f,0.418488,-1.669183f},{2.690675f,5.593587,-0.041236f},{4.660146f,1.6318f,1.713314f},{2.775667f,3.007229f,3.111332f},{-0.396696f,8.963432,-0.706202f},{2.446707f,2.740617f,3.321433f},{-4.803209f,5.884634f,2.603672f},{-2.652003f,1.6541f,1.5078f},{3.932327f,3.972874f,0.831924f},{2.135906f,0.955587f,2.986608f},{2.486131f,2.053802f,3.124115f},{-0.386706f,8.115753,-0.37565f},{-2.720727f,7.325044f,2.224878f},{-1.396946f,7.638016,-0.16486f},{-0.62083f,7.989771,-0.144413f},{-2.653272f,5.729684f,2.667679f},{3.038188f,4.65835f,2.364142f},{2.381721f,0.739472f,2.788992f},{-2.345829f,5.474929f,2.380633f},{-2.518983f,6.080562f,2.479383f},{-2.615793f,6.839622f,2.186116f},{-2.286566f,0.143752f,2.766848f},{-4.771219f,6.508766f,1.070797f},{3.717308f,2.905019f,2.097994f},{2.50521f,3.016743f,3.295898f},{2.208448f,1.56029f,3.216806f},{3.346783f,1.01254f,2.119951f},{2.653503f,3.26122f,3.175738f},{-2.359636f,5.827519f,2.402297f},{-1.952693f,0.558102f,2.853307f},{-0.321562f,9.414885,-1.187501f},{3.138923f,1.405072f,2.520765f},{1.493728f,1.780051f,3.621969f},{3.01817f,0.907291f,2.336909f},{3.183548f,1.185297f,2.352175f},{1.608619f,5.006753f,2.695131f},{-4.723919f,6.836107f,1.095288f},{-1.017586f,8.865429,-0.149328f},{4.730762f,1.214014f,0.64008f},{-2.135182f,6.647907f,1.495471f},{-2.420382f,6.546114f,2.108209f},{-2.458053f,7.186346f,1.896623f},{3.437124f,0.275798f,1.138203f},{0.095925f,8.725832,-0.926481f},{2.417376f,2.429869f,3.287659f},{2.279951f,1.200317f,3.049994f},{2.674753f,2.326926f,3.044059f},{-2.328123f,6.849164f,1.75751f},{-3.418616f,7.853407f,0.126248f},{-3.151587f,7.77543,-0.110889f},{2.349144f,5.653242f,2.05869f},{-2.273236f,6.085631f,2.242888f},{-4.560601f,4.525342f,1.261241f},{2.866334f,3.796067f,2.934717f},{-2.17493f,6.505518f,1.791367f},{3.12059f,3.283157f,2.818869f},{3.037703f,3.562356f,2.866653f},{0.066233f,9.488418,-1.248237f},{2.749941f,0.975018f,2.573371f},{-2.155749f,5.801033f,2.204009f},{-2.162778f,6.261889f,2.028596f},{1.936874f,0.459142f,2.956718f},{3.176249f,4.335541f,2.440447f},{4.356599f,1.029423f,1.700589f},{3.873502f,3.082678f,1.80431f},{2.895489f,4.243034f,2.735259f},{-0.095774f,9.468195,-1.07451f},{-1.124982f,7.886808,-0.480851f},{3.032304f,3.065454f,2.897927f},{3.692687f,4.5961f,0.957858f},{-3.013045f,3.807235,-1.098381f},{-0.790012f,8.92912,-0.367572f},{1.905793f,0.73179f,2.996728f},{3.530396f,3.426233f,2.356583f},{2.12299f,0.624933f,2.929167f},{-2.069196f,6.039284f,2.01251f},{-3.565623f,7.182525f,2.850039f},{2.959264f,2.376337f,2.829242f},{2.949071f,1.822483f,2.793933f},{4.036142f,0.763803f,1.703744f},{-1.993527f,6.180318f,1.804936f},{-0.030987f,0.766389f,3.344766f},{-0.549683f,8.225193,-0.189341f},{-0.765469f,8.272246,-0.127174f},{-2.947047f,7.541648,-0.414113f},{-3.050327f,9.10114,-3.435619f},{3.488566f,2.231807f,2.399836f},{3.352283f,4.727851f,1.946438f},{4.741011f,2.162773f,1.499574f},{-1.815093f,6.072079f,1.580722f},{-3.720969f,8.267927,-0.984713f},{1.932826f,3.714052f,3.427488f},{3.323617f,4.438961f,2.20732f},{0.254111f,9.26364,-1.373244f},{-1.493384f,7.868585,-0.450051f},{-0.841901f,0.776135,-1.619467f},{0.243537f,6.027668f,0.091687f},{0.303057f,0.313022,-0.531105f},{-0.435273f,0.474098f,3.481552f},{2.121507f,2.622389f,3.486293f},{1.96194f,1.101753f,3.159584f},{3.937991f,3.407551f,1.551392f},{0.070906f,0.295753f,1.377185f},{-1.93588f,7.631764f,0.651674f},{-2.523531f,0.744818,-0.30985f},{2.891496f,3.319875f,2.983079f},{4.781765f,1.547061f,1.523129f},{-2.256064f,7.571251f,0.973716f},{3.244861f,3.058249f,2.724392f},{-0.145855f,0.437775f,3.433662f},{1.586296f,5.658538f,2.358487f},{3.658336f,3.774921f,2.071837f},{2.840463f,4.817098f,2.46376f},{-1.219464f,8.122542,-0.672808f},{-2.520906f,2.664486,-1.034346f},{-1.315417f,8.471365,-0.709557f},{3.429165f,3.74686f,2.446169f},{3.074579f,3.840758f,2.767409f},{3.569443f,3.166337f,2.333647f},{2.294337f,3.280051f,3.359346f},{2.21816f,3.66578f,3.269222f},{2.158662f,4.151444,-1.357919f},{1.13862f,4.380986,-1.404565f},{3.388382f,2.749931,-0.840949f},{3.059892f,5.084848f,2.026066f},{3.204739f,2.075145f,2.640706f},{3.387065f,1.42617f,2.305275f},{3.910398f,2.670742f,1.750179f},{3.471512f,1.945821f,2.395881f},{4.08082f,1.070654f,1.960171f},{-1.057861f,0.133036f,2.146707f},{-0.151749f,5.53551,-0.624323f},{3.233099f,4.003778f,2.571172f},{2.611726f,5.319199,-0.499388f},{2.682909f,1.094499,-1.206247f},{-1.22823f,7.656887f,0.041409f},{-2.293247f,7.259189f,0.013844f},{0.081315f,0.202174f,3.286381f},{-1.002038f,5.794454,-0.187194f},{3.448856f,4.08091f,2.258325f},{0.287883f,9.006888,-1.550641f},{-3.851019f,4.059839,-0.646922f},{3.610966f,4.205438f,1.913129f},{2.239042f,2.950872f,3.449959f},{0.216305f,0.442843f,3.328052f},{1.87141f,2.470745f,3.574559f},{3.811378f,2.768718,-0.228364f},{2.511081f,1.362724f,2.969349f},{-1.59813f,7.866506f,0.440184f},{-3.307975f,2.851072,-0.894978f},{-0.107011f,8.90573,-0.884399f},{-3.855315f,2.842597,-0.434541f},{2.517853f,1.090768f,2.799687f},{3.791709f,2.36685f,2.002703f},{4.06294f,2.773922f,0.452723f},{-2.973289f,7.61703,-0.623653f},{-2.95509f,8.924462,-3.446319f},{2.861402f,0.562592f,2.184397f},{-1.109725f,8.594206,-0.076812f},{-0.725722f,7.924485,-0.381133f},{-1.485587f,1.329994,-0.654405f},{-4.342113f,3.233735f,1.752922f},{-2.968049f,7.955519,-2.09405f},{-3.130948f,0.446196f,0.85287f},{-4.958475f,5.757329f,1.447055f},{-3.086547f,7.615193,-1.953168f},{-3.751923f,5.412821f,3.373373f},{-4.599645f,7.480953f,1.677134f},{1.133992f,0.274871f,0.032249f},{-2.956512f,8.126905,-1.785461f},{-0.960645f,4.73065,-1.191786f},{-2.871064f,0.875559f,0.424881f},{-4.932114f,5.99614f,1.483845f},{-2.981761f,8.124612,-1.387276f},{0.362298f,8.978545,-1.368024f},{-4.408375f,3.046271f,0.602373f},{2.865841f,2.322263,-1.344625f},{-4.7848f,5.620895f,0.594432f},{-2.88322f,0.338931f,1.67231f},{-4.688101f,6.772931f,1.872318f},{-4.903948f,6.164698f,1.27135f},{2.85663f,1.005647,-0.906843f},{2.691286f,0.209811f,0.050512f},{-4.693636f,6.477556f,0.665796f},{-4.472331f,6.861067f,0.477318f},{0.883065f,0.204907f,3.073933f},{-0.995867f,8.048729,-0.653897f},{-0.794663f,5.670397,-0.390119f},{3.313153f,1.638006,-0.722289f},{-4.856459f,5.394758f,1.032591f},{-3.005448f,7.783023,-0.819641f},{3.11891f,2.036974,-1.08689f},{-2.364319f,2.408419f,2.63419f},{-2.927132f,8.75435,-3.537159f},{-3.296222f,7.964629,-3.134625f},{-1.642041f,4.13417,-1.301665f},{2.030759f,0.176372,-1.030923f},{-4.559069f,3.751053f,0.548453f},{3.438385f,4.59454,-0.243215f},{-2.561769f,7.93935f,0.177696f},{2.990593f,1.335314,-0.943177f},{1.2808f,0.276396,-0.49072f},{-0.318889f,0.290684f,0.211143f},{3.54614f,3.342635,-0.767878f},{-3.073372f,7.780018,-2.357807f},{-4.455388f,4.387245f,0.361038f},{-4.659393f,6.276064f,2.767014f},{0.636799f,4.482223,-1.426284f},{-2.987681f,8.072969,-2.45245f},{-2.610445f,0.763554f,1.792054f},{3.358241f,2.006707,-0.802973f},{-0.498347f,0.251594f,0.962885f},{3.1322f,0.683312f,2.038777f},{-4.389801f,7.493776f,0.690247f},{0.431467f,4.22119,-1.614215f},{-4.376181f,3.213141f,0.273255f},{-4.872319f,5.715645f,0.829714f},{-4.826893f,6.195334f,0.849912f},{3.516562f,2.23732,-0.677597f},{3.131656f,1.698841,-0.975761f},{-4.754925f,5.411666f,1.989303f},{-2.987299f,7.320765,-0.629479f},{-3.757635f,3.274862,-0.744022f},{3.487044f,2.541999,-0.699933f},{-4.53274f,4.649505f,0.77093f},{-1.424192f,0.099423f,2.633327f},{3.090867f,2.476975,-1.146957f},{-2.713256f,0.815622f,2.17311f},{3.348121f,3.254167,-0.984896f},{-3.031379f,0.16453,-0.309937f},{-0.949757f,4.518137,-1.309172f},{-0.889509f,0.095256f,1.288803f},{3.539594f,1.966105,-0.553965f},{-4.60612f,7.127749f,0.811958f},{-2.332953f,1.444713f,1.624548f},{3.136293f,2.95805,-1.138272f},{3.540808f,3.069058,-0.735285f},{3.678852f,2.362375,-0.452543f},{-4.648898f,7.37438f,0.954791f},{-0.646871f,0.19037f,3.344746f},{2.2825f,0.29343,-0.826273f},{-4.422291f,7.183959f,0.557517f},{-4.694668f,5.246103f,2.541768f},{-4.583691f,4.145486f,0.600207f},{-2.934854f,7.912513,-1.539269f},{-3.067861f,7.817472,-0.546501f},{3.825095f,3.229512,-0.237547f},{2.532494f,0.323059f,2.387105f},{-2.514583f,0.692857f,1.23597f},{-4.736805f,7.214384f,1.259421f},{-2.98071f,8.409903,-2.468199f},{2.621468f,1.385844,-1.406355f},{3.811447f,3.560855f,1.847828f},{3.432925f,1.497205,-0.489784f},{3.746609f,3.631538,-0.39067f},{3.594909f,2.832257,-0.576012f},{-0.404192f,5.300188,-0.856561f},{-4.762996f,6.483774f,1.702648f},{-4.756612f,6.786223f,1.43682f},{-2.965309f,8.437217,-2.785495f},{2.863867f,0.74087,-0.429684f},{4.02503f,2.968753f,1.392419f},{3.669036f,1.833858,-0.304971f},{-2.888864f,0.720537f,0.778057f},{-2.36982f,0.979443f,1.054447f},{-2.959259f,8.222303,-2.659724f},{-3.467825f,7.545739,-2.333445f},{2.153426f,0.446256,-1.20523f},{-3.229807f,9.189699,-3.596609f},{-3.72486f,8.773707,-2.046671f},{3.687218f,3.297751,-0.523746f},{1.381025f,0.08815,-1.185668f},{-2.796828f,7.205622,-0.208783f},{3.647194f,4.066232,-0.291507f},{-4.578376f,3.885556f,1.52546f},{-2.840262f,0.63094f,1.89499f},{-2.429514f,0.922118f,1.820781f},{-4.675079f,6.573925f,2.423363f},{2.806207f,4.320188,-1.027372f},{-1.289608f,0.097241f,1.321661f},{-3.010731f,8.141334,-2.866148f},{3.202291f,1.235617,-0.549025f},{4.094792f,2.477519f,0.304581f},{2.948403f,0.966873,-0.664857f},{-4.83297f,5.920587f,2.095461f},{-2.169693f,7.257277f,0.946184f},{-1.335807f,3.057597,-1.303166f},{-1.037877f,0.64151,-1.685271f},{2.627919f,0.089814f,0.439074f},{3.815794f,3.808102f,1.730493f},{-2.973455f,8.433141,-3.08872f},{-2.391558f,7.331428f,1.658264f},{-4.333107f,4.529978f,1.850516f},{-4.640293f,3.767107f,1.168841f},{3.600716f,4.46931f,1.734024f},{3.880803f,1.730158,-0.172736f},{3.814183f,4.262372f,1.167042f},{4.37325f,0.829542f,1.413729f},{2.490447f,5.75111f,0.011492f},{3.460003f,4.962436f,1.188971f},{3.918419f,3.814234f,1.358271f},{-0.807595f,8.840504,-0.953711f},{3.752855f,4.20577f,1.57177f},{-2.991085f,8.816501,-3.244595f},{-2.333196f,7.128889f,1.551985f},{3.977718f,3.570941f,1.25937f},{4.360071f,0.755579f,1.079916f},{4.637579f,1.027973f,1.032567f},{-2.317f,7.421066f,1.329589f},{-1.013404f,8.293662,-0.7823f},{4.548023f,1.020644f,1.420462f},{4.763258f,1.266798f,1.296203f},{4.896f,2.073084f,1.255213f},{4.015005f,3.325226f,1.093879f},{4.94885f,1.860936f,0.894463f},{-2.189645f,6.954634f,1.270077f},{4.887442f,1.720992f,1.288526f},{-3.184068f,7.871802f,0.956189f},{-1.274318f,0.839887,-1.224389f},{-2.919521f,7.84432f,0.541629f},{-2.994586f,7.766102f,1.96867f},{-3.417504f,9.241714,-3.093201f},{-3.174563f,7.466456f,2.473617f},{-3.263067f,9.069412,-3.003459f},{-2.841592f,0.529833f,2.693434f},{-3.611069f,9.158804,-2.829871f},{-4.642828f,5.927526f,0.320549f},{-3.809308f,9.051035,-2.692749f},{-2.837582f,7.487987,-0.106206f},{4.773025f,2.330442f,1.213899f},{4.897435f,2.209906f,0.966657f},{-3.067637f,8.164062,-1.12661f},{-3.122129f,8.08074,-0.899194f},{4.571019f,2.358113f,1.462054f},{4.584884f,2.454418f,0.709466f},{-3.661093f,7.146581,-0.475948f},{4.735131f,2.415859f,0.933939f},{4.207556f,2.540018f,1.218293f},{-3.607595f,7.89161,-0.121172f},{-1.527952f,0.775564,-1.061903f},{4.53874f,2.503273f,1.099583f},{-3.938837f,7.587988f,0.082449f},{-4.853582f,6.152409f,1.787943f},{-4.752214f,6.247234f,2.296873f},{4.602935f,2.363955f,0.488901f},{-1.81638f,6.365879f,0.868272f},{0.595467f,4.744074,-1.32483f},{1.87635f,3.511986,-1.842924f},{4.330947f,2.534326f,0.720503f},{4.108736f,2.750805f,0.904552f},{-1.890939f,8.492628,-0.290768f},{-3.504309f,6.173058,-0.422804f},{-1.611992f,6.196732f,0.648736f},{-3.899149f,7.826123f,1.088845f},{-3.078303f,3.008813,-1.035784f},{-2.798999f,7.844899f,1.340061f},{-1.248839f,5.959105f,0.041761f},{0.767779f,4.337318f,3.090817f},{-3.831177f,7.515605f,2.432261f},{-1.667528f,6.156208f,0.365267f},{-1.726078f,6.237384f,1.100059f},{-3.972037f,4.520832,-0.370756f},{-4.40449f,7.636357f,1.520425f},{-1.34506f,6.004054f,1.293159f},{-1.233556f,6.049933f,0.500651f},{-3.696869f,7.79732f,0.37979f},{-3.307798f,8.949964,-2.698113f},{-1.997295f,6.615056f,1.103691f},{-3.219222f,8.336394,-1.150614f},{-3.452623f,8.31866,-0.9417f},{-3.94641f,2.990494f,2.212592f},{-3.250025f,8.030414,-0.596097f},{-2.02375f,1.571333f,2.397939f},{-3.190358f,7.665013f,2.268183f},{-2.811918f,7.618526f,2.145587f},{-1.005265f,5.892303f,0.072158f},{-0.93721f,5.974148f,0.906669f},{-4.646072f,7.492193f,1.45312f},{-0.252931f,1.797654f,3.140638f},{-1.076064f,5.738433f,1.695953f},{-3.980534f,7.744391f,1.735791f},{-0.721187f,5.939396f,0.526032f},{-0.42818f,5.919755f,0.229001f},{-1.43429f,6.11622f,0.93863f},{-0.985638f,5.939683f,0.290636f},{-4.433836f,7.461372f,1.966437f},{-3.696398f,7.844859f,1.547325f},{-3.390772f,7.820186f,1.812204f},{-2.916787f,7.864019f,0.804341f},{-3.715952f,8.037269,-0.591341f},{-4.204634f,7.72919f,1.119866f},{-4.592233f,5.592883f,0.246264f},{3.307299f,5.061701f,1.622917f},{-3.515159f,7.601467f,2.368914f},{-3.435742f,8.533457,-1.37916f},{-0.269421f,4.545635,-1.366445f},{-2.542124f,3.768736,-1.258512f},{-3.034003f,7.873773f,1.256854f},{-2.801399f,7.856028f,1.080137f},{3.29354f,5.220894f,1.081767f},{-2.35109f,1.299486f,1.01206f},{-3.232213f,7.768136f,2.047563f},{3.290415f,5.217525f,0.68019f},{-3.415109f,7.731034f,2.144326f},{3.440357f,4.962463f,0.373387f},{3.147346f,5.352121f,1.386923f},{2.847252f,5.469051f,1.831981f},{3.137682f,5.410222f,1.050188f},{3.102694f,5.310456f,1.676434f},{-3.044601f,0.39515f,1.994084f},{2.903647f,5.561338f,1.518598f},{-3.810148f,8.093598,-0.889131f},{4.234835f,0.803054f,1.593271f},{3.240165f,5.228747f,0.325955f},{3.037452f,5.509825f,0.817137f},{2.635031f,5.795187f,1.439724f},{3.071607f,5.318303f,0.080142f},{2.909167f,5.611751f,1.155874f},{3.044889f,5.465928f,0.486566f},{2.502256f,5.770673f,1.740054f},{-0.067497f,0.086416,-1.190239f},{2.33326f,5.906051f,0.138295f},{0.65096f,4.205423f,3.308767f},{-2.671137f,7.936535f,0.432731f},{2.14463f,5.879214f,1.866047f},{-4.776469f,5.890689f,0.561986f},{2.72432f,5.655145f,0.211951f},{2.730488f,5.751455f,0.695894f},{2.572682f,5.869295f,1.152663f},{1.906776f,5.739123f,2.196551f},{2.344414f,5.999961f,0.772922f},{-3.377905f,7.448708,-1.863251f},{2.285149f,5.968156f,1.459258f},{2.385989f,5.928974f,0.3689f},{2.192111f,6.087516f,0.959901f},{2.36372f,6.001101f,1.074346f},{1.972022f,6.079603f,1.591175f},{1.87615f,5.976698f,1.91554f},{-3.824761f,9.05372,-2.928615f},{2.044704f,6.129704f,1.263111f},{-2.583046f,0.849537f,2.497344f},{-0.078825f,2.342205f,3.520322f},{-0.704686f,0.537165f,3.397194f},{-0.257449f,3.235334f,3.647545f},{-0.332064f,1.448284f,3.022583f},{-2.200146f,0.898284,-0.447212f},{-2.497508f,1.745446f,1.829167f},{0.30702f,4.416315f,2.978956f},{-3.205197f,3.479307,-1.040582f},{0.110069f,9.347725,-1.563686f},{-0.82754f,0.883886f,3.065838f},{-2.017103f,1.244785f,2.42512f},{-0.421091f,2.309929f,3.153898f},{-0.491604f,3.796072f,3.16245f},{2.786955f,3.501241,-1.340214f},{-3.229055f,4.380713,-0.899241f},{3.730768f,0.76845f,1.90312f},{-0.561079f,2.652382f,3.152463f},{-3.461471f,3.086496f,2.662505f},{-0.661405f,3.446009f,3.179939f},{-0.915351f,0.636755f,3.243708f},{-2.992964f,8.915628,-3.729833f},{-0.439627f,3.502104f,3.42665f},{-1.154217f,0.883181f,2.800835f},{-1.736193f,1.465474f,2.595489f},{-0.423928f,3.24435f,3.548277f},{-0.511153f,2.871046f,3.379749f},{-0.675722f,2.991756f,3.143262f},{-1.092602f,0.599103f,3.090639f},{-0.89821f,2.836952f,2.840023f},{-2.658412f,0.781376f,0.960575f},{-2.271455f,1.222857f,1.330478f},{-0.877861f,1.111222f,2.72263f},{-0.306959f,2.876987f,3.556044f},{-3.839274f,7.84138,-0.918404f},{-0.172094f,4.083799f,3.141708f},{-1.548332f,0.2529f,2.864655f},{-0.217353f,4.873911,-1.223104f},{-3.384242f,3.181056,-0.95579f},{-2.731704f,0.382421f,2.895502f},{-1.285037f,0.551267f,2.947675f},{0.077224f,4.246579f,3.066738f},{-0.479979f,1.77955f,2.860011f},{-0.716375f,1.224694f,2.666751f},{-0.54622f,3.138255f,3.393457f},{-2.33413f,1.821222f,2.124883f},{-0.50653f,2.037147f,2.897465f},{2.451291f,1.211389,-1.466589f},{-3.160047f,2.894081f,2.724286f},{-4.137258f,5.433431f,3.21201f},{0.462896f,0.320456,-0.174837f},{-0.37458f,2.609447f,3.379253f},{-3.095244f,0.256205f,2.196446f},{-4.197985f,5.732991f,3.262924f},{-0.729747f,0.246036f,0.497036f},{-2.356189f,5.062,-0.965619f},{-1.609036f,0.25962,-1.487367f},{-4.074381f,6.074061f,3.409459f},{-3.619304f,4.0022f,2.65705f},{-0.543393f,8.742896,-1.056622f},{-4.30356f,6.858934f,2.879642f},{-0.716688f,2.901831,-2.11202f},{1.547362f,0.083189f,1.138764f},{-0.250916f,0.275268f,1.201344f},{-3.778035f,3.13624f,2.466177f},{-4.594316f,5.771342f,3.01694f},{-3.717706f,3.442887f,2.603344f},{-4.311163f,5.224669f,3.019373f},{-0.610389f,2.095161,-1.923515f},{-3.040086f,6.196918,-0.429149f},{-3.802695f,3.768247f,2.545523f},{-0.159541f,2.043362f,3.328549f},{-3.744329f,4.31785f,2.491889f},{-3.047939f,0.214155f,1.873639f},{-4.41685f,6.113058f,3.166774f},{-1.165133f,0.460692,-1.742134f},{-1.371289f,4.249996,-1.317935f},{-3.447883f,0.3521f,0.466205f},{-4.495555f,6.465548f,2.944147f},{-3.455335f,0.171653f,0.390816f},{-3.964028f,4.017196f,2.376009f},{-1.323595f,1.763126,-0.750772f},{-3.971142f,5.277524,-0.19496f},{-3.222052f,0.237723f,0.872229f},{-4.403784f,3.89107f,1.872077f},{-3.333311f,0.342997f,0.661016f},{-4.495871f,4.29606f,1.63608f},{-3.636081f,2.760711f,2.361949f},{-4.487235f,3.559608f,1.66737f},{-4.719787f,7.26888f,1.658722f},{-1.086143f,9.035741,-0.707144f},{-2.339693f,1.600485,-0.404817f},{-4.642011f,7.123829f,1.990987f},{-1.498077f,3.854035,-1.369787f},{-4.188372f,4.729363f,2.02983f},{-3.116344f,5.882284,-0.468884f},{-4.305236f,4.246417f,1.976991f},{-3.022509f,0.22819f,1.065688f},{-2.799916f,0.52022f,1.128319f},{-4.262823f,3.534409f,2.020383f},{-4.221533f,3.947676f,2.11735f},{-3.744353f,4.391712,-0.6193f},{-1.272905f,0.156694,-1.741753f},{-3.62491f,2.669825,-0.549664f},{-4.180756f,3.096179f,1.987215f},{-4.059276f,4.305313f,2.232924f},{-2.812753f,0.183226f,1.370267f},{-4.032437f,3.512234f,2.309985f},{-0.03787f,0.28188f,0.530391f},{-4.711562f,5.468653f,2.822838f},{-4.500636f,6.953314f,2.564445f},{-4.479433f,7.216991f,2.270682f},{3.990562f,0.50522f,0.716309f},{-2.512229f,6.863447,-0.100658f},{-2.968058f,6.956639,-0.37061f},{2.550375f,3.142683,-1.54068f},{-2.320059f,3.521605,-1.279397f},{-4.556319f,6.64662f,2.745363f},{-4.281091f,7.108116f,2.667598f},{-2.050095f,8.411689f,0.121353f},{-2.44854f,1.135487f,0.851875f},{3.121815f,0.699943,-0.277167f},{-4.69877f,6.00376f,2.843035f},{-1.360599f,8.824742,-0.595597f},{1.128437f,0.171611f,0.301691f},{-4.360146f,6.289423f,0.042233f},{1.400795f,4.088829,-1.620409f},{-3.193462f,8.460137,-3.559446f},{-3.168771f,8.878431,-3.635795f},{-3.434275f,9.304302,-3.460878f},{-3.349993f,8.808093,-3.38179f},{-3.304823f,8.323865,-3.325905f},{-3.572607f,9.308843,-3.207672f},{-3.166393f,8.201215,-3.43014f},{-3.451638f,9.05331,-3.351345f},{-3.309591f,8.549758,-3.375055f},{-3.527992f,8.793926,-3.100376f},{-3.6287f,8.981677,-3.076319f},{-3.445505f,8.001887,-2.8273f},{-3.408011f,8.221014,-3.039237f},{-3.65928f,8.740382,-2.808856f},{-3.878019f,8.797295,-2.462866f},{-3.515132f,8.232341,-2.747739f},{-3.460331f,8.51524,-3.06818f},{-3.403703f,7.658628,-2.648789f},{-3.507113f,8.00159,-2.582275f},{-3.607373f,8.174737,-2.401723f},{-3.749043f,8.378084,-2.226959f},{-3.648514f,8.502213,-2.6138f},{-2.534199f,0.904753f,2.021148f},{1.4083f,5.744252,-0.571402f},{-3.852536f,8.571009,-2.352358f},{2.868255f,5.373126,-0.163705f},{2.224363f,4.669891,-1.061586f},{-4.528281f,4.885838f,1.340274f},{1.30817f,4.609629,-1.28762f},{-4.519698f,3.422501f,1.354826f},{-3.549955f,7.783228,-2.332859f},{1.12313f,6.120856f,0.045115f},{-3.620324f,7.57716,-2.033423f},{-0.798833f,2.624133,-1.992682f},{-3.617587f,7.783148,-2.051383f},{-3.669293f,8.103776,-2.10227f},{-3.892417f,8.667436,-2.167288f},{-0.537435f,0.285345,-0.176267f},{-0.841522f,3.299866,-1.887861f},{-0.761547f,3.647082,-1.798953f},{-3.661544f,7.85708,-1.867924f},{-3.886763f,8.551783,-1.889171f},{-0.591244f,1.549749,-1.714784f},{-0.775276f,1.908218,-1.597609f},{-0.961458f,2.573273,-1.695549f},{-2.215672f,1.335009f,2.143031f},{-4.622674f,4.130242f,1.220683f},{1.07344f,0.290099f,1.584734f},{-0.976906f,2.92171,-1.76667f},{-1.13696f,3.194401,-1.513455f},{-3.743262f,7.99949,-1.629286f},{-2.876359f,4.900986,-0.879556f},{0.550835f,3.905557,-2.031372f},{0.777647f,4.992314,-1.215703f},{1.445881f,4.266201,-1.414663f},{1.274222f,5.510543,-0.824495f},{-0.864685f,2.318581,-1.702389f},{-0.627458f,3.820722,-1.743153f},{-3.867699f,8.30866,-1.850066f},{1.635287f,5.45587,-0.83844f},{-1.037876f,2.538589,-1.513504f},{-4.38993f,4.73926f,1.699639f},{0.048709f,4.765232,-1.279506f},{-0.626548f,1.339887,-1.595114f},{-3.682827f,7.643453,-1.723398f},{-3.868783f,8.180191,-1.511743f},{-0.76988f,1.508373,-1.419599f},{-1.138374f,2.766765,-1.448163f},{1.699883f,5.780752,-0.475361f},{1.214305f,0.308517f,1.866405f},{-1.713642f,0.373461,-1.265204f},{-1.582388f,0.58294,-1.267977f},{-0.879549f,1.821581,-1.313787f},{0.519057f,5.858757,-0.381397f},{-3.770989f,2.449208,-0.132655f},{0.087576f,0.156713,-1.53616f},{-0.942622f,2.146534,-1.421494f},{-1.026192f,1.022164,-1.145423f},{-0.964079f,1.645473,-1.067631f},{-1.109128f,2.458789,-1.29106f},{-1.037478f,0.209489,-1.805424f},{-3.724391f,7.599686,-1.273458f},{-3.787898f,7.951792,-1.304794f},{3.821677f,2.165581,-0.181535f},{-2.39467f,0.304606,-0.570375f},{-2.352928f,1.0439f,2.079369f},{-0.288899f,9.640684,-1.006079f},{-3.472118f,7.263001,-1.080326f},{-1.240769f,0.972352,-0.976446f},{-1.845253f,0.356801,-0.995574f},{-2.32279f,7.915361,-0.057477f},{-1.08092f,2.179315,-1.168821f},{4.598833f,2.156768f,0.280264f},{-4.725417f,6.442373f,2.056809f},{-0.490347f,9.46429,-0.981092f},{-1.99652f,0.09737,-0.765828f},{-1.137793f,1.888846,-0.894165f},{-0.37247f,4.29661,-1.465199f},{-0.184631f,5.692946,-0.421398f},{-3.751694f,7.742231,-1.086908f},{-1.001416f,1.298225,-0.904674f},{-3.536884f,7.190777,-0.788609f},{-3.737597f,7.511281,-0.940052f},{-1.766651f,0.669388,-0.873054f},{3.112245f,3.474345,-1.129672f},{-0.175504f,3.81298,-2.0479f},{-3.766762f,7.412514,-0.681569f},{-0.63375f,9.439424,-0.785128f},{-0.518199f,4.768982,-1.258625f},{0.790619f,4.212759,-1.610218f},{-3.761951f,3.742528,-0.756283f},{0.897483f,5.679808,-0.612423f},{2.221126f,4.427468,-1.252155f},{-0.728577f,5.846457f,0.062702f},{0.194451f,9.503908,-1.482461f},{-0.099243f,9.385459,-1.39564f},{0.643185f,3.636855,-2.180247f},{0.894522f,5.900601,-0.356935f},{2.595516f,4.75731,-0.893245f},{1.108497f,3.936893,-1.905098f},{1.989894f,5.789726,-0.343268f},{-3.802345f,7.655508,-0.613817f},{2.339353f,4.96257,-0.90308f},{0.12564f,4.013324,-1.879236f},{-4.078965f,3.683254,-0.445439f},{2.092899f,5.256128,-0.831607f},{0.427571f,0.291769f,1.272964f},{2.335549f,3.480056,-1.581949f},{-0.15687f,0.324827,-1.648922f},{-0.536522f,5.760786,-0.203535f},{1.507082f,0.078251,-0.923109f},{-1.854742f,0.134826f,2.698774f},{-3.939827f,3.168498,-0.526144f},{-3.98461f,3.39869,-0.533212f},{-3.961738f,4.217132,-0.489147f},{4.273789f,2.181164f,0.153786f},{-0.470498f,5.645664,-0.439079f},{-0.414539f,5.488017,-0.673379f},{-0.097462f,5.062739,-1.114863f},{1.198092f,5.882232,-0.391699f},{2.855834f,5.085022,-0.498678f},{1.037998f,4.129757,-1.701811f},{1.728091f,5.068444,-1.063761f},{-3.832258f,2.625141,-0.311384f},{-4.078526f,3.070256,-0.284362f},{-4.080365f,3.954243,-0.440471f},{-0.152578f,5.276267,-0.929815f},{-1.489635f,8.928082,-0.295891f},{0.759294f,5.15585,-1.087374f},{-4.000338f,2.801647,-0.235135f},{-4.290801f,3.823209,-0.19374f},{-4.221493f,4.25618,-0.189894f},{-4.066195f,4.71916,-0.201724f},{-0.155386f,4.076396,-1.662865f},{3.054571f,4.414305,-0.825985f},{-1.652919f,8.726499,-0.388504f},{-3.042753f,0.560068,-0.126425f},{-2.434456f,1.118088,-0.213563f},{-2.623502f,1.845062,-0.283697f},{-4.233371f,3.43941,-0.202918f},{2.726702f,3.82071,-1.280097f},{0.184199f,4.14639,-1.673653f},{-1.289203f,0.624562,-1.560929f},{-3.823676f,7.382458,-0.407223f},{0.476667f,5.064419,-1.143742f},{-3.873651f,4.955112,-0.269389f},{1.349666f,5.312227,-1.000274f},{-2.043776f,8.434488,-0.108891f},{-2.763964f,0.733395,-0.129294f},{-4.380505f,3.664409,-0.024546f},{-0.71211f,5.341811,-0.803281f},{-3.960858f,7.183112,-0.118407f},{-3.822277f,7.712853,-0.263221f},{-2.346808f,8.108588f,0.063244f},{-1.841731f,8.642999,-0.142496f},{-2.600055f,0.985604,-0.043595f},{-3.513057f,2.213243,-0.044151f},{-3.963492f,2.603055,-0.080898f},{-4.258066f,3.14537,-0.027046f},{-4.261572f,5.00334f,0.13004f},{0.795464f,3.99873,-1.905688f},{-3.300873f,0.384761f,0.013271f},{-2.770244f,0.881942f,0.077313f},{-3.456227f,1.993871f,0.301054f},{-4.441987f,3.914144f,0.177867f},{-4.367075f,6.611414f,0.165312f},{-3.201767f,0.576292f,0.105769f},{-3.174354f,0.645009f,0.440373f},{-2.996576f,0.74262f,0.161325f},{-2.724979f,1.656497f,0.092983f},{-3.261757f,2.017742,-0.070763f},{-4.280173f,4.518235,-0.002999f},{-4.471073f,5.945358f,0.05202f},{-3.877137f,2.40743f,0.274928f},{-4.371219f,4.252758f,0.078039f},{-3.400914f,0.40983f,0.238599f},{-4.44293f,3.523242f,0.146339f},{-4.574528f,5.279761f,0.353923f},{-4.226643f,7.191282f,0.269256f},{-4.16361f,2.843204f,0.097727f},{-4.528506f,5.011661f,0.536625f},{0.35514f,5.664802,-0.572814f},{2.508711f,5.580976,-0.266636f},{2.556226f,3.633779,-1.426362f},{1.878456f,4.533714,-1.223744f},{2.460709f,4.440241,-1.1395f},{2.218589f,5.514603,-0.560066f},{2.263712f,5.737023,-0.250694f},{2.964981f,3.814858,-1.139927f},{0.991384f,5.304131,-0.999867f},{2.81187f,4.547292,-0.916025f},{2.918089f,4.768382,-0.702808f},{3.262403f,4.414286,-0.657935f},{0.652136f,6.089113f,0.069089f},{3.361389f,3.5052,-0.946123f},{2.613042f,5.037192,-0.697153f},{0.094339f,4.36858,-1.451238f},{3.290862f,4.155716,-0.732318f},{2.658063f,4.073614,-1.217455f},{3.260349f,3.753257,-0.946819f},{1.124268f,4.862463,-1.207855f},{3.35158f,4.899247,-0.027586f},{3.194057f,4.691257,-0.524566f},{3.090119f,5.116085,-0.23255f},{2.418965f,3.811753,-1.419399f},{2.191789f,3.877038,-1.47023f},{4.043166f,2.034188f,0.015477f},{-1.026966f,0.86766,-1.410912f},{1.937563f,3.860005,-1.617465f},{2.98904f,4.101806,-0.998132f},{-0.142611f,5.865305,-0.100872f},{3.972673f,2.292069f,0.089463f},{3.23349f,3.959925,-0.849829f},{0.16304f,5.857276,-0.216704f},{4.122964f,1.770061,-0.114906f},{2.099057f,4.978374,-0.98449f},{3.502411f,3.76181,-0.667502f},{2.079484f,5.939614,-0.036205f},{-0.084568f,3.525193,-2.253506f},{0.423859f,4.06095,-1.845327f},{1.6013f,6.006466,-0.153429f},{0.271701f,3.844964,-2.078748f},{0.273577f,5.218904,-0.994711f},{-0.410578f,3.92165,-1.773635f},{1.941954f,5.60041,-0.621569f},{0.100825f,5.462131,-0.774256f},{-0.53016f,3.619892,-2.027451f},{-0.822371f,5.517453,-0.605747f},{-2.474925f,7.670892,-0.020174f},{4.01571f,0.830194,-0.013793f},{-0.400092f,5.094112,-1.041992f},{-2.887284f,5.581246,-0.525324f},{-1.559841f,6.050972f,0.079301f},{-0.469317f,3.291673,-2.235211f},{0.337397f,3.467926,-2.295458f},{-2.632074f,5.573701,-0.582717f},{-0.030318f,6.011395f,0.276616f},{-0.934373f,0.388987,-1.780523f},{-2.661263f,5.844838,-0.425966f},{0.549353f,5.489646,-0.807268f},{-2.194355f,6.197491,-0.109322f},{-2.289618f,5.664813,-0.581098f},{1.583583f,3.796366,-1.844498f},{0.855295f,0.215979,-1.425557f},{-2.627569f,5.300236,-0.767174f},{4.333347f,2.384332f,0.399129f},{-1.880401f,5.583843,-0.696561f},{-2.172346f,5.324859,-0.846246f},{-2.27058f,5.906265,-0.388373f},{-1.960049f,5.889346,-0.397593f},{0.965756f,3.67547,-2.105671f},{-2.014066f,6.431125f,0.287254f},{-1.776173f,5.287097,-0.89091f},{-2.025852f,5.089562,-0.980218f},{-1.886418f,6.108358,-0.000667f},{-1.600803f,5.785347,-0.491069f},{-1.66188f,4.968053,-1.042535f},{-1.600621f,5.962818,-0.188044f},{-1.588831f,5.615418,-0.665456f},{4.46901f,1.880138f,0.057248f},{-1.978845f,0.927399,-0.554856f},{-1.408074f,5.325266,-0.83967f},{1.923123f,4.843955,-1.101389f},{-2.87378f,0.117106,-0.412735f},{-1.222193f,5.62638,-0.539981f},{-2.632537f,0.166349,-0.489218f},{-1.370865f,5.838832,-0.341026f},{-1.067742f,5.448874,-0.692701f},{-1.073798f,5.220878,-0.908779f},{-1.147562f,4.950417,-1.079727f},{-2.789115f,4.531047,-1.042713f},{-3.550826f,4.170487,-0.806058f},{-3.331694f,4.798177,-0.69568f},{-3.689404f,4.688543,-0.534317f},{-3.511509f,5.106246,-0.483632f},{1.796344f,0.076137f,0.080455f},{-3.306354f,5.473605,-0.478764f},{-2.692503f,3.346604,-1.20959f},{-3.963056f,5.187462f,3.113156f},{-3.901231f,6.391477,-0.246984f},{4.484234f,1.518638,-0.001617f},{4.308829f,1.657716,-0.119275f},{4.290045f,1.339528,-0.110626f},{-3.514938f,3.524974,-0.909109f},{-2.1943f,2.12163,-0.71966f},{4.108206f,1.091087,-0.11416f},{3.785312f,1.392435,-0.28588f},{4.092886f,1.480476,-0.210655f},{-2.965937f,6.469006,-0.379085f},{-3.708581f,2.962974,-0.63979f},{-3.297971f,2.218917,-0.299872f},{3.806949f,0.804703,-0.11438f},{3.747957f,1.059258,-0.273069f},{-3.101827f,4.111444,-1.006255f},{-1.536445f,4.658913,-1.195049f},{-3.549826f,2.450555,-0.375694f},{-3.676495f,2.108366f,0.534323f},{-3.674738f,5.925075,-0.400011f},{-2.250115f,2.848335,-1.121174f},{-3.698062f,5.667567,-0.381396f},{3.468966f,0.734643,-0.190624f},{-3.97972f,5.670078,-0.26874f},{-3.002087f,4.337837,-1.033421f},{-3.356392f,2.608308,-0.713323f},{-1.833016f,3.359983,-1.28775f},{-1.989069f,3.632416,-1.305607f},{3.591254f,0.542371f,0.026146f},{3.364927f,1.082572,-0.342613f},{-3.393759f,3.866801,-0.937266f},{-4.124865f,5.549529,-0.161729f},{-4.423423f,5.687223f,0.000103f},{-1.496881f,2.601785,-1.114328f},{-2.642297f,6.496932,-0.264175f},{-3.684236f,6.819423,-0.320233f},{-2.286996f,3.167067,-1.246651f},{-1.624896f,8.44848,-0.530014f},{-3.666787f,2.159266f,0.268149f},{-2.402625f,2.011243,-0.56446f},{-2.736166f,2.259839,-0.6943f},{-2.168611f,3.89078,-1.292206f},{-2.065956f,3.345708,-1.281346f},{-2.778147f,2.675605,-0.995706f},{-3.507431f,4.513272,-0.71829f},{-2.301184f,4.293911,-1.238182f},{3.205808f,0.211078f,0.394349f},{-2.129936f,4.870577,-1.080781f},{-2.287977f,2.496593,-0.934069f},{-2.701833f,2.931814,-1.114509f},{3.294795f,0.50631,-0.081062f},{-2.552829f,7.468771,-0.021541f},{3.06721f,0.944066,-0.43074f},{-2.86086f,1.973622,-0.303132f},{-3.598818f,5.419613,-0.401645f},{-1.524381f,0.080156,-1.61662f},{-1.907291f,2.646274,-1.039438f},{2.950783f,0.407562,-0.105407f},{-1.663048f,1.655038,-0.689787f},{-1.728102f,1.110064,-0.635963f},{-2.085823f,7.686296,-0.159745f},{2.883518f,3.157009,-1.30858f},{-2.724116f,0.417169,-0.389719f},{-1.788636f,7.862672,-0.346413f},{-2.186418f,1.249609,-0.434583f},{-3.092434f,2.606657,-0.860002f},{-1.737314f,3.874201,-1.330986f},{2.564522f,0.422967,-0.390903f},{1.670782f,3.538432,-1.924753f},{-2.338131f,4.02578,-1.286673f},{-1.916516f,4.054121,-1.301788f},{2.87159f,2.034949,-1.267139f},{-1.931518f,3.062883,-1.197227f},{-0.816602f,0.135682f,3.104104f},{0.469392f,0.213916,-1.489608f},{2.574055f,1.950091,-1.514427f},{2.733595f,2.682546,-1.461213f},{-1.915407f,4.693647,-1.151721f},{-3.412883f,5.867094,-0.450528f},{2.28822f,0.120432,-0.04102f},{2.244477f,0.14424,-0.376933f},{-1.676198f,3.570698,-1.328031f},{-1.821193f,4.366982,-1.266271f},{-1.552208f,8.099221,-0.53262f},{-1.727419f,2.39097,-0.989456f},{-2.468226f,4.711663,-1.069766f},{-2.451669f,6.113319,-0.273788f},{2.635447f,2.295842,-1.518361f},{-2.020809f,8.150253,-0.246714f},{2.292455f,0.805596,-1.3042f},{2.641556f,1.65665,-1.466962f},{2.409062f,2.842538,-1.635025f},{2.456682f,1.459484,-1.57543f},{-1.691047f,3.173582,-1.247082f},{-1.865642f,1.957608,-0.768683f},{-3.401579f,0.20407f,0.100932f},{2.301981f,1.7102,-1.650461f},{2.342929f,2.611944,-1.690713f},{-1.676111f,2.923894,-1.17835f},{-2.992039f,3.547631,-1.118945f},{-3.571677f,6.504634,-0.375455f},{2.141764f,1.460869,-1.702464f},{-3.221958f,5.146049,-0.615632f},{2.19238f,2.949367,-1.747242f},{2.320791f,2.232971,-1.706842f},{2.088678f,2.585235,-1.813159f},{-2.196404f,0.592218,-0.569709f},{-2.120811f,1.836483,-0.62338f},{-1.949935f,2.271249,-0.874128f},{2.235901f,1.110183,-1.510719f},{2.020157f,3.241128,-1.803917f},{2.054336f,1.949394,-1.792332f},{-3.094117f,4.996595,-0.740238f},{2.038063f,0.635949,-1.402041f},{1.980644f,1.684408,-1.76778f},{1.587432f,3.306542,-1.991131f},{1.935322f,0.976267,-1.602208f},{1.922621f,1.235522,-1.698813f},{1.712495f,1.911874,-1.903234f},{1.912802f,2.259273,-1.888698f},{1.884367f,0.355453,-1.312633f},{1.676427f,0.76283,-1.539455f},{1.78453f,2.83662,-1.943035f},{1.697312f,0.120281,-1.150324f},{1.648318f,2.484973,-1.999505f},{-4.051804f,5.958472,-0.231731f},{-1.964823f,1.464607,-0.58115f},{1.55996f,2.183486,-1.971378f},{1.628125f,1.045912,-1.707832f},{1.701684f,1.540428,-1.827156f},{1.567475f,4.869481,-1.184665f},{1.432492f,0.843779,-1.648083f},{1.173837f,2.978983,-2.156687f},{1.235287f,3.37975,-2.09515f},{1.252589f,1.525293,-1.949205f},{1.159334f,2.336379,-2.105361f},{1.49061f,2.695263,-2.083216f},{-4.122486f,6.782604,-0.02545f},{1.173388f,0.279193,-1.423418f},{1.505684f,0.380815,-1.414395f},{1.391423f,1.343031,-1.843557f},{1.263449f,2.73225,-2.144961f},{1.295858f,0.597122,-1.515628f},{1.245851f,3.729126,-1.993015f},{-2.761439f,6.23717,-0.365856f},{0.978887f,1.664888,-2.046633f},{1.219542f,0.982729,-1.785486f},{1.315915f,1.91748,-2.02788f},{-3.052746f,2.127222,-0.369082f},{0.977656f,1.36223,-1.944119f},{0.936122f,3.39447,-2.203007f},{-2.740036f,4.184702,-1.122849f},{0.853581f,2.864694,-2.260847f},{0.719569f,0.818762,-1.763618f},{0.839115f,1.159359,-1.907943f},{0.932069f,1.94559,-2.117962f},{0.579321f,3.326747,-2.299369f},{0.86324f,0.597822,-1.565106f},{0.574567f,1.158452,-1.943123f},{0.525138f,2.137252,-2.213867f},{0.779941f,2.342019,-2.206157f},{0.915255f,2.618102,-2.209041f},{0.526426f,3.02241,-2.321826f},{0.495431f,2.521396,-2.295905f},{0.80799f,3.156817,-2.286432f},{0.273556f,1.304936,-2.012509f},{0.664326f,1.530024,-2.048722f},{0.219173f,2.32907,-2.323212f},{0.405324f,0.695359,-1.704884f},{0.398827f,0.946649,-1.843899f},{0.345109f,1.608829,-2.100174f},{-2.356743f,0.062032,-0.4947f},{-3.001084f,0.27146f,2.560034f},{-2.064663f,0.303055,-0.697324f},{0.221271f,3.174023,-2.374399f},{0.195842f,0.437865,-1.621473f},{-0.385613f,0.297763f,1.960096f},{1.999609f,0.108928,-0.79125f},{0.351698f,9.227494,-1.57565f},{0.021477f,2.191913,-2.309353f},{0.246381f,2.836575,-2.356365f},{1.543281f,0.237539f,1.901906f},{0.031881f,9.147022,-1.454203f},{-0.001881f,1.648503,-2.108044f},{0.333423f,1.907088,-2.204533f},{0.044063f,2.634032,-2.368412f},{-0.028148f,3.053684,-2.390082f},{0.02413f,3.34297,-2.36544f},{-0.272645f,9.02879,-1.238685f},{-0.006348f,0.832044,-1.758222f},{-0.321105f,1.458754,-1.886313f},{-0.153948f,8.618809,-1.105353f},{-0.409303f,1.137783,-1.720556f},{-0.410054f,1.742789,-1.957989f},{-0.287905f,2.380404,-2.294509f},{-0.261375f,2.646629,-2.356322f},{-0.221986f,3.215303,-2.345844f},{-0.31608f,0.687581,-1.71901f},{-0.537705f,0.855802,-1.648585f},{-0.142834f,1.193053,-1.87371f},{-0.24371f,2.044435,-2.176958f},{-0.437999f,2.959748,-2.299698f},{-0.78895f,0.176226,-1.729046f},{-0.608509f,0.546932,-1.734032f},{-0.693698f,4.478782,-1.369372f},{-0.669153f,8.469645,-0.911149f},{-0.741857f,1.082705,-1.458474f},{-0.554059f,2.440325,-2.141785f},{2.09261f,0.153182f,2.57581f},{1.792547f,0.111794f,2.563777f},{1.855787f,0.189541f,2.835089f},{1.492601f,0.232246f,2.987681f},{-0.284918f,0.236687f,3.429738f},{2.604841f,0.11997f,1.01506f},{0.331271f,0.168113f,3.124031f},{0.280606f,0.308368f,2.495937f},{0.544591f,0.325711f,2.081274f},{0.193145f,0.19154,-0.977556f},{3.810099f,0.42324f,1.032202f},{3.54622f,0.379245f,1.392814f},{0.61402f,0.276328f,0.849356f},{-1.198628f,0.144953f,2.911457f},{4.17199f,0.68037f,1.391526f},{0.88279f,0.321339f,2.059129f},{1.93035f,0.109992f,2.054154f},{1.620331f,0.121986f,2.37203f},{2.374812f,0.10921f,1.734876f},{-0.031227f,0.294412f,2.593687f},{4.075018f,0.561914f,1.038065f},{-0.570366f,0.126583f,2.975558f},{0.950052f,0.318463f,1.804012f},{1.130034f,0.117125f,0.98385f},{2.123049f,0.08946f,1.665911f},{2.087572f,0.068621f,0.335013f},{2.927337f,0.167117f,0.289611f},{0.528876f,0.313434f,3.205969f},{1.174911f,0.162744f,1.328262f},{-4.88844f,5.59535f,1.661134f},{-4.709607f,5.165338f,1.324082f},{0.871199f,0.277021f,1.263831f},{-3.910877f,2.349318f,1.272269f},{1.56824f,0.118605f,2.768112f},{1.179176f,0.152617,-0.858003f},{1.634629f,0.247872f,2.128625f},{-4.627425f,5.126935f,1.617836f},{3.845542f,0.54907f,1.45601f},{2.654006f,0.165508f,1.637169f},{-0.678324f,0.26488f,1.974741f},{2.451139f,0.100377f,0.213768f},{0.633199f,0.286719f,0.403357f},{-0.533042f,0.2524f,1.373267f},{0.99317f,0.171106f,0.624966f},{-0.100063f,0.306466f,2.170225f},{1.245943f,0.092351f,0.661031f},{1.390414f,0.198996,-0.0864f},{-4.457265f,5.030531f,2.138242f},{2.89776f,0.146575f,1.297468f},{1.802703f,0.088824,-0.490405f},{1.055447f,0.309261f,2.392437f},{2.300436f,0.142429f,2.104254f},{2.33399f,0.187756f,2.416935f},{2.325183f,0.134349f,0.574063f},{2.410924f,0.370971f,2.637115f},{1.132924f,0.290511f,3.061f},{1.764028f,0.070212,-0.80535f},{2.156994f,0.397657f,2.844061f},{0.920711f,0.225527,-0.882456f},{-4.552135f,5.24096f,2.85514f},{0.210016f,0.309396f,2.064296f},{0.612067f,0.136815,-1.086002f},{3.150236f,0.426757f,1.802703f},{-0.24824f,0.282258f,1.470997f},{0.974269f,0.301311,-0.640898f},{-4.401413f,5.03966f,2.535553f},{0.644319f,0.274006,-0.817806f},{0.332922f,0.309077f,0.108474f},{3.610001f,0.317447f,0.689353f},{3.335681f,0.358195f,0.118477f},{0.623544f,0.318983,-0.4193f},{-0.11012f,0.307747f,1.831331f},{-0.407528f,0.291044f,2.282935f},{0.069783f,0.285095f,0.950289f},{0.970135f,0.310392,-0.283742f},{0.840564f,0.306898f,0.098854f},{-0.541827f,0.267753f,1.683795f},{-3.956082f,4.55713f,2.297164f},{-4.161036f,2.834481f,1.64183f},{-4.093952f,4.977551f,2.747747f},{2.661819f,0.261867f,1.926145f},{-3.749926f,2.161875f,0.895238f},{-2.497776f,1.3629f,0.791855f},{0.691482f,0.304968f,1.582939f},{-4.013193f,4.830963f,2.4769f},{-3.639585f,2.091265f,1.304415f},{-3.9767f,2.563053f,1.6284f},{-3.979915f,2.788616f,1.977977f},{0.388782f,0.312656f,1.709168f},{-3.40873f,1.877324f,0.851652f},{-3.671637f,5.136974f,3.170734f},{-3.12964f,1.852012f,0.157682f},{-3.629687f,4.852698f,2.686837f},{-3.196164f,1.793459f,0.452804f},{-3.746338f,2.31357f,1.648551f},{2.992192f,0.125251f,0.575976f},{-3.254051f,0.054431f,0.314152f},{-3.474644f,1.925288f,1.134116f},{-3.418372f,2.022882f,1.578901f},{-2.920955f,1.705403f,0.29842f},{-3.57229f,2.152022f,1.607572f},{-3.251259f,0.09013,-0.106174f},{-3.299952f,1.877781f,1.348623f},{-3.666819f,2.441459f,2.004838f},{-2.912646f,1.824748,-0.045348f},{-3.399511f,2.479484f,2.340393f},{-3.009754f,0.015286f,0.075567f},{-3.381443f,2.316937f,2.156923f},{-3.352801f,2.133341f,1.857366f},{-3.01788f,1.687685f,0.645867f},{-2.931857f,1.678712f,1.158472f},{-3.301008f,0.08836f,0.591001f},{1.358025f,0.19795f,1.599144f},{-2.999565f,1.845016f,1.618396f},{-2.767957f,0.028397,-0.196436f},{-2.93962f,2.078779f,2.140593f},{-3.346648f,2.674056f,2.518097f},{3.324322f,0.20822f,0.628605f},{3.091677f,0.137202f,0.9345f},{-2.881807f,0.009952f,0.318439f},{-2.764946f,1.786619f,1.693439f},{-2.905542f,1.932343f,1.900002f},{-3.140854f,2.271384f,2.274946f},{-2.88995f,2.487856f,2.574759f},{-2.367194,-0.000943,-0.15576f},{-3.050738f,0.068703f,0.742988f},{-2.759525f,1.55679f,0.877782f},{-3.151775f,2.48054f,2.482749f},{-2.578618,-0.002885f,0.165716f},{-2.651618f,1.877246f,1.981189f},{-2.933973f,0.133731f,1.631023f},{1.047628f,0.100284,-1.085248f},{-1.585123f,0.062083,-1.394896f},{-2.287917,-0.002671f,0.214434f},{-2.524899f,0.007481f,0.471788f},{-2.815492f,2.188198f,2.343294f},{-2.095142,-0.003149,-0.094574f},{-2.172686,-0.000133f,0.47963f},{-2.732704f,0.074306f,1.742079f},{-2.49653f,2.145668f,2.42691f},{-1.343683f,0.047721,-1.506391f},{-2.581185f,0.048703f,0.975528f},{-2.905101f,0.083158f,2.010052f},{-2.601514f,2.007801f,2.223089f},{-2.339464f,0.02634f,1.484304f},{-2.907873f,0.10367f,2.378149f},{-1.368796f,0.062516,-1.049125f},{-1.93244f,0.02443,-0.427603f},{-2.705081f,0.060513f,2.303802f},{3.372155f,0.206274f,0.892293f},{-1.761827f,0.093202,-1.037404f},{-1.700667f,0.0397,-0.614221f},{-1.872291f,0.011979,-0.135753f},{-1.929257f,0.074005f,0.728999f},{-2.520128f,0.049665f,1.99054f},{-2.699411f,0.10092f,2.603116f},{3.211701f,0.27302f,1.423357f},{-1.445362f,0.1371,-0.626491f},{2.921332f,0.259112f,1.645525f},{-0.993242f,0.058686,-1.408916f},{-0.944986f,0.157541,-1.097665f},{-2.154301f,0.032749f,1.882001f},{-2.108789f,1.988557f,2.442673f},{-1.015659f,0.25497,-0.416665f},{-1.898411f,0.015872f,0.16715f},{-1.585517f,0.027121f,0.453445f},{-2.311105f,0.061264f,2.327061f},{-2.637042f,0.152224f,2.832201f},{-2.087515f,2.292972f,2.617585f},{-0.750611f,0.056697,-1.504516f},{-0.472029f,0.075654,-1.360203f},{-0.710798f,0.139244,-1.183863f},{-0.97755f,0.26052,-0.831167f},{-0.655814f,0.260843,-0.880068f},{-0.897513f,0.275537,-0.133042f},{-2.049194f,0.084947f,2.455422f},{-0.177837f,0.076362,-1.449009f},{-0.553393f,0.279083,-0.59573f},{-1.788636f,0.06163f,2.231198f},{-0.34761f,0.255578,-0.999614f},{-1.398589f,0.036482f,0.65871f},{-1.133918f,0.05617f,0.69473f},{-1.43369f,0.058226f,1.977865f},{-2.505459f,1.492266f,1.19295f}};
-
-static const uint16_t bunny_cells[] = {2,1661,3,1676,7,6,712,1694,9,3,1674,1662,11,1672,0,1705,0,1,5,6,1674,4,5,1674,7,8,712,2,1662,10,1,10,1705,11,1690,1672,1705,11,0,5,1676,6,7,9,6,7,712,9,2,3,1662,3,4,1674,1,2,10,12,82,1837,1808,12,1799,1808,1799,1796,12,861,82,861,1808,13,1808,861,12,1799,12,1816,1680,14,1444,15,17,16,14,1678,1700,16,17,1679,15,1660,17,14,1084,1678,15,1708,18,15,18,1660,1680,1084,14,1680,15,1084,15,1680,1708,793,813,119,1076,793,119,1076,1836,22,23,19,20,21,1076,22,21,22,23,23,20,21,1076,119,1836,806,634,470,432,1349,806,251,42,125,809,1171,791,953,631,827,634,1210,1176,157,1832,1834,56,219,53,126,38,83,37,85,43,59,1151,1154,83,75,41,77,85,138,201,948,46,1362,36,37,452,775,885,1237,95,104,966,963,1262,85,77,43,36,85,37,1018,439,1019,41,225,481,85,83,127,93,83,41,935,972,962,116,93,100,98,82,813,41,75,225,298,751,54,1021,415,1018,77,138,128,766,823,1347,593,121,573,905,885,667,786,744,747,100,41,107,604,334,765,779,450,825,968,962,969,225,365,481,365,283,196,161,160,303,875,399,158,328,1817,954,62,61,1079,358,81,72,74,211,133,160,161,138,91,62,1079,167,56,1405,56,167,219,913,914,48,344,57,102,43,77,128,1075,97,1079,389,882,887,219,108,53,1242,859,120,604,840,618,754,87,762,197,36,1362,1439,88,1200,1652,304,89,81,44,940,445,463,151,717,520,92,129,116,100,1666,1811,624,1079,97,91,62,91,71,688,898,526,463,74,133,278,826,99,961,372,42,799,94,1007,100,93,41,1314,943,1301,184,230,109,875,1195,231,133,176,189,751,755,826,101,102,57,1198,513,117,748,518,97,1145,1484,1304,358,658,81,971,672,993,445,151,456,252,621,122,36,271,126,85,36,126,116,83,93,141,171,1747,1081,883,103,1398,1454,149,457,121,593,127,116,303,697,70,891,457,891,1652,1058,1668,112,518,130,97,214,319,131,185,1451,1449,463,133,516,1428,123,177,113,862,561,215,248,136,186,42,251,127,83,116,160,85,127,162,129,140,154,169,1080,169,170,1080,210,174,166,1529,1492,1524,450,875,231,399,875,450,171,141,170,113,1155,452,131,319,360,44,175,904,452,872,113,746,754,407,147,149,150,309,390,1148,53,186,283,757,158,797,303,129,162,429,303,162,154,168,169,673,164,193,38,271,75,320,288,1022,246,476,173,175,548,904,182,728,456,199,170,169,168,199,169,199,171,170,184,238,230,246,247,180,1496,1483,1467,147,150,148,828,472,445,53,108,186,56,53,271,186,961,42,1342,391,57,1664,157,1834,1070,204,178,178,204,179,285,215,295,692,55,360,192,193,286,359,673,209,586,195,653,121,89,573,202,171,199,238,515,311,174,210,240,174,105,166,717,276,595,1155,1149,452,1405,56,197,53,283,30,75,53,30,45,235,1651,210,166,490,181,193,192,185,620,217,26,798,759,1070,226,204,220,187,179,220,168,187,202,222,171,359,209,181,182,456,736,964,167,1405,76,250,414,807,1280,1833,70,883,1652,227,179,204,221,199,168,221,202,199,360,494,131,214,241,319,105,247,166,205,203,260,388,480,939,482,855,211,8,807,1833,226,255,204,228,221,168,166,173,490,701,369,702,211,855,262,631,920,630,1448,1147,1584,255,227,204,237,220,179,228,168,220,222,256,555,215,259,279,126,271,38,108,50,186,227,236,179,236,237,179,220,237,228,228,202,221,256,222,202,555,256,229,259,152,279,27,1296,31,186,50,961,961,234,372,1651,235,812,1572,1147,1448,255,226,1778,255,236,227,256,257,229,106,184,109,241,410,188,177,578,620,209,673,181,1136,1457,79,1507,245,718,255,273,236,275,410,241,206,851,250,1459,253,1595,1406,677,1650,228,274,202,202,281,256,348,239,496,205,172,203,369,248,702,261,550,218,261,465,550,574,243,566,921,900,1220,291,273,255,348,238,265,109,230,194,149,380,323,443,270,421,272,291,255,274,228,237,274,292,202,281,257,256,276,543,341,152,259,275,1111,831,249,632,556,364,299,273,291,299,236,273,280,237,236,202,292,281,247,246,173,282,49,66,1620,1233,1553,299,280,236,280,305,237,237,305,274,306,292,274,330,257,281,246,194,264,166,247,173,912,894,896,611,320,244,1154,1020,907,969,962,290,272,299,291,305,318,274,145,212,240,164,248,285,259,277,275,193,164,295,269,240,210,1033,288,320,46,948,206,336,280,299,330,281,292,257,307,300,369,136,248,145,240,269,502,84,465,193,295,286,164,285,295,282,302,49,161,303,429,318,306,274,306,330,292,315,257,330,315,307,257,307,352,300,300,352,308,275,277,403,353,1141,333,1420,425,47,611,313,320,85,126,83,128,1180,43,303,116,129,280,314,305,314,318,305,190,181,242,203,214,131,820,795,815,322,299,272,322,336,299,315,339,307,172,152,617,172,214,203,321,1033,320,1401,941,946,85,160,138,976,454,951,747,60,786,317,322,272,339,352,307,266,33,867,163,224,218,247,614,180,648,639,553,388,172,205,611,345,313,313,345,320,160,127,303,454,672,951,317,329,322,314,280,336,306,338,330,330,339,315,1236,115,436,342,321,320,1046,355,328,328,346,325,325,346,317,367,314,336,314,337,318,337,306,318,338,343,330,342,320,345,355,349,328,346,329,317,347,336,322,314,362,337,330,343,339,340,308,352,135,906,1022,239,156,491,194,230,486,40,1015,1003,321,355,1046,329,382,322,382,347,322,347,367,336,337,371,306,306,371,338,1681,296,1493,286,172,388,230,348,486,348,183,486,384,332,830,328,349,346,367,362,314,371,343,338,339,351,352,57,344,78,342,355,321,386,346,349,386,350,346,346,350,329,347,366,367,343,363,339,323,380,324,152,275,241,345,1045,342,350,374,329,339,363,351,234,340,352,353,361,354,40,34,1015,373,355,342,373,349,355,374,382,329,366,347,382,371,363,343,351,379,352,379,372,352,372,234,352,156,190,491,319,241,692,354,361,31,366,377,367,363,379,351,133,590,516,197,56,271,1045,370,342,370,373,342,374,350,386,377,366,382,367,395,362,400,337,362,400,371,337,378,363,371,106,109,614,181,673,193,953,920,631,376,349,373,376,386,349,378,379,363,224,375,218,279,152,172,361,619,381,1347,823,795,760,857,384,392,374,386,394,395,367,383,371,400,383,378,371,218,375,261,197,271,36,414,454,976,385,376,373,1051,382,374,387,394,367,377,387,367,395,400,362,279,172,295,30,365,225,450,231,825,385,373,370,398,374,392,1051,377,382,396,378,383,348,496,183,295,172,286,357,269,495,1148,390,1411,75,30,225,206,76,54,412,386,376,412,392,386,396,383,400,651,114,878,123,1241,506,238,311,265,381,653,29,618,815,334,427,1032,411,298,414,976,791,332,384,129,100,140,412,404,392,392,404,398,140,107,360,395,394,400,423,379,378,385,412,376,406,94,58,419,415,1021,422,423,378,423,125,379,258,508,238,311,156,265,213,287,491,449,411,1024,412,1068,404,55,140,360,76,414,54,394,416,400,400,416,396,422,378,396,1258,796,789,427,411,449,427,297,1032,1385,1366,483,417,448,284,1507,341,245,162,140,444,658,44,81,433,125,423,438,251,125,429,162,439,1342,57,1348,765,766,442,697,891,695,1057,396,416,440,423,422,440,433,423,433,438,125,438,196,251,74,482,211,1136,79,144,29,195,424,242,1004,492,57,757,28,414,298,54,238,348,230,224,163,124,295,215,279,495,269,490,449,446,427,446,297,427,1020,1163,909,128,138,419,66,980,443,415,439,1018,111,396,1057,111,422,396,840,249,831,593,664,596,218,550,155,109,194,180,483,268,855,161,415,419,1737,232,428,360,107,494,1006,1011,410,444,140,55,919,843,430,190,242,213,275,403,410,131,494,488,449,663,446,138,161,419,128,419,34,439,162,444,460,440,422,440,438,433,472,74,445,491,190,213,238,508,515,46,206,54,972,944,962,1241,1428,1284,111,460,422,470,432,806,248,164,702,1025,467,453,553,1235,648,263,114,881,267,293,896,469,438,440,455,196,438,287,242,492,239,265,156,213,242,287,1684,746,63,663,474,446,415,161,429,140,100,107,1055,459,467,469,455,438,259,542,277,446,474,466,446,466,447,439,444,1019,614,109,180,190,359,181,156,497,190,726,474,663,1023,458,459,461,440,460,269,210,490,246,180,194,590,133,189,163,218,155,467,468,453,1063,1029,111,111,1029,460,1029,464,460,461,469,440,150,149,323,828,445,456,375,502,261,474,475,466,573,426,462,478,1023,477,478,458,1023,458,479,467,459,458,467,468,393,453,464,461,460,484,365,455,1232,182,1380,172,617,214,547,694,277,542,547,277,184,258,238,261,502,465,467,479,468,484,455,469,1380,182,864,475,476,466,80,447,476,466,476,447,415,429,439,479,487,468,487,287,468,492,393,468,260,469,461,481,365,484,531,473,931,692,360,319,726,495,474,468,287,492,480,464,1029,260,461,464,494,481,484,74,472,482,174,240,212,223,106,614,486,477,485,478,496,458,491,487,479,123,402,177,488,469,260,488,484,469,265,239,348,248,215,285,474,490,475,477,486,478,458,496,479,239,491,479,1584,1147,1334,488,494,484,401,123,506,495,490,474,490,173,475,80,476,264,491,287,487,480,1029,1004,480,205,464,173,476,475,485,194,486,486,183,478,478,183,496,496,239,479,848,1166,60,268,262,855,205,260,464,260,203,488,203,131,488,246,264,476,194,485,264,1002,310,1664,311,515,497,515,359,497,565,359,515,1250,1236,301,736,456,151,654,174,567,577,534,648,519,505,645,725,565,508,150,1723,148,584,502,505,584,526,502,502,526,84,607,191,682,560,499,660,607,517,191,1038,711,124,951,672,971,716,507,356,868,513,1198,615,794,608,682,191,174,1313,928,1211,617,241,214,511,71,91,408,800,792,192,286,525,80,485,447,91,97,130,1675,324,888,207,756,532,582,1097,1124,311,497,156,510,130,146,523,511,510,608,708,616,546,690,650,511,527,358,536,146,518,465,418,550,418,709,735,520,514,500,584,505,519,536,518,509,146,536,510,538,527,511,876,263,669,646,524,605,510,536,523,527,175,358,724,876,669,721,724,674,524,683,834,558,509,522,558,536,509,523,538,511,611,243,574,528,706,556,668,541,498,523,537,538,527,540,175,532,756,533,1013,60,747,551,698,699,92,520,500,535,536,558,536,569,523,538,540,527,539,548,175,567,212,145,401,896,293,534,675,639,1510,595,1507,557,545,530,569,536,535,537,540,538,540,539,175,569,537,523,1135,718,47,587,681,626,580,535,558,99,747,278,701,565,725,665,132,514,665,514,575,132,549,653,176,651,189,65,47,266,597,569,535,569,581,537,537,581,540,563,539,540,539,564,548,1509,1233,1434,132,653,740,550,710,155,714,721,644,410,1011,188,732,534,586,560,562,729,555,557,222,580,558,545,597,535,580,581,563,540,5,821,1676,576,215,136,649,457,741,564,539,563,124,711,224,550,668,710,550,541,668,565,701,673,560,613,499,233,532,625,545,555,580,601,581,569,594,904,548,1463,1425,434,185,149,1454,721,674,644,185,380,149,577,424,586,462,586,559,597,601,569,594,548,564,566,603,574,165,543,544,457,89,121,586,424,195,725,587,606,1078,582,1124,588,925,866,462,559,593,189,878,590,555,229,580,602,563,581,904,594,956,434,1425,1438,1024,112,821,572,587,626,600,597,580,599,591,656,600,580,229,601,622,581,581,622,602,602,564,563,602,594,564,603,611,574,498,529,546,697,1145,70,592,628,626,610,597,600,597,610,601,222,557,171,604,765,799,573,462,593,133,200,176,729,607,627,1011,692,188,518,146,130,585,687,609,682,627,607,1712,599,656,562,592,607,643,656,654,257,600,229,601,633,622,623,594,602,174,212,567,725,606,701,609,701,606,610,633,601,633,642,622,380,216,324,142,143,1249,501,732,586,534,577,586,648,1235,577,610,641,633,310,1002,1831,618,334,604,1710,145,269,707,498,659,501,586,462,625,501,462,726,663,691,300,600,257,641,610,600,622,629,602,602,629,623,55,692,444,518,748,509,929,1515,1411,620,578,267,71,511,358,707,668,498,650,687,585,600,300,641,641,657,633,1675,888,1669,622,636,629,505,502,375,541,529,498,332,420,1053,637,551,638,534,639,648,69,623,873,300,512,641,633,657,642,562,660,579,687,637,638,709,646,605,775,738,885,559,549,132,646,683,524,641,512,657,266,897,949,1712,643,1657,184,727,258,674,724,669,699,714,647,628,659,572,657,662,642,571,881,651,517,607,504,598,706,528,598,694,547,640,552,560,655,693,698,698,693,721,91,510,511,144,301,1136,324,216,888,870,764,1681,575,514,520,276,544,543,658,175,44,645,505,711,659,546,572,700,524,655,605,700,529,266,867,897,1695,1526,764,579,659,628,654,591,682,586,549,559,698,721,714,896,401,506,640,734,599,664,665,575,621,629,636,1712,656,643,547,644,598,710,668,707,640,560,734,655,698,551,694,528,277,512,662,657,504,592,626,688,584,519,152,241,617,587,725,681,598,669,706,526,670,84,598,528,694,710,707,499,579,592,562,660,659,579,323,324,1134,326,895,473,195,29,653,84,670,915,560,660,562,504,626,681,711,505,224,651,881,114,216,620,889,1362,678,197,493,99,48,1659,691,680,529,690,546,430,843,709,655,524,693,174,191,105,674,669,598,98,712,82,572,546,585,72,61,71,912,911,894,106,223,184,664,132,665,843,646,709,635,699,136,699,698,714,593,132,664,688,526,584,185,177,620,533,675,534,687,638,635,1652,89,457,896,506,912,132,740,514,689,685,282,691,449,680,48,436,493,136,699,647,739,640,554,549,586,653,532,533,625,1530,695,649,653,381,619,736,151,531,188,692,241,177,402,578,33,689,867,689,33,685,593,559,132,949,65,266,711,1038,661,939,480,1004,609,369,701,616,552,615,619,361,740,151,463,516,513,521,117,691,663,449,186,251,196,333,302,327,613,560,552,616,613,552,690,551,637,660,707,659,704,208,1203,418,735,550,163,708,124,524,834,693,554,640,599,245,341,165,565,673,359,155,710,708,105,191,517,1515,198,1411,1709,554,599,60,289,786,838,1295,1399,533,534,625,710,499,708,556,632,410,217,620,216,591,627,682,504,503,223,643,654,567,690,637,650,545,557,555,174,654,682,719,691,1659,727,681,508,645,711,661,794,615,739,565,515,508,282,685,302,1150,397,1149,638,699,635,544,685,33,719,726,691,1742,1126,1733,1724,1475,148,556,410,403,185,217,380,503,504,681,277,556,403,32,1178,158,1712,1709,599,605,529,541,635,136,369,687,635,369,529,700,690,700,551,690,89,304,573,625,534,732,730,302,685,503,681,727,702,673,701,730,327,302,327,353,333,596,664,575,660,499,707,585,546,650,560,729,734,700,655,551,176,571,651,517,504,223,730,685,544,1661,1682,726,1682,495,726,1250,301,917,605,524,700,609,687,369,516,389,895,1553,686,1027,673,702,164,656,591,654,520,596,575,402,123,401,828,456,728,1645,677,1653,528,556,277,638,551,699,190,497,359,276,730,544,1117,1525,933,1027,686,1306,155,708,163,709,605,541,647,644,547,650,637,687,599,734,591,578,293,267,1682,357,495,510,91,130,734,729,627,576,542,215,709,541,735,735,541,550,276,500,730,500,327,730,653,619,740,414,851,454,734,627,591,729,562,607,615,552,640,525,181,192,308,512,300,223,503,727,266,165,33,92,500,276,321,1046,1033,585,609,606,1200,1559,86,628,572,626,301,436,803,714,644,647,708,499,613,721,693,724,514,353,327,353,740,361,344,158,78,708,613,616,615,640,739,500,514,327,514,740,353,1449,177,185,462,233,625,851,405,1163,608,616,615,647,542,576,625,732,501,1097,582,1311,1235,424,577,579,628,592,607,592,504,24,432,470,105,614,247,104,742,471,542,259,215,365,196,455,1420,47,65,223,727,184,547,542,647,572,585,606,587,572,606,262,780,1370,647,576,136,644,674,598,271,53,75,727,508,258,471,742,142,505,375,224,357,1710,269,725,508,681,659,498,546,743,1178,32,1195,634,231,1176,24,470,743,1110,1178,135,809,857,63,746,407,634,1176,470,159,1112,27,1176,1685,24,399,450,779,1178,856,875,751,744,54,436,48,772,634,1108,1210,769,1285,1286,751,298,755,746,1684,754,754,924,87,722,1625,756,87,839,153,489,795,820,758,808,1518,839,840,153,831,1111,959,1111,749,959,810,1253,1363,1247,1394,713,1388,1329,1201,1242,120,761,857,791,384,758,1523,808,296,764,1504,70,1652,891,207,233,1638,1348,57,28,858,420,332,964,1379,1278,420,1194,816,784,1076,1186,1076,21,1186,1710,767,1,849,822,778,806,137,787,786,790,744,790,54,744,771,63,407,785,852,818,774,1823,272,895,151,516,135,1022,809,99,826,48,48,826,755,808,705,408,833,441,716,1733,743,32,1385,836,852,772,827,737,1005,49,781,793,1697,813,1518,441,1537,1139,1132,859,782,801,770,1510,1530,676,770,814,835,231,787,825,207,722,756,26,771,798,782,863,865,832,54,790,865,842,507,799,765,94,1175,1261,1353,800,408,805,262,986,200,792,800,814,801,792,770,704,1203,1148,356,1514,822,165,544,33,561,776,113,1043,738,775,815,831,820,773,792,801,772,48,914,772,737,803,436,772,803,808,817,705,1624,822,1527,588,1144,788,799,762,604,821,1520,1676,854,803,666,828,482,472,445,74,463,831,489,820,828,836,482,716,782,763,334,815,766,815,823,766,334,766,765,819,805,837,1716,1521,1412,1684,924,754,800,805,819,1709,829,554,806,1349,137,99,1013,747,341,595,276,817,810,818,1176,1691,1685,763,782,865,830,846,1052,865,1499,842,982,846,1053,847,832,790,1178,875,158,817,818,705,1302,1392,45,96,417,284,223,614,517,356,507,1514,1166,848,1179,1349,432,26,717,92,276,770,835,863,522,509,1745,847,841,832,832,841,46,829,739,554,802,824,39,397,1043,775,1567,849,778,1385,483,855,1349,26,1346,441,801,782,402,401,293,1043,667,738,759,798,1007,819,837,728,728,837,828,837,852,828,1537,441,833,148,1475,147,805,705,837,716,441,782,483,1371,780,814,819,844,845,753,1336,1661,719,4,862,847,790,737,827,666,201,46,841,810,785,818,408,705,805,1560,1536,849,1585,853,1786,7,1668,807,7,807,8,822,1514,1527,800,819,814,847,862,841,991,857,760,705,818,837,808,408,773,402,293,578,791,858,332,1480,1228,1240,814,844,835,785,1385,852,1132,120,859,1743,1726,684,1704,783,1279,1623,1694,1731,959,489,831,1518,808,773,862,872,841,441,773,801,331,512,308,380,217,216,841,872,201,818,852,837,448,1480,1240,856,1108,1195,1527,1514,1526,819,182,1232,871,724,693,852,836,828,770,792,814,803,737,666,751,826,278,1674,1727,1699,849,356,822,871,693,834,507,842,1514,1406,1097,869,1328,1349,1346,823,815,795,744,751,278,1110,856,1178,520,717,316,871,834,683,884,876,724,165,266,47,716,763,507,216,889,888,853,1585,1570,1536,716,356,886,873,623,782,770,863,432,24,26,683,882,871,884,724,871,114,876,884,516,590,389,11,1218,1628,862,113,872,886,623,629,830,1052,1120,762,153,604,773,408,792,763,865,507,153,840,604,882,884,871,531,151,326,886,890,873,133,262,200,819,1232,844,621,636,122,645,892,519,1130,1076,784,114,263,876,1670,10,1663,911,670,894,452,885,872,872,885,201,887,882,683,878,884,882,590,878,882,890,867,689,897,629,621,897,886,629,819,728,182,519,893,688,894,670,526,898,894,526,1536,356,849,810,1363,785,878,114,884,879,888,892,892,889,893,893,898,688,895,683,843,895,887,683,889,620,267,590,882,389,418,465,84,949,897,621,897,890,886,889,267,893,898,267,896,531,326,473,189,651,878,843,683,646,897,867,890,888,889,892,893,267,898,896,894,898,473,895,843,895,389,887,974,706,669,513,1115,521,326,151,895,809,791,857,211,262,133,920,923,947,923,90,947,90,25,947,25,972,935,64,431,899,52,899,901,903,905,59,437,967,73,839,1242,761,904,975,44,917,301,144,915,670,911,905,201,885,1684,63,1685,1033,1194,288,950,913,755,912,918,911,950,914,913,506,918,912,922,919,915,911,922,915,1004,451,492,1263,553,639,922,911,918,630,920,947,916,506,926,916,918,506,521,1115,1098,916,922,918,919,418,915,83,38,75,24,1685,771,110,1230,1213,712,8,1837,922,930,919,919,430,418,1395,1402,1187,930,922,916,594,623,69,35,431,968,35,968,969,866,924,1684,1625,1263,675,631,630,52,930,931,919,430,709,418,302,333,49,1446,978,1138,799,1007,798,931,843,919,947,25,64,885,738,667,1262,963,964,899,970,901,1401,946,938,1117,933,1091,1685,63,771,905,948,201,979,937,980,951,953,950,937,270,443,1154,903,59,1194,954,1067,909,405,907,850,1151,59,1769,811,1432,76,206,250,938,946,966,965,927,942,938,966,957,955,975,904,927,965,934,52,51,631,59,905,667,431,935,968,786,289,561,252,122,671,481,494,107,954,1817,1067,795,25,90,958,965,945,795,972,25,902,983,955,972,489,944,1256,29,424,671,331,945,946,958,963,956,955,904,902,955,956,671,512,331,945,331,961,662,671,122,671,662,512,934,65,927,630,947,52,666,631,910,850,59,667,961,331,234,1024,411,1042,890,69,873,252,671,945,975,290,940,283,186,196,30,283,365,950,755,298,946,965,958,985,290,975,969,290,985,405,851,206,935,431,64,941,1423,1420,964,963,167,942,252,945,78,757,57,49,1005,66,937,979,270,631,666,827,980,937,443,66,689,282,421,902,956,947,64,52,35,979,899,951,971,953,762,87,153,27,31,381,924,839,87,946,963,966,331,308,340,957,966,1262,473,843,931,953,971,920,270,969,902,935,962,968,51,1005,781,969,983,902,437,73,940,69,421,956,761,249,840,263,974,669,962,944,967,962,437,290,985,975,955,907,405,948,720,957,1262,25,935,64,176,200,571,108,945,50,250,851,414,200,986,571,881,974,263,827,772,953,970,899,980,29,159,27,234,331,340,948,405,206,980,899,979,986,984,571,571,984,881,990,706,974,946,934,965,970,980,66,1113,1486,1554,984,981,881,881,987,974,689,66,443,1005,901,66,983,985,955,165,47,718,987,990,974,1370,986,262,901,970,66,51,901,1005,981,987,881,988,706,990,942,945,965,290,437,940,64,899,52,988,556,706,941,934,946,431,35,899,996,989,984,984,989,981,981,989,987,35,969,270,1370,995,986,986,995,984,989,999,987,987,992,990,992,988,990,962,967,437,951,950,976,979,35,270,421,270,902,998,995,1370,987,999,992,988,364,556,969,985,983,689,443,890,995,1000,984,219,958,108,998,1000,995,999,997,992,914,953,772,845,1336,745,806,787,231,1000,996,984,989,996,999,50,945,961,443,421,69,797,158,779,1098,1463,434,996,1009,999,1001,988,992,1001,364,988,903,907,905,26,759,973,997,1001,992,632,364,1001,1346,26,973,998,1008,1000,1000,1009,996,531,931,736,252,949,621,286,388,525,1174,1008,998,1009,1010,999,999,1010,997,1014,1001,997,614,105,517,958,945,108,525,1004,242,963,958,219,233,426,304,1000,1008,1009,1010,1014,997,1001,1006,632,824,413,39,642,636,622,480,388,205,28,757,797,1014,1006,1001,1006,410,632,975,940,44,1234,420,858,54,832,46,1009,1012,1010,167,963,219,41,481,107,1017,1010,1012,122,636,662,939,525,388,525,939,1004,950,953,914,829,1735,739,1008,880,1015,1008,1015,1009,1263,639,675,956,594,69,795,90,1347,1179,848,1013,759,1007,973,1009,1015,1012,1012,1016,1017,1017,1014,1010,1019,1011,1006,927,65,949,649,316,595,913,48,755,976,950,298,1003,1015,880,1018,1006,1014,1021,1018,1014,444,692,1011,451,1029,1063,1185,851,1163,29,27,381,181,525,242,1021,1014,1017,1016,1021,1017,1018,1019,1006,1019,444,1011,927,949,942,451,393,492,903,1154,907,391,101,57,94,765,58,419,1016,1012,949,252,942,907,1020,909,765,442,58,94,406,908,1007,94,908,34,1012,1015,34,419,1012,419,1021,1016,451,1057,393,907,948,905,1034,1073,1039,1061,906,1619,1068,960,1034,471,1249,104,112,1024,1042,372,379,125,341,543,165,141,1094,170,566,243,1061,398,1034,1039,325,317,1823,1493,296,1724,850,667,1043,1054,297,1065,1619,135,1074,1061,243,906,680,1024,821,1103,96,1245,1440,1123,1491,1047,1025,1044,672,454,1231,1484,697,1530,993,672,1231,178,154,1088,1044,1041,1066,112,1062,1058,1530,649,676,178,1088,1040,1046,328,954,243,244,1022,954,1194,1033,1042,411,1032,971,993,1056,960,1093,1034,1754,1338,232,385,1064,412,1057,1063,111,748,1071,1447,1530,697,695,971,1056,1270,977,1059,1211,649,741,316,1060,1452,1030,353,354,1323,695,768,649,398,404,1034,596,316,741,1836,119,13,1513,1115,1528,883,1081,1652,1039,1073,1048,462,426,233,31,1296,354,1055,1047,1066,1032,1054,1045,1521,310,1224,119,861,13,1194,1234,288,1109,1771,1070,1166,1160,776,1044,1035,1041,1026,960,1064,1050,1032,1045,1049,1041,387,115,1013,99,1046,954,1033,1321,920,971,611,1058,345,1048,1066,1049,1023,1055,1073,1029,451,1004,118,1094,141,1094,1080,170,1042,1032,1050,1026,1064,385,15,16,1084,1096,1079,61,1075,1071,748,325,1817,328,909,1163,405,1022,1234,809,374,398,1051,1082,72,81,1023,1034,1093,1817,1794,1067,86,1445,1400,1507,1535,1510,1079,1096,1075,568,1478,1104,1070,178,1040,1034,1023,1073,776,1155,113,1103,143,142,1140,81,73,1082,81,1140,1060,1030,936,1040,1086,1109,370,1065,385,61,72,1082,1087,1096,1144,1040,1088,1086,1651,812,752,1062,1050,1045,187,154,178,179,187,178,1099,1344,1101,1668,1058,807,1073,1055,1048,1099,1336,1344,1283,943,1123,1049,387,1051,1024,680,449,61,1082,1100,967,749,1111,1439,1037,88,742,1505,142,398,1039,1051,1107,1336,1099,1344,1542,1101,142,1505,1103,477,1093,447,477,1023,1093,471,142,1249,1041,1035,394,1328,568,1104,61,1100,1096,154,1092,1088,112,1042,1050,154,187,168,435,235,45,1075,1096,1087,97,1075,748,1049,1066,1041,816,1067,1028,846,982,1142,1245,96,284,1092,154,1080,1057,451,1063,387,377,1051,1055,1025,1047,1075,1087,1089,1106,1108,856,1068,1034,404,1480,1545,868,906,135,1619,1074,991,1095,570,566,1061,1025,453,1044,745,1336,1107,1035,1057,416,1092,1102,1129,1074,135,991,1105,745,1107,447,1026,446,394,387,1041,73,81,940,1118,1108,1106,1210,1108,874,243,1022,906,412,1064,1068,1280,611,603,960,447,1093,1051,1039,1049,1040,1109,1070,1471,1037,1439,69,890,443,1377,703,1374,1092,1080,1102,1096,1100,788,1096,788,1144,1114,967,1111,446,1026,297,70,1112,883,453,393,1057,1118,874,1108,1054,370,1045,1080,1094,1102,1039,1048,1049,428,753,845,1047,1044,1066,1044,453,1035,1472,731,1512,1126,1121,743,743,1121,1110,1032,297,1054,1480,868,1216,71,358,72,1133,967,1114,1105,1119,745,1035,453,1057,1026,447,960,454,851,1190,1030,1477,652,589,816,1028,1110,1121,1106,1122,1118,1106,1116,874,1118,1048,1055,1066,1194,1067,816,744,278,747,745,1120,845,845,1052,428,1105,1780,1119,1065,297,385,1098,1529,1463,731,1060,936,235,434,812,1445,1525,1117,1106,1121,1122,1122,1127,1118,1127,1116,1118,1094,118,1732,1119,1120,745,1406,1124,1097,435,117,235,1462,1440,1037,1126,1129,1121,1088,1092,1129,1133,73,967,1120,1052,845,812,434,752,1441,1559,1200,1131,588,413,1054,1065,370,235,1098,434,1052,1142,428,1737,428,1142,1496,1446,1483,1182,1083,1654,1121,1129,1122,1732,1116,1127,768,457,649,761,1114,249,1064,960,1068,1135,1481,1136,1126,952,1129,1087,588,1131,1087,1144,588,859,788,1139,1140,1133,1132,1133,1140,73,1822,570,1061,394,1035,416,1055,1023,459,80,264,485,1119,1128,1120,145,1658,567,695,891,768,1129,1102,1122,1122,1102,1127,1416,1077,1413,297,1026,385,1052,846,1142,1445,1117,1400,952,1086,1129,1714,1089,1131,1131,1089,1087,1100,1139,788,112,1050,1062,1323,354,1296,49,333,1141,1142,982,1737,79,1457,1091,1088,1129,1086,1102,1094,1127,1127,1094,1732,1100,1082,1139,1082,1132,1139,1082,1140,1132,1150,1043,397,60,1166,289,1696,1146,1698,1297,1202,1313,409,1297,1313,1234,1194,420,1408,1391,1394,424,1235,1243,1203,309,1148,485,477,447,1152,1156,850,1153,1149,1155,1153,1157,1149,1149,1152,1150,1156,1154,1151,776,1153,1155,1157,1152,1149,1217,1393,1208,1156,1159,1154,1153,1165,1157,1165,1152,1157,1159,1020,1154,1161,1153,776,1161,1165,1153,1165,1158,1152,1152,1158,1156,1158,1159,1156,1166,776,561,1160,1161,776,1161,1164,1165,1161,1160,1164,1158,1162,1159,1159,1162,1020,1270,1321,971,1164,1170,1165,1165,1162,1158,1162,1163,1020,588,788,925,1166,1167,1160,1165,1170,1162,1160,1167,1164,1162,1170,1163,1179,1167,1166,1167,1168,1164,1164,1168,1170,1168,1169,1170,1234,1022,288,802,39,866,1179,1168,1167,1169,1173,1170,1170,1173,1163,1173,1185,1163,1360,1267,1364,1169,1185,1173,611,244,243,900,1226,1376,1260,1408,1350,618,840,831,1181,1183,1179,1179,1184,1168,1208,1274,1291,1183,1184,1179,1168,1184,1169,1387,1395,1254,1208,1204,1172,1182,1197,1083,1187,1083,1197,1213,1183,1181,1169,1207,1185,135,857,991,1013,1213,1181,1189,1183,1213,1183,1189,1184,1169,1184,1207,1207,1190,1185,1180,1389,1288,1191,1192,1640,1640,1192,1090,1090,1205,1654,1654,1205,1182,1188,1395,1187,1126,743,1733,788,859,925,809,1234,1171,1193,1197,1182,1189,1199,1184,1639,1191,1637,1639,1212,1191,1205,1193,1182,1198,1187,1197,1199,1207,1184,332,1053,846,1090,1192,1205,117,1188,1187,435,1188,117,435,1206,1188,1199,1189,1213,420,816,1053,1212,1215,1191,117,1187,1198,45,1206,435,120,1132,1133,874,1116,1210,1191,1215,1192,1193,1216,1197,1216,1198,1197,1199,1214,1207,117,521,235,1220,1311,1078,1220,900,1311,1653,1215,1212,1192,1225,1205,1205,1209,1193,1209,1216,1193,1389,1217,1172,1207,1214,454,171,557,1747,1805,1078,1787,1805,1219,1078,1198,1216,868,666,910,854,1230,1231,1213,1213,1231,1199,1199,1231,1214,1219,1220,1078,1215,1221,1192,1192,1221,1225,1225,1228,1205,1205,1228,1209,1209,1228,1216,1464,1325,1223,1215,1227,1221,1228,1480,1216,1226,1653,1376,1653,1249,1215,1221,1240,1225,1225,1240,1228,839,761,840,1238,1219,1805,1238,1220,1219,1232,1380,1375,1226,1249,1653,1221,1227,1240,233,207,532,110,1236,1230,1248,1231,1230,1231,454,1214,1249,1227,1215,1248,1056,1231,489,959,944,448,1240,284,925,859,1242,1805,1244,1238,1252,1220,1238,1252,921,1220,1236,1251,1230,1230,1251,1248,1056,993,1231,1031,1264,1263,68,1186,157,1227,1245,1240,1103,1245,143,1243,1235,612,1252,95,921,1249,1226,1237,1390,1387,1254,1120,384,830,830,332,846,1227,143,1245,1315,1369,1358,1356,1269,1386,972,795,489,1831,1224,310,1250,1255,1251,1251,1056,1248,1256,1243,103,658,358,175,1620,1238,1244,1620,1252,1238,1506,95,1252,104,1249,1237,1249,143,1227,1268,1419,1329,634,806,231,618,831,815,924,1242,839,1255,1270,1251,1251,1270,1056,866,925,1242,103,29,1256,424,1243,1256,134,1651,752,1250,917,1255,1172,1204,1260,1352,1036,1276,1265,1201,1329,804,1282,1259,1259,1294,723,335,1330,1305,407,762,799,875,856,1195,32,158,344,967,944,749,372,125,42,1175,1354,1261,553,612,1235,1259,1273,1294,1294,1283,723,757,78,158,407,799,798,901,51,52,139,1386,1389,1386,1269,1389,1389,1269,1217,1148,1590,1268,1428,1449,1450,804,1281,1282,1273,1259,1282,158,399,779,771,407,798,521,1098,235,917,1312,1255,1312,1270,1255,1217,1269,1393,1195,1108,634,1110,1106,856,1210,1691,1176,27,1112,1145,1296,27,1145,1171,858,791,704,1148,1290,1430,1436,1437,1282,1308,1273,1300,943,1283,1393,1355,1274,720,1278,769,1287,1059,1399,1310,1388,1272,1312,1321,1270,851,1185,1190,1296,1145,1304,26,24,771,51,910,631,1329,1290,1268,1290,1148,1268,1298,1293,733,1281,1293,1282,1282,1293,1308,1308,1299,1273,1300,1283,1294,1340,943,1300,1340,1301,943,407,754,762,1287,1399,1295,34,139,128,1288,1172,1260,120,1133,1114,1306,1113,1511,1464,1223,1292,1299,1294,1273,1299,1300,1294,1286,1295,838,1285,1247,1286,1247,713,1286,1201,1265,1390,1378,1368,1357,1482,1320,917,917,1320,1312,850,1156,1151,588,39,413,1324,1306,686,789,1365,928,1223,1326,1292,1292,1326,1298,869,1097,1311,790,786,561,1323,1304,932,1323,1296,1304,1317,1324,686,1306,368,1113,1325,1342,1223,1326,1348,1298,1293,1327,1308,1308,1318,1299,704,1290,1258,1320,1321,1312,761,120,1114,1684,802,866,1674,6,1727,1316,1323,932,1335,1337,1305,1348,1327,1293,1298,1348,1293,1333,1300,1299,1333,1343,1300,1328,1301,1340,1328,1314,1301,838,1399,1319,921,1237,900,409,1391,1408,1376,1653,677,1281,804,1458,1331,1324,1317,1324,368,1306,368,1338,1307,1327,797,1308,797,1345,1308,1308,1345,1318,1318,1333,1299,1341,1147,1572,923,1321,1320,923,920,1321,39,588,866,1141,1323,1316,1330,1335,1305,1337,1335,1336,1339,1332,1325,1223,1342,1326,1342,1348,1326,1348,797,1327,1345,1333,1318,1343,1340,1300,1419,1265,1329,1347,1320,1584,1535,1141,1316,1078,1311,582,1344,1335,1330,753,1331,1337,368,1324,1331,753,368,1331,1332,1485,1325,1325,1485,1342,787,1343,1333,137,1328,1340,973,1341,1479,406,1147,1341,1171,1234,858,1141,1535,1322,49,1141,1322,1344,1336,1335,973,908,1341,766,1347,1584,1347,923,1320,781,49,1322,368,232,1338,787,1340,1343,787,137,1340,568,1346,973,58,1147,406,442,1334,1147,58,442,1147,442,766,1334,90,923,1347,428,368,753,779,1333,1345,825,787,1333,137,1349,1328,1328,1346,568,908,406,1341,924,866,1242,1336,753,1337,428,232,368,1115,777,1098,1348,28,797,797,779,1345,779,825,1333,1007,908,973,583,1351,880,1365,1246,977,1658,145,1710,1310,796,1388,718,245,165,1302,1272,1254,1174,1351,583,1174,715,1351,1358,1260,1204,1374,1373,1276,1377,1374,1276,678,1362,1382,1377,1276,254,139,34,40,1008,1174,583,1396,1286,1319,768,891,457,1316,932,1535,1289,1371,1360,182,736,864,1355,1364,1274,860,1367,1354,1362,1222,1382,1376,869,1311,1590,1411,198,1232,1375,877,1394,1295,1286,880,1356,1386,880,1351,1356,1211,1059,1287,197,678,1405,880,1386,1003,1368,1253,1357,1357,1253,1036,715,1289,1364,1354,1367,703,1383,877,1375,1266,1288,1260,1373,1374,703,1372,1289,1174,1303,1366,1378,1351,715,1355,1665,1666,624,1309,1357,1036,900,1237,1226,1174,1289,715,1337,1331,1317,1360,1303,1359,1267,1354,1175,1241,1284,1414,1377,254,929,1385,855,836,1396,1319,1436,1361,1366,1303,1381,1368,1378,1313,1211,1391,1368,1385,1363,813,82,861,1058,1280,807,893,519,892,1359,1303,860,1382,1350,1247,1371,1303,1360,1267,1175,1271,769,1286,1396,712,1837,82,1366,1385,1381,1365,796,1310,1003,1386,40,780,1371,1370,561,862,790,1284,1380,864,1449,1428,177,611,1280,1058,1284,1375,1380,926,506,1241,1305,1337,1317,309,1203,208,1388,1201,1390,1309,1036,1352,1377,929,1411,1399,1059,1257,1112,70,1145,289,1166,561,1288,1389,1172,1362,37,1180,713,1394,1286,1355,1393,1269,1401,1423,941,1274,1271,1384,860,1378,1367,715,1364,1355,677,1406,869,1297,1358,1202,1388,1258,1329,1180,1288,1266,1008,583,880,1524,1425,1463,1390,1403,1387,1278,1379,1247,1278,1247,1285,964,1278,1262,1358,1369,1202,1715,1699,1726,926,1241,1414,1341,1572,1479,926,930,916,1397,51,781,409,1358,1297,1236,436,301,1376,677,869,1351,1355,1356,758,1534,1523,1378,1357,1367,977,1211,1365,1135,1136,854,1394,1391,1295,1266,1260,1222,1365,1302,1246,1232,877,844,736,930,864,1408,1358,409,1508,817,1523,1381,1385,1368,718,854,910,854,718,1135,1382,1222,1350,1391,1211,1287,1391,1287,1295,1257,1651,134,1414,1284,864,1291,1369,1315,1202,928,1313,86,1400,1413,1413,1200,86,1263,1625,1031,1413,1400,1404,1002,1664,1834,930,926,1414,1399,1257,134,520,316,596,1393,1274,1208,1657,1655,1712,1407,1404,1400,1404,1410,1413,1649,1229,1406,1362,1266,1222,1384,1271,1175,900,1376,1311,1274,1384,1291,1291,1384,1431,1433,1396,1436,1267,1359,1354,309,1353,703,838,1319,1286,1407,1410,1404,441,1518,773,1241,123,1428,1622,1521,1224,1217,1208,1172,1130,793,1076,425,1409,1481,1481,1409,1533,1303,1378,860,1350,1408,1394,1246,1651,977,1289,1360,1364,1727,1694,1623,1417,1407,1533,1417,1410,1407,1406,1650,1649,1319,134,1437,1414,864,930,1406,1229,1124,1354,1359,860,1433,769,1396,1417,1533,1409,1416,1413,1410,1415,1416,1410,95,1237,921,1392,1254,1395,1360,1359,1267,1258,1290,1329,1180,128,1389,1420,1409,425,1417,1418,1410,1418,1415,1410,1422,1077,1416,1247,1350,1394,37,43,1180,1204,1315,1358,1428,1383,1375,1356,1355,1269,1409,1418,1417,1302,45,1246,1421,1416,1415,1421,1422,1416,1422,1494,1077,957,720,938,1423,1409,1420,1423,1418,1409,752,434,1438,1260,1358,1408,1363,1385,785,1423,1426,1418,1426,1424,1418,1229,1649,1124,1222,1260,1350,1508,1523,1137,1278,1285,769,1482,917,144,1418,1424,1415,1425,1422,1421,1425,1524,1422,1272,1388,1390,1391,409,1313,1378,1366,1381,1371,483,1361,720,1262,1278,29,103,159,1271,1364,1267,1424,1427,1415,1537,1522,1518,134,752,1438,1420,934,941,1428,1375,1284,1277,1224,1831,1362,1180,1266,1401,1426,1423,1577,1369,1291,268,483,262,1383,1450,1456,1384,1175,1431,1430,1415,1427,1430,1421,1415,1430,1425,1421,1379,1382,1247,1252,1553,1429,1206,1392,1395,1433,1430,1427,309,208,1353,1272,1390,1254,1361,483,1366,1523,817,808,1302,1254,1392,1371,1361,1303,1426,1435,1424,1435,1433,1424,1433,1427,1424,720,769,1433,796,1258,1388,1590,1419,1268,1289,1372,1371,1305,1317,1509,998,1372,1174,40,1386,139,1261,1354,703,1364,1271,1274,134,1438,1437,1436,1319,1437,1317,686,1509,1484,932,1304,1434,1432,1509,1420,65,934,931,930,736,1367,1357,1309,1372,1370,1371,1204,1208,1315,1426,938,1435,1368,1363,1253,1207,454,1190,1302,1310,1272,309,1377,390,390,1377,1411,1370,1372,998,1411,1590,1148,720,1433,1435,1450,1383,1428,1379,678,1382,1405,678,1379,1208,1291,1315,1399,134,1319,1367,1309,1373,1373,1352,1276,596,741,593,553,1264,612,1433,1436,1430,1437,1438,1430,964,1405,1379,1373,1309,1352,1265,1403,1390,1233,1618,1434,1365,1310,1302,789,796,1365,720,1435,938,128,139,1389,1466,933,1525,1191,1640,1637,1314,1442,943,1141,353,1323,1489,1138,1474,1462,1477,1440,1474,1138,1488,1442,1314,1443,1446,1030,1546,1484,1145,697,1549,1443,1445,1470,1572,1468,1397,1239,1507,1649,1825,1824,1259,1440,1477,1451,1450,1449,978,1446,652,1454,1456,1451,1451,1456,1450,341,1507,595,933,1547,79,804,1452,1060,1454,1455,1456,1398,1460,1454,1455,877,1456,1277,1831,1825,804,1060,1458,1339,1459,1595,1314,1104,1443,933,1448,1547,147,1460,1398,1460,1461,1454,1454,1461,1455,1292,1125,1464,417,1531,1480,1459,1339,1325,811,1756,335,1512,936,1490,777,1529,1098,147,1475,1460,1464,253,1459,836,855,482,1487,1486,1307,1104,1501,1443,1439,1200,1532,1475,1469,1460,1460,1469,1461,1325,1464,1459,1277,1825,1649,1532,1200,1077,844,877,1455,1572,933,1466,1479,568,973,1509,335,1305,1339,1595,1759,1469,1476,1461,1461,1476,1455,1104,1470,1468,1464,1472,253,1117,1091,1407,1756,1542,335,1206,1395,1188,335,1542,1330,835,844,1455,1471,1598,1462,1491,1442,1441,835,1455,1476,1441,1442,1443,1489,1474,1473,1251,1236,1250,1030,1452,1477,1598,1439,1532,978,1598,1492,1426,1401,938,1448,1584,1482,1724,1497,1475,1475,1497,1469,1484,1535,932,1307,1486,1113,1487,696,1495,1037,1491,1441,1030,1446,936,1453,1487,1495,696,1467,1495,1138,1489,1483,1497,1143,1469,1469,1143,1476,652,1598,978,850,1043,1150,1482,1584,1320,1731,98,1697,1113,1554,1573,1524,1532,1494,1496,1467,696,1452,1259,1477,296,1504,1497,1504,1143,1497,1143,1499,1476,718,910,1498,868,1540,1528,817,1253,810,1490,696,1487,1440,1491,1037,1510,676,595,1488,1492,1517,781,1239,1397,1467,1519,1503,1500,1307,1759,1149,397,452,1504,1514,1143,1514,842,1143,1125,733,1458,1503,1531,1555,1276,1036,1137,1440,723,1123,1036,1508,1137,817,1508,1253,103,883,1112,1458,731,1472,1512,1490,1487,1487,1453,1486,1138,978,1488,1036,1253,1508,1398,149,147,1474,1517,1513,1125,1458,1472,1486,1453,1554,1518,1534,758,345,1058,1062,928,1202,1369,1554,1541,1505,1464,1125,1472,1504,764,1514,304,426,573,1505,742,1506,1479,1572,1478,1519,1483,1489,833,716,1069,1522,1534,1518,1115,1513,777,811,335,1432,1591,1533,1407,777,1517,1529,1513,1517,777,1498,910,1397,1069,1539,833,833,1539,1537,1522,1551,1534,1534,1551,1523,1538,1137,1523,910,51,1397,1367,1373,703,1466,1525,1468,157,1186,1832,1429,1511,1506,1573,1505,1506,1259,1452,804,1503,1495,1467,262,483,780,1572,1466,1468,1536,1556,716,716,1556,1069,1544,1523,1551,1544,1538,1523,1511,1573,1506,933,1572,1448,1543,1537,1539,1537,1543,1522,1091,933,79,1519,1540,1545,1549,1445,86,1069,1548,1539,1548,1543,1539,1543,1551,1522,1500,1487,1307,68,784,1186,1552,1544,1551,1550,1538,1544,1538,1550,1137,1519,1473,1540,1547,1448,1482,1560,1563,1536,1536,1563,1556,1556,1548,1069,1543,1558,1551,1137,1550,1276,1453,1495,1555,1561,1543,1548,1543,1561,1558,1558,1566,1551,1552,1550,1544,1569,1557,1550,1557,1276,1550,1276,1557,254,1531,1503,1480,1535,1530,1510,1545,1503,1519,1547,1482,79,1566,1552,1551,1552,1569,1550,1503,1545,1480,703,1377,309,1625,675,756,1037,1441,88,929,254,1557,849,1567,1560,1556,1564,1548,1492,1529,1517,1252,1429,1506,1553,1027,1429,1453,1555,1541,1554,1453,1541,1233,686,1553,1328,1104,1314,1564,1576,1548,1548,1576,1561,1557,1562,929,1520,112,1668,1483,1446,1138,778,1570,1567,1563,1564,1556,1561,1565,1558,1565,1566,1558,1569,1552,1566,1562,1557,1569,1530,1535,1484,1387,1402,1395,1621,1634,1387,1567,1568,1560,1560,1568,1563,1571,1569,1566,1344,1330,1542,1577,1431,1353,1638,233,304,1524,1463,1529,1353,1431,1175,1077,1200,1413,1478,1470,1104,1568,1575,1563,1563,1575,1564,1575,1576,1564,1561,1576,1565,1565,1574,1566,1562,1515,929,1555,96,1541,1531,417,96,1555,1531,96,1246,45,1651,208,1577,1353,1586,1568,1567,1574,1571,1566,1571,1583,1569,1474,1513,1528,1239,1322,1535,1478,1572,1470,1570,1586,1567,1488,1517,1474,8,1833,1837,1123,1442,1491,1589,1568,1586,1576,1594,1565,1565,1594,1574,1562,198,1515,1559,1441,1549,1441,1443,1549,1135,425,1481,1239,1535,1507,1595,1487,1500,1570,1585,1586,1589,1578,1568,1568,1578,1575,1579,1569,1583,1177,1577,208,115,1236,110,1578,1593,1575,1587,1576,1575,1576,1581,1594,1571,1582,1583,1588,1579,1583,1579,1580,1562,1569,1579,1562,1562,1580,198,1027,1511,1429,1589,1593,1578,1587,1581,1576,1582,1574,1594,1574,1582,1571,1575,1593,1587,1583,1582,1588,1580,1590,198,1587,1593,1581,1505,1541,96,1369,1577,1177,1573,1554,1505,1479,1478,568,1585,1589,1586,1369,1177,704,766,1584,1334,977,1257,1059,1091,1591,1407,1591,1091,1457,1585,1604,1589,1581,1592,1594,1602,1582,1594,1582,1608,1588,1608,1579,1588,1579,1597,1580,1419,1590,1580,1597,1419,1580,1431,1577,1291,1589,1604,1593,1601,1596,1593,1593,1596,1581,1306,1511,1027,1511,1113,1573,1786,1412,1585,1412,1604,1585,1581,1596,1592,1592,1602,1594,1608,1599,1579,1599,1611,1579,1579,1611,1597,1512,1487,253,1519,1489,1473,1545,1540,868,1083,1187,1402,1117,1407,1400,1292,733,1125,284,1240,1245,1604,1600,1593,1600,1601,1593,1582,1607,1608,789,1369,704,1467,1483,1519,1601,1613,1596,1596,1613,1592,1602,1607,1582,1620,1553,1252,1601,1605,1613,1592,1613,1602,1602,1606,1607,1608,1609,1599,1599,1609,1611,1603,1597,1611,1265,1419,1597,1603,1265,1597,1392,1206,45,928,1369,789,1474,1528,1473,1104,1468,1501,1412,1521,1604,1613,1631,1602,1607,1610,1608,1608,1610,1609,1476,863,835,1495,1503,1555,1498,1397,718,1520,1668,7,1604,1615,1600,1605,1601,1600,1602,1631,1606,1606,1610,1607,1759,1595,1500,1292,1298,733,1615,1604,1521,1609,1603,1611,652,1462,1598,1468,1525,1445,1443,1501,1445,1134,1723,150,1521,1622,1615,1615,1616,1600,1616,1605,1600,1605,1616,1612,1605,1612,1613,1612,1617,1613,1613,1617,1631,1606,1614,1610,1265,1603,1403,448,417,1480,1595,253,1487,1501,1468,1445,1383,1456,877,1490,1496,696,1610,1627,1609,1627,1621,1609,1591,1481,1533,1598,1471,1439,1353,1261,703,1606,1631,1614,1609,1621,1403,1532,1077,1494,1528,1115,513,1546,652,1446,1211,928,1365,1540,1473,1528,1078,1502,1787,1425,1430,1438,1617,1630,1631,959,749,944,566,570,603,1716,310,1521,775,452,397,1615,1636,1616,1616,1636,1612,1610,1632,1627,789,704,1258,1457,1481,1591,1769,1756,811,207,1629,722,1629,1625,722,1224,1277,1622,1622,1636,1615,1636,1646,1612,1612,1630,1617,1631,1626,1614,1614,1632,1610,1506,104,95,1481,1457,1136,1123,943,1442,936,1446,1496,1499,863,1476,1629,1031,1625,1233,1509,686,1633,1634,1621,1621,1387,1403,1472,1512,253,1177,208,704,1277,1636,1622,1626,1632,1614,1627,1633,1621,936,1496,1490,185,1454,1451,731,936,1512,1638,1635,207,553,1263,1264,1653,1212,1639,1633,1627,1632,1633,1387,1634,1458,1060,731,368,1307,1113,1264,1031,1629,1152,850,1150,1277,1644,1636,1646,1637,1612,1637,1630,1612,1647,1631,1630,1647,1626,1631,1422,1524,1494,1030,652,1546,1635,1629,207,1635,1264,1629,1639,1646,1636,1637,1640,1630,1641,1632,1626,1632,1642,1633,1633,1643,1387,842,1499,1143,865,863,1499,1516,978,1492,67,1130,784,1103,1505,96,88,1441,1200,1644,1639,1636,1640,1647,1630,1647,1641,1626,1633,1648,1643,1492,1532,1524,1488,1516,1492,1037,1471,1462,612,1264,1635,1502,1078,1124,1641,1642,1632,1648,1633,1642,1528,513,868,1492,1598,1532,1095,991,760,679,157,1664,760,1128,1785,1277,1650,1644,320,1022,244,1559,1549,86,1676,1520,7,1488,978,1516,1095,760,1785,1128,384,1120,304,312,1638,1081,1638,312,1081,1635,1638,103,612,1635,652,1477,1462,1650,1645,1644,1645,1639,1644,1639,1637,1646,1640,1090,1647,1654,1641,1647,1654,1642,1641,1654,1648,1642,1643,1402,1387,1432,335,1509,384,1128,760,1652,312,304,103,1243,612,1277,1649,1650,1090,1654,1647,1643,1648,1402,1134,324,1675,679,68,157,1652,1081,312,1136,301,803,1653,1639,1645,723,1440,1259,803,854,1136,104,1506,742,1112,159,103,1654,1083,1648,977,1651,1257,1397,1507,718,1081,103,1635,1650,677,1645,1083,1402,1648,1706,1655,1671,1624,1704,1711,767,2,1,608,794,294,1678,1683,1686,767,1682,2,1669,1692,1675,296,1681,764,1671,1656,1672,17,1673,1679,1706,1671,1673,1662,1674,1699,1655,1657,1656,418,84,915,1526,1514,764,1658,1657,567,870,1695,764,813,1697,98,1659,821,5,60,1013,848,1013,110,1213,661,1038,1692,1660,1703,17,1693,1673,17,1663,1715,1743,1013,115,110,344,1733,32,1670,1663,1743,1670,1743,1738,1677,1670,1738,1661,4,3,1084,1683,1678,1728,793,1130,1683,1767,1196,1677,1738,1196,1279,1786,853,294,1038,608,1279,1689,1786,870,18,1708,870,1680,1695,1705,10,1670,1084,1767,1683,1196,1738,1686,1750,870,1681,1750,18,870,1773,1703,1660,1135,47,425,150,323,1134,1707,1655,1706,1741,344,1687,1685,1691,1684,1684,1691,802,1672,1656,0,1038,124,608,1671,1672,1690,1628,1218,1767,1686,1275,1667,1493,1750,1681,1773,18,1750,1773,1660,18,1679,1671,16,1735,1706,1673,1667,1678,1686,1688,1658,1,1656,1688,0,1293,1281,1458,1698,1678,1667,1696,1130,1722,1698,1667,1696,1715,1662,1699,1692,1038,294,1682,767,357,1669,661,1692,802,1702,824,1028,1067,1784,822,1624,778,119,813,861,1218,1670,1677,1703,1693,17,1658,1710,1,750,1730,1729,1701,750,1729,1693,1735,1673,1731,1694,98,1691,1702,802,783,1729,1719,1680,870,1708,1707,1709,1655,533,756,675,1691,1210,1702,11,1705,1670,1767,1218,1196,1218,1677,1196,1664,1716,1721,1729,1725,1719,1729,1072,1725,1210,1116,1702,1702,1720,824,1682,1661,2,1713,1719,1721,1716,1786,1713,1730,1722,1072,294,1717,1811,1692,294,1666,1659,680,821,824,1720,1714,1726,1731,1718,345,1062,1045,1738,1743,1275,1075,1089,1071,783,1719,1689,1275,684,1728,1692,1666,1665,1675,1692,1665,294,1811,1666,1716,1664,310,1678,1698,1700,6,9,1727,676,649,595,381,31,361,1723,1804,1772,1727,9,1694,1720,1089,1714,1786,1716,1412,1683,1196,1686,1718,1697,1085,1116,1739,1702,1739,1734,1720,1702,1739,1720,1089,1720,1734,509,748,1745,1743,1715,1726,1717,294,794,1116,1732,1739,1718,1731,1697,1696,1667,1130,1134,1665,1723,1694,712,98,101,1687,102,391,1736,101,662,636,642,1734,1447,1089,1089,1447,1071,436,99,493,1689,1279,783,1485,1465,1342,1736,1687,101,344,1741,1733,1741,1742,1733,1735,829,1706,829,1707,1706,1485,1332,1465,952,1126,1742,1747,1447,1734,879,892,645,1730,1146,1696,829,1709,1707,1709,1712,1655,118,1739,1732,1332,1744,1465,1687,1749,1741,1741,1758,1742,679,1072,68,1072,1722,68,118,1747,1739,1747,1734,1739,1465,1744,1736,1736,1740,1687,1704,1701,783,1665,624,1723,1722,1130,67,1025,1055,467,1444,14,1701,558,522,530,1657,1658,1688,1339,1746,1332,1332,1748,1744,1687,1740,1749,1741,1749,1758,1109,952,1742,1747,118,141,1671,1690,1628,1671,1628,16,1657,1688,1656,1745,748,1447,357,767,1710,1746,1748,1332,1146,1700,1698,1759,1307,1338,1239,781,1322,1745,1447,1747,522,1745,1747,316,717,595,148,1493,1724,1758,1109,1742,1725,1072,679,726,719,1661,1695,1680,1526,1772,1750,1493,148,1772,1493,1542,1751,1101,952,1109,1086,1744,1752,1736,1736,1752,1740,1753,1755,1740,391,1342,1736,821,112,1520,557,530,1747,530,522,1747,994,879,645,1542,1756,1751,1813,1693,1703,1746,1754,1748,1748,1764,1744,1752,1757,1740,1740,1757,1753,1749,1740,1755,1755,1763,1749,1763,1758,1749,1275,1743,684,1813,1735,1693,1107,1099,1101,1723,624,1804,1403,1603,1609,1748,1754,1764,1744,1757,1752,1760,1109,1758,1465,1736,1342,436,115,99,1686,1738,1275,1751,1766,1101,1759,1754,1746,1755,1753,1763,1570,1279,853,1701,1146,750,1655,1656,1671,11,1670,1218,1761,1751,1756,1766,1107,1101,1726,1623,1731,1711,1704,1279,67,784,68,558,530,545,1620,1618,1233,1769,1761,1756,102,1687,344,1338,1754,1759,1754,232,1764,1744,1765,1757,1757,1763,1753,1762,1760,1758,1760,1771,1109,1339,1759,1746,1675,1665,1134,1730,1696,1722,1774,1751,1761,1766,1780,1107,1780,1105,1107,1764,1765,1744,1763,1762,1758,1772,1773,1750,1811,1813,1703,1434,1769,1432,1780,1766,1751,232,1781,1764,1711,1279,1570,1688,1,0,1774,1780,1751,1764,1781,1765,1765,1768,1757,1757,1768,1763,1777,1782,1760,1762,1777,1760,1769,1774,1761,1763,1777,1762,1760,1782,1771,232,1737,1781,1768,1776,1763,272,255,774,1669,994,661,1618,1769,1434,1765,589,1768,1770,1777,1763,1701,1729,783,1783,1774,1769,1789,1780,1774,589,1775,1768,1776,1770,1763,1782,1778,1771,1771,1778,1070,624,1703,1773,624,1811,1703,1620,1244,1618,1779,1769,1618,1779,1783,1769,739,1735,1813,1775,1776,1768,1790,1777,1770,1777,1778,1782,1725,679,1721,733,1293,1458,1802,1618,1244,1802,1779,1618,1788,1783,1779,1789,1774,1783,1796,1780,1789,1796,1119,1780,1823,1817,325,1699,1727,1623,750,1146,1730,1497,1724,296,1128,1119,1796,61,62,71,1131,413,824,1114,1111,249,1784,1776,1775,1123,723,1283,1791,1788,1779,1788,1789,1783,1095,1797,1074,1028,1784,1775,1784,1770,1776,1777,1790,1778,1793,1797,1095,1797,1800,1074,1798,1790,1770,1805,1802,1244,1802,1791,1779,1792,1789,1788,1793,1785,1128,1793,1095,1785,1074,1800,1619,741,457,593,1798,1770,1784,1798,1794,1790,1786,1689,1713,684,1726,1718,1728,1085,793,1795,1787,1502,1806,1802,1805,1819,1788,1791,1067,1798,1784,1790,1794,1778,1795,1502,1124,1801,1805,1787,1807,1791,1802,1807,1819,1791,1819,1792,1788,1799,1128,1796,994,645,661,684,1085,1728,684,1718,1085,1699,1623,1726,1801,1787,1795,1808,1789,1792,1808,1796,1789,1799,1793,1128,1809,1797,1793,1809,1803,1797,1803,1800,1797,1067,1794,1798,774,255,1778,1673,1671,1679,879,1669,888,19,1807,1802,1810,1619,1800,879,994,1669,1794,774,1778,1723,1772,148,1804,1773,1772,1814,1795,1124,1649,1814,1124,1814,1801,1795,1812,1806,1805,19,1802,1806,19,1819,1807,1810,1800,1803,1804,624,1773,1714,1131,824,1801,1812,1805,1812,19,1806,1808,1792,1819,1799,1809,1793,1821,1810,1803,1717,739,1813,1061,1619,1822,1794,1817,774,79,1482,144,1815,1801,1814,23,1819,19,589,1028,1775,1817,1823,774,1689,1719,1713,1824,1814,1649,1827,1818,1801,1818,1812,1801,1818,19,1812,1818,20,19,1816,1809,1799,1821,1803,1809,1822,1619,1810,124,708,608,1663,10,1715,1815,1827,1801,1820,1808,1819,23,1820,1819,603,1810,1821,603,1822,1810,1085,1697,793,1628,1690,11,1527,1704,1624,1730,1072,1729,1526,1444,1704,1526,1680,1444,1704,1444,1701,1816,1821,1809,1722,67,68,317,272,1823,1716,1713,1721,16,1628,1767,1527,1526,1704,1824,1826,1814,1814,1826,1815,1818,21,20,1835,1808,1820,603,570,1822,226,1070,1778,1013,1181,1179,1721,679,1664,1717,1813,1811,1828,1827,1815,22,1820,23,22,1835,1820,1830,603,1821,719,1659,5,643,567,1657,1717,794,739,1825,1826,1824,1828,1815,1826,1829,21,1818,1808,1835,13,4,719,5,10,1662,1715,1828,1832,1827,1832,1818,1827,12,1833,1816,1833,1821,1816,1833,1830,1821,14,1146,1701,1186,1829,1818,1280,603,1830,14,1700,1146,1667,1728,1130,1825,1834,1826,1834,1828,1826,1832,1186,1818,1836,13,1835,1624,1711,1570,778,1624,1570,1719,1725,1721,1002,1825,1831,1002,1834,1825,1834,1832,1828,1186,21,1829,1836,1835,22,1837,1833,12,1280,1830,1833,1667,1275,1728,16,1767,1084,589,1765,1838,1765,1781,1838,1781,1737,1838,1737,982,1838,982,1053,1838,1053,816,1838,816,589,1838};
-
@@ -1,27 +1,37 @@
 #include "BunnyTest.h"
-#include "BunnyData.h"
+#include "MeshOptimizer.h"
+#include "RenderPassAnalyzer.h"
+
+// 1 draws with reversed-Z and an infinite far plane, testing GREATER against a depth buffer cleared to 0
+#define USE_REVERSED_Z 0
+// 1 steps the swapchain pass through MSAA, a stats window each, and logs what each costs; only the sample
+// counts the backend guarantees are measured, 1x/2x/4x on GLES3 and 1x/4x on Vulkan and Metal, never 8x
+#define MSAA_BENCHMARK 0
 
 namespace cc {
 
 namespace {
-enum class Binding : uint8_t { MVP, COLOR };
+enum class Binding : uint8_t { MODEL, COLOR };
 }
 
 void BunnyTest::destroy() {
     CC_SAFE_DESTROY(_shader);
     CC_SAFE_DESTROY(_vertexBuffer);
     CC_SAFE_DESTROY(_indexBuffer);
-    CC_SAFE_DESTROY(_mvpMatrix);
+    CC_SAFE_DESTROY(_modelMatrix);
     CC_SAFE_DESTROY(_color);
     CC_SAFE_DESTROY(_rootUBO);
     CC_SAFE_DESTROY(_inputAssembler);
     CC_SAFE_DESTROY(_descriptorSet);
     CC_SAFE_DESTROY(_descriptorSetLayout);
     CC_SAFE_DESTROY(_pipelineLayout);
-    CC_SAFE_DESTROY(_pipelineState);
+    for (gfx::PipelineState *&pipelineState : _pipelineStates) CC_SAFE_DESTROY(pipelineState);
 }
 
 bool BunnyTest::initialize() {
+#if USE_REVERSED_Z
+    TestBaseI::setPerspectiveCamera(60.0f, 0.01f, std::numeric_limits<float>::infinity(), true);
+#endif
     createShader();
     createBuffers();
     createInputAssembler();
@@ -36,14 +46,18 @@ void BunnyTest::createShader() {
         R"(
             layout(location = 0) in vec3 a_position;
 
-            layout(set = 0, binding = 0) uniform MVP_Matrix {
-                mat4 u_model, u_view, u_projection;
+            layout(set = 0, binding = 0) uniform Model {
+                mat4 u_model;
+            };
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
 
             layout(location = 0) out vec3 v_position;
 
             void main () {
-                vec4 pos = u_projection * u_view * u_model * vec4(a_position, 1);
+                vec4 pos = cc_matViewProj * u_model * vec4(a_position, 1);
                 v_position = a_position.xyz;
                 gl_Position = pos;
             }
@@ -64,14 +78,18 @@ void BunnyTest::createShader() {
         R"(
             in vec3 a_position;
 
-            layout(std140) uniform MVP_Matrix {
-                mat4 u_model, u_view, u_projection;
+            layout(std140) uniform Model {
+                mat4 u_model;
+            };
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
 
             out vec3 v_position;
 
             void main () {
-                vec4 pos = u_projection * u_view * u_model * vec4(a_position, 1);
+                vec4 pos = cc_matViewProj * u_model * vec4(a_position, 1);
                 v_position = a_position.xyz;
                 gl_Position = pos;
             }
@@ -92,11 +110,11 @@ void BunnyTest::createShader() {
     sources.glsl1 = {
         R"(
             attribute vec3 a_position;
-            uniform mat4 u_model, u_view, u_projection;
+            uniform mat4 u_model, cc_matViewProj;
             varying vec3 v_position;
 
             void main () {
-                vec4 pos = u_projection * u_view * u_model * vec4(a_position, 1);
+                vec4 pos = cc_matViewProj * u_model * vec4(a_position, 1);
                 v_position = a_position.xyz;
                 gl_Position = pos;
             }
@@ -127,15 +145,12 @@ void BunnyTest::createShader() {
     shaderStageList.emplace_back(std::move(fragmentShaderStage));
 
     gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
-    gfx::UniformList mvpMatrix = {
-        {"u_model", gfx::Type::MAT4, 1},
-        {"u_view", gfx::Type::MAT4, 1},
-        {"u_projection", gfx::Type::MAT4, 1},
-    };
+    gfx::UniformList model = {{"u_model", gfx::Type::MAT4, 1}};
     gfx::UniformList color = {{"u_color", gfx::Type::FLOAT4, 1}};
     gfx::UniformBlockList uniformBlockList = {
-        {0, static_cast<uint>(Binding::MVP), "MVP_Matrix", mvpMatrix, 1},
+        {0, static_cast<uint>(Binding::MODEL), "Model", model, 1},
         {0, static_cast<uint>(Binding::COLOR), "Color", color, 1},
+        TestBaseI::getGlobalUniformBlock(),
     };
 
     gfx::ShaderInfo shaderInfo;
@@ -147,39 +162,24 @@ void BunnyTest::createShader() {
 }
 
 void BunnyTest::createBuffers() {
-    // vertex buffer
-    _vertexBuffer = _device->createBuffer({
-        gfx::BufferUsage::VERTEX,
-        gfx::MemoryUsage::DEVICE,
-        sizeof(bunny_positions),
-        3 * sizeof(float),
-    });
-    _vertexBuffer->update((void *)&bunny_positions[0][0], 0, sizeof(bunny_positions));
+    bool valid = createMeshBuffers(_device, "bunny.mesh", "BunnyTest", _vertexBuffer, _indexBuffer, _lods);
+    CCASSERT(valid, "BunnyTest load mesh failed");
 
-    // index buffer
-    _indexBuffer = _device->createBuffer({
-        gfx::BufferUsage::INDEX,
-        gfx::MemoryUsage::DEVICE,
-        sizeof(bunny_cells),
-        sizeof(uint16_t),
-    });
-    _indexBuffer->update((void *)&bunny_cells[0], 0, sizeof(bunny_cells));
-
-    // root UBO
-    uint offset = TestBaseI::getAlignedUBOStride(_device, 3 * sizeof(Mat4));
+    // root UBO, camera matrices come from the harness globals so it never changes after this
+    uint offset = TestBaseI::getAlignedUBOStride(_device, sizeof(Mat4));
     uint size = offset + 4 * sizeof(float);
     _rootUBO = _device->createBuffer({
         gfx::BufferUsage::UNIFORM,
-        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        gfx::MemoryUsage::DEVICE,
         TestBaseI::getUBOSize(size),
     });
-    _rootBuffer.resize(size / sizeof(float));
+    vector<float> rootBuffer(size / sizeof(float));
 
-    // mvp matrix uniform
-    _mvpMatrix = _device->createBuffer({
+    // model matrix uniform
+    _modelMatrix = _device->createBuffer({
         _rootUBO,
         0,
-        3 * sizeof(Mat4),
+        sizeof(Mat4),
     });
     // color uniform
     _color = _device->createBuffer({
@@ -189,10 +189,11 @@ void BunnyTest::createBuffers() {
     });
 
     Mat4 model;
-    std::copy(model.m, model.m + 16, &_rootBuffer[0]);
+    std::copy(model.m, model.m + 16, &rootBuffer[0]);
 
     float color[4] = {0.5f, 0.5f, 0.5f, 1.0f};
-    std::copy(color, color + 4, &_rootBuffer[offset / sizeof(float)]);
+    std::copy(color, color + 4, &rootBuffer[offset / sizeof(float)]);
+    _rootUBO->update(rootBuffer.data(), 0, size);
 }
 
 void BunnyTest::createInputAssembler() {
@@ -210,11 +211,11 @@ void BunnyTest::createPipelineState() {
     dslInfo.bindings.push_back({1, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
     _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
 
-    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout, TestBaseI::getGlobalDescriptorSetLayout()}});
 
     _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
 
-    _descriptorSet->bindBuffer(static_cast<uint>(Binding::MVP), _mvpMatrix);
+    _descriptorSet->bindBuffer(static_cast<uint>(Binding::MODEL), _modelMatrix);
     _descriptorSet->bindBuffer(static_cast<uint>(Binding::COLOR), _color);
     _descriptorSet->update();
 
@@ -222,41 +223,84 @@ void BunnyTest::createPipelineState() {
     pipelineStateInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
     pipelineStateInfo.shader = _shader;
     pipelineStateInfo.inputState = {_inputAssembler->getAttributes()};
-    pipelineStateInfo.renderPass = _fbo->getRenderPass();
     pipelineStateInfo.depthStencilState.depthTest = true;
     pipelineStateInfo.depthStencilState.depthWrite = true;
-    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineStateInfo.depthStencilState.depthFunc = USE_REVERSED_Z ? gfx::ComparisonFunc::GREATER : gfx::ComparisonFunc::LESS;
     pipelineStateInfo.pipelineLayout = _pipelineLayout;
-    _pipelineState = _device->createPipelineState(pipelineStateInfo);
+    // the sample count is part of the render pass, every variant needs its own pipeline
+    for (uint i = 0u; i < (MSAA_BENCHMARK ? MSAA_VARIANT_COUNT : 1u); ++i) {
+        if (!TestBaseI::isMultisampleSupported(MSAA_SAMPLE_COUNTS[i])) continue;
+        pipelineStateInfo.renderPass = TestBaseI::getRenderPass(MSAA_SAMPLE_COUNTS[i]);
+        _pipelineStates[i] = _device->createPipelineState(pipelineStateInfo);
+    }
 }
 
 void BunnyTest::tick() {
     lookupTime();
-    _dt += hostThread.dt;
-
-    Mat4::createLookAt(Vec3(30.0f * std::cos(_dt), 20.0f, 30.0f * std::sin(_dt)),
-                       Vec3(0.0f, 2.5f, 0.0f), Vec3(0.0f, 1.0f, 0.f), &_view);
-    std::copy(_view.m, _view.m + 16, &_rootBuffer[16]);
-
-    Mat4 projection;
+    uint steps = _clock.advance(hostThread.dt);
+    for (uint i = 0; i < steps; ++i) {
+        _prevTime = _time;
+        _time += _clock.step;
+    }
+    float time = _prevTime + (_time - _prevTime) * _clock.alpha;
+
+    // dolly between the original orbit and far away so every LOD gets its turn
+    float dolly = 1.0f + 4.0f * (1.0f - std::cos(time * 0.2f));
+    Vec3 eye(30.0f * std::cos(time) * dolly, 20.0f * dolly, 30.0f * std::sin(time) * dolly);
+    Vec3 center(0.0f, 2.5f, 0.0f);
+    Mat4 view;
+    Mat4::createLookAt(eye, center, Vec3(0.0f, 1.0f, 0.f), &view);
+
+    float distance = eye.distance(center);
     gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
-    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 0.01f, 1000.0f, &projection);
-    std::copy(projection.m, projection.m + 16, &_rootBuffer[32]);
-
-    gfx::Color clearColor = {0.0f, 0, 0, 1.0f};
+    uint lod = selectMeshLod(_lods, distance, math::PI / 3.0f, static_cast<float>(orientedSize.height));
+    _inputAssembler->setFirstIndex(_lods[lod].firstIndex);
+    _inputAssembler->setIndexCount(_lods[lod].indexCount);
+
+    _statsTriangles += _lods[lod].indexCount / 3u;
+    _statsFrameTime += hostThread.dt;
+    if (++_statsFrames == 60u) {
+        CC_LOG_INFO("Bunny LOD: distance %.1f, LOD %u of %u, %u triangles per frame vs %u full detail, %.3fms per frame",
+                    distance, lod, static_cast<uint>(_lods.size()), _statsTriangles / _statsFrames, _lods[0].indexCount / 3u,
+                    _statsFrameTime * 1000.f / _statsFrames);
+        _statsFrames = _statsTriangles = 0u;
+        _statsFrameTime = 0.0f;
+    }
+
+#if MSAA_BENCHMARK
+    // the first frame of a variant pays for its attachments, leave it out
+    if (_statsMsaaFrames++) _statsMsaaTime += hostThread.dt;
+    if (_statsMsaaFrames == 61u) {
+        uint attachmentBytes = 0u;
+        uint resolveBytes = 0u;
+        TestBaseI::getMultisampleCost(MSAA_SAMPLE_COUNTS[_msaaVariant], attachmentBytes, resolveBytes);
+        CC_LOG_INFO("Bunny MSAA %ux: %.3fms per frame, %.1fMB of multisampled attachments, %.1fMB resolve traffic per frame",
+                    static_cast<uint>(MSAA_SAMPLE_COUNTS[_msaaVariant]), _statsMsaaTime * 1000.f / 60u,
+                    attachmentBytes / 1048576.0f, resolveBytes / 1048576.0f);
+        _msaaVariant = TestBaseI::getNextMultisampleVariant(_msaaVariant);
+        _statsMsaaFrames = 0u;
+        _statsMsaaTime = 0.0f;
+    }
+#endif
+
+    // a second clear color for the resolve attachment of the multisampled variants
+    gfx::Color clearColors[] = {{0.0f, 0, 0, 1.0f}, {0.0f, 0, 0, 1.0f}};
 
     _device->acquire();
 
-    _rootUBO->update(_rootBuffer.data(), 0, _rootBuffer.size() * sizeof(float));
+    TestBaseI::updateGlobals(view);
     gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
 
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
-    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    gfx::Framebuffer *framebuffer = TestBaseI::getFramebuffer(MSAA_SAMPLE_COUNTS[_msaaVariant]);
+    commandBuffer->beginRenderPass(framebuffer->getRenderPass(), framebuffer, renderArea, clearColors, USE_REVERSED_Z ? 0.0f : 1.0f, 0);
+    getRenderPassAnalyzer()->record("BunnyTest", framebuffer, renderArea);
 
     commandBuffer->bindInputAssembler(_inputAssembler);
-    commandBuffer->bindPipelineState(_pipelineState);
+    commandBuffer->bindPipelineState(_pipelineStates[_msaaVariant]);
     commandBuffer->bindDescriptorSet(0, _descriptorSet);
+    TestBaseI::bindGlobals(commandBuffer);
     commandBuffer->draw(_inputAssembler);
 
     commandBuffer->endRenderPass();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TestBase.h"
+#include "MeshOptimizer.h"
 
 namespace cc {
 
@@ -26,17 +27,25 @@ private:
     gfx::Buffer* _vertexBuffer = nullptr;
     gfx::Buffer* _indexBuffer = nullptr;
     gfx::Buffer* _rootUBO = nullptr;
-    vector<float> _rootBuffer;
-    gfx::Buffer* _mvpMatrix = nullptr;
+    gfx::Buffer* _modelMatrix = nullptr;
     gfx::Buffer* _color = nullptr;
     gfx::DescriptorSet* _descriptorSet = nullptr;
     gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
     gfx::PipelineLayout* _pipelineLayout = nullptr;
     gfx::InputAssembler* _inputAssembler = nullptr;
-    gfx::PipelineState* _pipelineState = nullptr;
+    gfx::PipelineState* _pipelineStates[MSAA_VARIANT_COUNT] = {}; // by MSAA_SAMPLE_COUNTS
+    uint _msaaVariant = 0u;
     
-    Mat4 _view;
-    float _dt = 0.0f;
+    FixedStep _clock;
+    float _time = 0.0f;
+    float _prevTime = 0.0f;
+
+    vector<MeshLod> _lods;
+    uint _statsFrames = 0u;
+    uint _statsTriangles = 0u;
+    float _statsFrameTime = 0.0f;
+    uint _statsMsaaFrames = 0u;
+    float _statsMsaaTime = 0.0f;
 };
 
 } // namespace cc
@@ -1,4 +1,5 @@
 #include "ClearScreenTest.h"
+#include "RenderPassAnalyzer.h"
 
 namespace cc {
 
@@ -26,6 +27,7 @@ void ClearScreen::tick() {
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("ClearScreenTest", _fbo, renderArea);
     commandBuffer->endRenderPass();
     commandBuffer->end();
 
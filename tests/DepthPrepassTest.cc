@@ -0,0 +1,557 @@
+#include "DepthPrepassTest.h"
+#include "RenderPassAnalyzer.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include <cfloat>
+
+// 1 lays depth down with a position-only pass first, then shades with depth test EQUAL and no depth writes
+#define USE_DEPTH_PREPASS       1
+// flips the prepass after every stats line so both modes are measured on the same scene
+#define ALTERNATE_DEPTH_PREPASS 1
+// screen-filling layers of bunnies one behind another, roughly the depth complexity of the scene
+#define LAYER_COUNT 8u
+#define LAYER_ROWS  4u
+// 1 submits the far layers first, the worst case for early Z without a prepass
+#define DRAW_BACK_TO_FRONT 1
+// lights evaluated per fragment, high enough that shading and not vertex work bounds the frame
+#define SHADING_ITERATIONS 64u
+// three rows of the affine model matrix
+#define INSTANCE_STRIDE (12 * sizeof(float))
+
+namespace cc {
+
+void DepthPrepassTest::destroy() {
+    CC_SAFE_DESTROY(_prepassShader);
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_normalBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    CC_SAFE_DESTROY(_instanceBuffer);
+    CC_SAFE_DESTROY(_materialBuffer);
+    CC_SAFE_DESTROY(_prepassInputAssembler);
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_prepassPipelineState);
+    CC_SAFE_DESTROY(_equalPipelineState);
+    CC_SAFE_DESTROY(_lessPipelineState);
+}
+
+bool DepthPrepassTest::initialize() {
+    _prepass = USE_DEPTH_PREPASS;
+    createShader();
+    createBuffers();
+    createInputAssembler();
+    createPipelineState();
+    return true;
+}
+
+void DepthPrepassTest::createShader() {
+
+    // both passes transform positions with the same expression and invariant gl_Position,
+    // otherwise depth test EQUAL drops fragments where the two compile differently
+    ShaderSources prepassSources;
+    prepassSources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+            layout(location = 1) in vec4 a_model0;
+            layout(location = 2) in vec4 a_model1;
+            layout(location = 3) in vec4 a_model2;
+
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(1);
+            }
+        )",
+    };
+
+    prepassSources.glsl3 = {
+        R"(
+            in vec3 a_position;
+            in vec4 a_model0;
+            in vec4 a_model1;
+            in vec4 a_model2;
+
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(1);
+            }
+        )",
+    };
+
+    prepassSources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            attribute vec4 a_model0;
+            attribute vec4 a_model1;
+            attribute vec4 a_model2;
+            uniform mat4 cc_matViewProj;
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            void main () {
+                gl_FragColor = vec4(1);
+            }
+        )",
+    };
+
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+            layout(location = 1) in vec3 a_normal;
+            layout(location = 2) in vec4 a_model0;
+            layout(location = 3) in vec4 a_model1;
+            layout(location = 4) in vec4 a_model2;
+
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            layout(location = 0) out vec3 v_normal;
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_normal = vec3(dot(a_model0.xyz, a_normal), dot(a_model1.xyz, a_normal), dot(a_model2.xyz, a_normal));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            layout(set = 0, binding = 0) uniform Material { vec4 u_albedo; };
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            layout(location = 0) in vec3 v_normal;
+            layout(location = 0) out vec4 o_color;
+
+            void main () {
+                vec3 n = normalize(v_normal);
+                vec3 color = vec3(0);
+                for (int i = 0; i < SHADING_ITERATIONS; ++i) {
+                    float angle = float(i) * 2.39996 + cc_time.x;
+                    vec3 l = normalize(vec3(cos(angle), sin(angle), 1.5));
+                    color += max(dot(n, l), 0.0) * (0.6 + 0.4 * cos(vec3(0.0, 2.1, 4.2) + float(i)));
+                }
+                o_color = vec4(u_albedo.rgb * color * (2.0 / float(SHADING_ITERATIONS)), 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+            in vec3 a_normal;
+            in vec4 a_model0;
+            in vec4 a_model1;
+            in vec4 a_model2;
+
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            out vec3 v_normal;
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_normal = vec3(dot(a_model0.xyz, a_normal), dot(a_model1.xyz, a_normal), dot(a_model2.xyz, a_normal));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            layout(std140) uniform Material { vec4 u_albedo; };
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
+
+            in vec3 v_normal;
+            out vec4 o_color;
+
+            void main () {
+                vec3 n = normalize(v_normal);
+                vec3 color = vec3(0);
+                for (int i = 0; i < SHADING_ITERATIONS; ++i) {
+                    float angle = float(i) * 2.39996 + cc_time.x;
+                    vec3 l = normalize(vec3(cos(angle), sin(angle), 1.5));
+                    color += max(dot(n, l), 0.0) * (0.6 + 0.4 * cos(vec3(0.0, 2.1, 4.2) + float(i)));
+                }
+                o_color = vec4(u_albedo.rgb * color * (2.0 / float(SHADING_ITERATIONS)), 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            attribute vec3 a_normal;
+            attribute vec4 a_model0;
+            attribute vec4 a_model1;
+            attribute vec4 a_model2;
+            uniform mat4 cc_matViewProj;
+            varying vec3 v_normal;
+
+            invariant gl_Position;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_normal = vec3(dot(a_model0.xyz, a_normal), dot(a_model1.xyz, a_normal), dot(a_model2.xyz, a_normal));
+                gl_Position = cc_matViewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            uniform vec4 u_albedo;
+            uniform vec4 cc_time;
+            varying vec3 v_normal;
+
+            void main () {
+                vec3 n = normalize(v_normal);
+                vec3 color = vec3(0);
+                for (int i = 0; i < SHADING_ITERATIONS; ++i) {
+                    float angle = float(i) * 2.39996 + cc_time.x;
+                    vec3 l = normalize(vec3(cos(angle), sin(angle), 1.5));
+                    color += max(dot(n, l), 0.0) * (0.6 + 0.4 * cos(vec3(0.0, 2.1, 4.2) + float(i)));
+                }
+                gl_FragColor = vec4(u_albedo.rgb * color * (2.0 / float(SHADING_ITERATIONS)), 1);
+            }
+        )",
+    };
+
+    gfx::AttributeList prepassAttributes = {
+        {"a_position", gfx::Format::RGB32F, false, 0, false, 0},
+        {"a_model0", gfx::Format::RGBA32F, false, 1, true, 1},
+        {"a_model1", gfx::Format::RGBA32F, false, 1, true, 2},
+        {"a_model2", gfx::Format::RGBA32F, false, 1, true, 3},
+    };
+    gfx::AttributeList attributes = {
+        {"a_position", gfx::Format::RGB32F, false, 0, false, 0},
+        {"a_normal", gfx::Format::RGB32F, false, 1, false, 1},
+        {"a_model0", gfx::Format::RGBA32F, false, 2, true, 2},
+        {"a_model1", gfx::Format::RGBA32F, false, 2, true, 3},
+        {"a_model2", gfx::Format::RGBA32F, false, 2, true, 4},
+    };
+
+    auto buildShader = [&](const char *name, ShaderSources &shaderSources, const gfx::AttributeList &attributeList,
+                            const gfx::UniformBlockList &uniformBlockList, const String &fragmentDefines) {
+        ShaderSource &source = TestBaseI::getAppropriateShaderSource(shaderSources);
+
+        gfx::ShaderStageList shaderStageList;
+        gfx::ShaderStage vertexShaderStage;
+        vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+        vertexShaderStage.source = source.vert;
+        shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+        gfx::ShaderStage fragmentShaderStage;
+        fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+        fragmentShaderStage.source = fragmentDefines + source.frag;
+        shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+        gfx::ShaderInfo shaderInfo;
+        shaderInfo.name = name;
+        shaderInfo.stages = std::move(shaderStageList);
+        shaderInfo.attributes = attributeList;
+        shaderInfo.blocks = uniformBlockList;
+        return _device->createShader(shaderInfo);
+    };
+
+    _prepassShader = buildShader("Depth Prepass Test Prepass", prepassSources, prepassAttributes, {TestBaseI::getGlobalUniformBlock()}, "");
+    _shader = buildShader("Depth Prepass Test", sources, attributes,
+                          {{0, 0, "Material", {{"u_albedo", gfx::Type::FLOAT4, 1}}, 1}, TestBaseI::getGlobalUniformBlock()},
+                          "#define SHADING_ITERATIONS " + std::to_string(SHADING_ITERATIONS) + "\n");
+}
+
+void DepthPrepassTest::createBuffers() {
+    Mesh mesh;
+    bool valid = mesh.initWithFile("bunny.mesh");
+    CCASSERT(valid, "DepthPrepassTest load mesh failed");
+
+    MeshData bunny;
+    bunny.initWithMesh(mesh);
+    bunny.optimize("DepthPrepassTest");
+    vector<uint8_t> indices = bunny.packIndices();
+    _triangleCount = static_cast<uint>(bunny.indices.size() / 3u);
+
+    // area weighted vertex normals, only the shading pass fetches them
+    vector<float> normals(bunny.positions.size(), 0.0f);
+    for (size_t i = 0u; i + 2u < bunny.indices.size(); i += 3u) {
+        const float *p0 = &bunny.positions[bunny.indices[i] * 3u];
+        const float *p1 = &bunny.positions[bunny.indices[i + 1u] * 3u];
+        const float *p2 = &bunny.positions[bunny.indices[i + 2u] * 3u];
+        Vec3 normal;
+        Vec3::cross(Vec3(p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]), Vec3(p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]), &normal);
+        for (uint v = 0u; v < 3u; ++v) {
+            float *dst = &normals[bunny.indices[i + v] * 3u];
+            dst[0] += normal.x;
+            dst[1] += normal.y;
+            dst[2] += normal.z;
+        }
+    }
+    for (size_t i = 0u; i < normals.size(); i += 3u) {
+        Vec3 normal(normals[i], normals[i + 1u], normals[i + 2u]);
+        normal.normalize();
+        normals[i] = normal.x;
+        normals[i + 1u] = normal.y;
+        normals[i + 2u] = normal.z;
+    }
+
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(bunny.positions.size() * sizeof(float)),
+        3 * sizeof(float),
+    });
+    _vertexBuffer->update(bunny.positions.data(), 0, static_cast<uint>(bunny.positions.size() * sizeof(float)));
+
+    _normalBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(normals.size() * sizeof(float)),
+        3 * sizeof(float),
+    });
+    _normalBuffer->update(normals.data(), 0, static_cast<uint>(normals.size() * sizeof(float)));
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(indices.size()),
+        bunny.getIndexStride(),
+    });
+    _indexBuffer->update(indices.data(), 0, static_cast<uint>(indices.size()));
+
+    Vec3 boundsMin(FLT_MAX, FLT_MAX, FLT_MAX), boundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (size_t i = 0u; i < bunny.positions.size(); i += 3u) {
+        boundsMin.set(std::min(boundsMin.x, bunny.positions[i]), std::min(boundsMin.y, bunny.positions[i + 1u]), std::min(boundsMin.z, bunny.positions[i + 2u]));
+        boundsMax.set(std::max(boundsMax.x, bunny.positions[i]), std::max(boundsMax.y, bunny.positions[i + 1u]), std::max(boundsMax.z, bunny.positions[i + 2u]));
+    }
+    Vec3 center = (boundsMin + boundsMax) * 0.5f;
+    float size = std::max(boundsMax.x - boundsMin.x, boundsMax.y - boundsMin.y);
+    float depth = boundsMax.z - boundsMin.z;
+
+    // camera at the origin looking down -z; every layer is scaled with its distance so its grid of
+    // oversized bunnies covers the view, and the next layer starts right behind it
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    float aspect = 1.0f * orientedSize.width / orientedSize.height;
+    uint columns = static_cast<uint>(std::ceil(LAYER_ROWS * aspect)) + 1u;
+    float cellPerDistance = 2.0f * std::tan(math::PI / 6.0f) / LAYER_ROWS;
+    float scalePerDistance = cellPerDistance * 1.5f / size;
+
+    vector<float> distances(LAYER_COUNT);
+    float distance = 10.0f;
+    for (uint layer = 0u; layer < LAYER_COUNT; ++layer) {
+        distances[layer] = distance;
+        distance += depth * scalePerDistance * distance;
+    }
+    _farthest = distance;
+
+    SeededRandom random;
+    _instanceCount = LAYER_COUNT * LAYER_ROWS * columns;
+    vector<float> instances(_instanceCount * 12u);
+    float *dst = instances.data();
+    for (uint i = 0u; i < LAYER_COUNT; ++i) {
+        uint layer = DRAW_BACK_TO_FRONT ? LAYER_COUNT - 1u - i : i;
+        float cell = cellPerDistance * distances[layer];
+        float scale = scalePerDistance * distances[layer];
+        for (uint row = 0u; row < LAYER_ROWS; ++row) {
+            for (uint column = 0u; column < columns; ++column) {
+                Mat4 model;
+                Mat4::createTranslation((column - 0.5f * (columns - 1u) + random.range(-0.25f, 0.25f)) * cell,
+                                        (row - 0.5f * (LAYER_ROWS - 1u) + random.range(-0.25f, 0.25f)) * cell,
+                                        -distances[layer], &model);
+                model.rotateY(random.range(-0.5f, 0.5f));
+                model.scale(scale);
+                model.translate(-center.x, -center.y, -center.z);
+
+                for (uint r = 0u; r < 3u; ++r, dst += 4) {
+                    dst[0] = model.m[r];
+                    dst[1] = model.m[4u + r];
+                    dst[2] = model.m[8u + r];
+                    dst[3] = model.m[12u + r];
+                }
+            }
+        }
+    }
+    _instanceBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(instances.size() * sizeof(float)),
+        INSTANCE_STRIDE,
+    });
+    _instanceBuffer->update(instances.data(), 0, static_cast<uint>(instances.size() * sizeof(float)));
+
+    _materialBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE,
+        TestBaseI::getUBOSize(sizeof(Vec4)),
+    });
+    Vec4 albedo(0.9f, 0.8f, 0.7f, 1.0f);
+    _materialBuffer->update(&albedo, 0, sizeof(albedo));
+
+    TestBaseI::setPerspectiveCamera(60.0f, 1.0f, _farthest * 1.5f);
+}
+
+void DepthPrepassTest::createInputAssembler() {
+    // the prepass only fetches positions and transforms
+    gfx::InputAssemblerInfo prepassInfo;
+    prepassInfo.attributes.push_back({"a_position", gfx::Format::RGB32F, false, 0, false});
+    prepassInfo.attributes.push_back({"a_model0", gfx::Format::RGBA32F, false, 1, true});
+    prepassInfo.attributes.push_back({"a_model1", gfx::Format::RGBA32F, false, 1, true});
+    prepassInfo.attributes.push_back({"a_model2", gfx::Format::RGBA32F, false, 1, true});
+    prepassInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    prepassInfo.vertexBuffers.emplace_back(_instanceBuffer);
+    prepassInfo.indexBuffer = _indexBuffer;
+    _prepassInputAssembler = _device->createInputAssembler(prepassInfo);
+    _prepassInputAssembler->setInstanceCount(_instanceCount);
+
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.push_back({"a_position", gfx::Format::RGB32F, false, 0, false});
+    inputAssemblerInfo.attributes.push_back({"a_normal", gfx::Format::RGB32F, false, 1, false});
+    inputAssemblerInfo.attributes.push_back({"a_model0", gfx::Format::RGBA32F, false, 2, true});
+    inputAssemblerInfo.attributes.push_back({"a_model1", gfx::Format::RGBA32F, false, 2, true});
+    inputAssemblerInfo.attributes.push_back({"a_model2", gfx::Format::RGBA32F, false, 2, true});
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    inputAssemblerInfo.vertexBuffers.emplace_back(_normalBuffer);
+    inputAssemblerInfo.vertexBuffers.emplace_back(_instanceBuffer);
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+    _inputAssembler->setInstanceCount(_instanceCount);
+}
+
+void DepthPrepassTest::createPipelineState() {
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout, TestBaseI::getGlobalDescriptorSetLayout()}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(0, _materialBuffer);
+    _descriptorSet->update();
+
+    gfx::PipelineStateInfo prepassInfo;
+    prepassInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    prepassInfo.shader = _prepassShader;
+    prepassInfo.inputState = {_prepassInputAssembler->getAttributes()};
+    prepassInfo.renderPass = _fbo->getRenderPass();
+    prepassInfo.depthStencilState.depthTest = true;
+    prepassInfo.depthStencilState.depthWrite = true;
+    prepassInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    prepassInfo.blendState.targets[0].blendColorMask = gfx::ColorMask::NONE;
+    prepassInfo.pipelineLayout = _pipelineLayout;
+    _prepassPipelineState = _device->createPipelineState(prepassInfo);
+
+    gfx::PipelineStateInfo pipelineStateInfo;
+    pipelineStateInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineStateInfo.shader = _shader;
+    pipelineStateInfo.inputState = {_inputAssembler->getAttributes()};
+    pipelineStateInfo.renderPass = _fbo->getRenderPass();
+    pipelineStateInfo.depthStencilState.depthTest = true;
+    pipelineStateInfo.depthStencilState.depthWrite = true;
+    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineStateInfo.pipelineLayout = _pipelineLayout;
+    _lessPipelineState = _device->createPipelineState(pipelineStateInfo);
+
+    // only the nearest surface matches the prepass depth, so every pixel is shaded once
+    pipelineStateInfo.depthStencilState.depthWrite = false;
+    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::EQUAL;
+    _equalPipelineState = _device->createPipelineState(pipelineStateInfo);
+}
+
+void DepthPrepassTest::tick() {
+    lookupTime();
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    TestBaseI::updateGlobals();
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("DepthPrepassTest", _fbo, renderArea);
+    commandBuffer->bindDescriptorSet(0, _descriptorSet);
+    TestBaseI::bindGlobals(commandBuffer);
+
+    if (_prepass) {
+        commandBuffer->bindInputAssembler(_prepassInputAssembler);
+        commandBuffer->bindPipelineState(_prepassPipelineState);
+        commandBuffer->draw(_prepassInputAssembler);
+    }
+    commandBuffer->bindInputAssembler(_inputAssembler);
+    commandBuffer->bindPipelineState(_prepass ? _equalPipelineState : _lessPipelineState);
+    commandBuffer->draw(_inputAssembler);
+
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+
+    // frame time follows the GPU only while the GPU is the bottleneck, raise SHADING_ITERATIONS until it is;
+    // the passes share one submission, so what the prepass costs or saves only shows against the other mode
+    _statsFrameTime += hostThread.dt;
+    if (++_statsFrames == 60u) {
+        _lastFrameTime[_prepass] = _statsFrameTime * 1000.f / _statsFrames;
+        CC_LOG_INFO("DepthPrepassTest (prepass %s, %s): %u layers, %u bunnies, %.1fM triangles per pass, %u lights per fragment | "
+                    "%.3fms frame, %.3fms with the prepass %s last window",
+                    _prepass ? "on" : "off", DRAW_BACK_TO_FRONT ? "back to front" : "front to back", LAYER_COUNT, _instanceCount,
+                    _instanceCount * _triangleCount * 1e-6f, SHADING_ITERATIONS, _lastFrameTime[_prepass],
+                    _lastFrameTime[!_prepass], _prepass ? "off" : "on");
+        _statsFrames = 0u;
+        _statsFrameTime = 0.0f;
+        if (ALTERNATE_DEPTH_PREPASS) _prepass = !_prepass;
+    }
+}
+
+} // namespace cc
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+class DepthPrepassTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(DepthPrepassTest)
+    DepthPrepassTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~DepthPrepassTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    void createShader();
+    void createBuffers();
+    void createInputAssembler();
+    void createPipelineState();
+
+    gfx::Shader* _prepassShader = nullptr;
+    gfx::Shader* _shader = nullptr;
+    gfx::Buffer* _vertexBuffer = nullptr;
+    gfx::Buffer* _normalBuffer = nullptr;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::Buffer* _instanceBuffer = nullptr;
+    gfx::Buffer* _materialBuffer = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::InputAssembler* _prepassInputAssembler = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+    gfx::PipelineState* _prepassPipelineState = nullptr;
+    gfx::PipelineState* _equalPipelineState = nullptr; // shading after the prepass
+    gfx::PipelineState* _lessPipelineState = nullptr;  // shading on its own
+
+    uint _instanceCount = 0u;
+    uint _triangleCount = 0u;
+    float _farthest = 0.0f;
+    bool _prepass = false;
+
+    uint _statsFrames = 0u;
+    float _statsFrameTime = 0.0f;
+    float _lastFrameTime[2] = {}; // ms of the latest window with the prepass off and on, 0 until measured
+};
+
+} // namespace cc
@@ -1,11 +1,25 @@
 #include "DepthTest.h"
-#include "BunnyData.h"
+#include "MeshOptimizer.h"
+#include "RenderPassAnalyzer.h"
+
+// 1 shares one camera block per frame and packs every model matrix into a single dynamic-offset
+// uniform buffer written with one update, 0 writes model, view and projection into a buffer per bunny
+#define USE_DYNAMIC_UBO 1
+// bunnies on a grid 10 units apart, 2 puts them side by side
+#define BUNNY_COUNT 2u
+// 1 renders the bunnies with reversed-Z and an infinite far plane into a float depth buffer, testing GREATER
+#define USE_REVERSED_Z 0
+// resizes replayed at startup to mimic a window drag and count the render target allocations, 0 skips it
+#define RESIZE_SWEEP_STEPS 120u
+// 1 renders at a resolution that follows the frame time and upscales to the screen
+#define USE_DYNAMIC_RESOLUTION 1
 
 namespace cc {
 
 namespace {
 struct BigTriangle : public cc::Object {
-    BigTriangle(gfx::Device *_device, gfx::Framebuffer *_fbo) : fbo(_fbo), device(_device) {
+    BigTriangle(gfx::Device *_device, gfx::RenderPass *_renderPass, bool _offscreen)
+    : renderPass(_renderPass), device(_device), offscreen(_offscreen) {
         createShader();
         createBuffers();
         createSampler();
@@ -36,13 +50,18 @@ struct BigTriangle : public cc::Object {
                 {
                     float u_near;
                     float u_far;
+                    vec2 u_uvScale;
                 };
                 layout(set = 0, binding = 1) uniform sampler2D u_texture;
                 layout(location = 0) out vec4 o_color;
                 void main() {
-                    float z = texture(u_texture, v_texCoord).x;
+                    float z = texture(u_texture, v_texCoord * u_uvScale).x;
+                #if REVERSED_Z
+                    float viewZ = -u_near / max(z, 1e-4);
+                #else
                     float viewZ = (u_near * u_far) / ((u_far - u_near) * z - u_far);
-                    float depth = (viewZ + u_near) / (u_near - u_far);
+                #endif
+                    float depth = min((viewZ + u_near) / (u_near - u_far), 1.0);
 
                     o_color.rgb = vec3(depth);
                     o_color.a = 1.0;
@@ -69,12 +88,17 @@ struct BigTriangle : public cc::Object {
                 layout(std140) uniform Near_Far_Uniform {
                     float u_near;
                     float u_far;
+                    vec2 u_uvScale;
                 };
                 out vec4 o_color;
                 void main() {
-                    float z = texture(u_texture, v_texCoord).x;
+                    float z = texture(u_texture, v_texCoord * u_uvScale).x;
+                #if REVERSED_Z
+                    float viewZ = -u_near / max(z, 1e-4);
+                #else
                     float viewZ = (u_near * u_far) / ((u_far - u_near) * z - u_far);
-                    float depth = (viewZ + u_near) / (u_near - u_far);
+                #endif
+                    float depth = min((viewZ + u_near) / (u_near - u_far), 1.0);
 
                     o_color.rgb = vec3(depth);
                     o_color.a = 1.0;
@@ -100,11 +124,16 @@ struct BigTriangle : public cc::Object {
                 uniform sampler2D u_texture;
                 uniform float u_near;
                 uniform float u_far;
+                uniform vec2 u_uvScale;
 
                 void main() {
-                    float z = texture2D(u_texture, v_texCoord).x;
+                    float z = texture2D(u_texture, v_texCoord * u_uvScale).x;
+                #if REVERSED_Z
+                    float viewZ = -u_near / max(z, 1e-4);
+                #else
                     float viewZ = (u_near * u_far) / ((u_far - u_near) * z - u_far);
-                    float depth = (viewZ + u_near) / (u_near - u_far);
+                #endif
+                    float depth = min((viewZ + u_near) / (u_near - u_far), 1.0);
 
                     gl_FragColor.rgb = vec3(depth);
                     gl_FragColor.a = 1.0;
@@ -122,14 +151,14 @@ struct BigTriangle : public cc::Object {
 
         gfx::ShaderStage fragmentShaderStage;
         fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
-        fragmentShaderStage.source = source.frag;
+        fragmentShaderStage.source = "#define REVERSED_Z " + std::to_string(USE_REVERSED_Z) + "\n" + source.frag;
         shaderStageList.emplace_back(std::move(fragmentShaderStage));
 
         gfx::AttributeList attributeList = {
             {"a_position", gfx::Format::RG32F, false, 0, false, 0},
             {"a_texCoord", gfx::Format::RG32F, false, 0, false, 1},
         };
-        gfx::UniformList nearFarUniform = {{"u_near", gfx::Type::FLOAT, 1}, {"u_far", gfx::Type::FLOAT, 1}};
+        gfx::UniformList nearFarUniform = {{"u_near", gfx::Type::FLOAT, 1}, {"u_far", gfx::Type::FLOAT, 1}, {"u_uvScale", gfx::Type::FLOAT2, 1}};
         gfx::UniformBlockList uniformBlockList = {{0, 0, "Near_Far_Uniform", nearFarUniform, 1}};
         gfx::UniformSamplerList samplers = {{0, 1, "u_texture", gfx::Type::SAMPLER2D, 1}};
 
@@ -150,7 +179,8 @@ struct BigTriangle : public cc::Object {
 
     void createBuffers() {
         // create vertex buffer
-        float ySign = device->getScreenSpaceSignY();
+        // flipped like the offscreen projections when drawn into a target the upscale pass samples
+        float ySign = device->getScreenSpaceSignY() * (offscreen ? device->getUVSpaceSignY() : 1.0f);
         // UV space origin is at top-left
         float vertices[] = {-1, 4 * ySign, 0.0, -1.5,
                             -1, -1 * ySign, 0.0, 1.0,
@@ -168,10 +198,11 @@ struct BigTriangle : public cc::Object {
         nearFarUniformBuffer = device->createBuffer({
             gfx::BufferUsage::UNIFORM,
             gfx::MemoryUsage::DEVICE,
-            TestBaseI::getUBOSize(2 * sizeof(float)),
+            TestBaseI::getUBOSize(4 * sizeof(float)),
         });
 
-        float uboData[] = {0.1f, 100.0f};
+        // the depth target may be larger than the screen, see setDepthTexture
+        float uboData[] = {0.1f, 100.0f, 1.0f, 1.0f};
         nearFarUniformBuffer->update(uboData, 0, sizeof(uboData));
     }
 
@@ -201,7 +232,7 @@ struct BigTriangle : public cc::Object {
         pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo.shader = shader;
         pipelineInfo.inputState.attributes = inputAssembler->getAttributes();
-        pipelineInfo.renderPass = fbo->getRenderPass();
+        pipelineInfo.renderPass = renderPass;
         pipelineInfo.depthStencilState.depthTest = false;
         pipelineInfo.depthStencilState.depthWrite = false;
         pipelineInfo.rasterizerState.cullMode = gfx::CullMode::NONE;
@@ -211,6 +242,12 @@ struct BigTriangle : public cc::Object {
     }
     ~BigTriangle() {}
 
+    void setDepthTexture(gfx::Texture *depthTexture, const Vec2 &uvScale) {
+        descriptorSet->bindTexture(1, depthTexture);
+        descriptorSet->update();
+        nearFarUniformBuffer->update(&uvScale, 2 * sizeof(float), sizeof(uvScale));
+    }
+
     void destroy() {
         CC_SAFE_DESTROY(shader);
         CC_SAFE_DESTROY(vertexBuffer);
@@ -225,7 +262,7 @@ struct BigTriangle : public cc::Object {
     }
 
     gfx::Shader *shader = nullptr;
-    gfx::Framebuffer *fbo = nullptr;
+    gfx::RenderPass *renderPass = nullptr;
     gfx::Buffer *vertexBuffer = nullptr;
     gfx::Buffer *nearFarUniformBuffer = nullptr;
     gfx::Device *device = nullptr;
@@ -236,14 +273,15 @@ struct BigTriangle : public cc::Object {
     gfx::Sampler *sampler = nullptr;
     gfx::Texture *texture = nullptr;
     gfx::PipelineState *pipelineState = nullptr;
+    bool offscreen = false;
 };
 
 struct Bunny : public cc::Object {
-    Bunny(gfx::Device *_device, gfx::Framebuffer *_fbo) : device(_device) {
+    Bunny(gfx::Device *_device, gfx::RenderPass *_renderPass) : device(_device) {
         createShader();
         createBuffers();
         createInputAssembler();
-        createPipeline(_fbo);
+        createPipeline(_renderPass);
     }
 
     ~Bunny() {}
@@ -252,6 +290,23 @@ struct Bunny : public cc::Object {
 
         ShaderSources sources;
         sources.glsl4 = {
+#if USE_DYNAMIC_UBO
+            R"(
+                layout(location = 0) in vec3 a_position;
+                layout(set = 0, binding = 0) uniform Camera {
+                    mat4 u_view;
+                    mat4 u_projection;
+                };
+                layout(set = 0, binding = 1) uniform World {
+                    mat4 u_model;
+                };
+                void main () {
+                    vec4 pos = u_projection * u_view * u_model * vec4(a_position, 1);
+
+                    gl_Position = pos;
+                }
+            )",
+#else
             R"(
                 layout(location = 0) in vec3 a_position;
                 layout(set = 0, binding = 0) uniform MVP_Matrix {
@@ -265,12 +320,30 @@ struct Bunny : public cc::Object {
                     gl_Position = pos;
                 }
             )",
+#endif
             R"(
                 void main () {}
             )",
         };
 
         sources.glsl3 = {
+#if USE_DYNAMIC_UBO
+            R"(
+                in vec3 a_position;
+                layout(std140) uniform Camera {
+                    mat4 u_view;
+                    mat4 u_projection;
+                };
+                layout(std140) uniform World {
+                    mat4 u_model;
+                };
+                void main () {
+                    vec4 pos = u_projection * u_view * u_model * vec4(a_position, 1);
+
+                    gl_Position = pos;
+                }
+            )",
+#else
             R"(
                 in vec3 a_position;
                 layout(std140) uniform MVP_Matrix {
@@ -284,6 +357,7 @@ struct Bunny : public cc::Object {
                     gl_Position = pos;
                 }
             )",
+#endif
             R"(
                 precision mediump float;
                 void main () {}
@@ -323,12 +397,23 @@ struct Bunny : public cc::Object {
         shaderStageList.emplace_back(std::move(fragmentShaderStage));
 
         gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
+#if USE_DYNAMIC_UBO
+        gfx::UniformList camera = {
+            {"u_view", gfx::Type::MAT4, 1},
+            {"u_projection", gfx::Type::MAT4, 1},
+        };
+        gfx::UniformBlockList uniformBlockList = {
+            {0, 0, "Camera", camera, 1},
+            {0, 1, "World", {{"u_model", gfx::Type::MAT4, 1}}, 1},
+        };
+#else
         gfx::UniformList mvpMatrix = {
             {"u_model", gfx::Type::MAT4, 1},
             {"u_view", gfx::Type::MAT4, 1},
             {"u_projection", gfx::Type::MAT4, 1},
         };
         gfx::UniformBlockList uniformBlockList = {{0, 0, "MVP_Matrix", mvpMatrix, 1}};
+#endif
 
         gfx::ShaderInfo shaderInfo;
         shaderInfo.name = "Bunny";
@@ -339,24 +424,31 @@ struct Bunny : public cc::Object {
     }
 
     void createBuffers() {
-        // vertex buffer
-        vertexBuffer = device->createBuffer({
-            gfx::BufferUsage::VERTEX,
-            gfx::MemoryUsage::DEVICE,
-            sizeof(bunny_positions),
-            3 * sizeof(float),
-        });
-        vertexBuffer->update((void *)&bunny_positions[0][0], 0, sizeof(bunny_positions));
+        bool valid = createMeshBuffers(device, "bunny.mesh", "DepthTest", vertexBuffer, indexBuffer, lods);
+        CCASSERT(valid, "DepthTest load mesh failed");
 
-        // index buffer
-        indexBuffer = device->createBuffer({
-            gfx::BufferUsage::INDEX,
-            gfx::MemoryUsage::DEVICE,
-            sizeof(bunny_cells),
-            sizeof(unsigned short),
+#if USE_DYNAMIC_UBO
+        cameraUniformBuffer = device->createBuffer({
+            gfx::BufferUsage::UNIFORM,
+            gfx::MemoryUsage::HOST | gfx::MemoryUsage::DEVICE,
+            TestBaseI::getUBOSize(2 * sizeof(Mat4)),
         });
-        indexBuffer->update((void *)&bunny_cells[0], 0, sizeof(bunny_cells));
 
+        // one aligned slot per bunny, the draws pick theirs by dynamic offset
+        worldStride = TestBaseI::getAlignedUBOStride(device, sizeof(Mat4));
+        worldUniformBuffer = device->createBuffer({
+            gfx::BufferUsage::UNIFORM,
+            gfx::MemoryUsage::HOST | gfx::MemoryUsage::DEVICE,
+            TestBaseI::getUBOSize(worldStride * BUNNY_NUM),
+            worldStride,
+        });
+        worldUniformBufferView = device->createBuffer({
+            worldUniformBuffer,
+            0,
+            sizeof(Mat4),
+        });
+        worldData.resize(worldStride / sizeof(float) * BUNNY_NUM);
+#else
         // uniform buffer
         // create uniform buffer
         gfx::BufferInfo uniformBufferInfo = {
@@ -366,6 +458,7 @@ struct Bunny : public cc::Object {
         };
         for (uint i = 0; i < BUNNY_NUM; i++)
             mvpUniformBuffer[i] = device->createBuffer(uniformBufferInfo);
+#endif
     }
 
     void createInputAssembler() {
@@ -377,28 +470,38 @@ struct Bunny : public cc::Object {
         inputAssembler = device->createInputAssembler(inputAssemblerInfo);
     }
 
-    void createPipeline(gfx::Framebuffer *_fbo) {
+    void createPipeline(gfx::RenderPass *_renderPass) {
         gfx::DescriptorSetLayoutInfo dslInfo;
         dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+#if USE_DYNAMIC_UBO
+        dslInfo.bindings.push_back({1, gfx::DescriptorType::DYNAMIC_UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+#endif
         descriptorSetLayout = device->createDescriptorSetLayout(dslInfo);
 
         pipelineLayout = device->createPipelineLayout({{descriptorSetLayout}});
 
+#if USE_DYNAMIC_UBO
+        descriptorSet[0] = device->createDescriptorSet({descriptorSetLayout});
+        descriptorSet[0]->bindBuffer(0, cameraUniformBuffer);
+        descriptorSet[0]->bindBuffer(1, worldUniformBufferView);
+        descriptorSet[0]->update();
+#else
         for (uint i = 0u; i < BUNNY_NUM; i++) {
             descriptorSet[i] = device->createDescriptorSet({descriptorSetLayout});
 
             descriptorSet[i]->bindBuffer(0, mvpUniformBuffer[i]);
             descriptorSet[i]->update();
         }
+#endif
 
         gfx::PipelineStateInfo pipelineInfo;
         pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
         pipelineInfo.shader = shader;
         pipelineInfo.inputState = {inputAssembler->getAttributes()};
-        pipelineInfo.renderPass = _fbo->getRenderPass();
+        pipelineInfo.renderPass = _renderPass;
         pipelineInfo.depthStencilState.depthTest = true;
         pipelineInfo.depthStencilState.depthWrite = true;
-        pipelineInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+        pipelineInfo.depthStencilState.depthFunc = USE_REVERSED_Z ? gfx::ComparisonFunc::GREATER : gfx::ComparisonFunc::LESS;
         pipelineInfo.pipelineLayout = pipelineLayout;
 
         pipelineState = device->createPipelineState(pipelineInfo);
@@ -415,11 +518,14 @@ struct Bunny : public cc::Object {
             CC_SAFE_DESTROY(mvpUniformBuffer[i]);
             CC_SAFE_DESTROY(descriptorSet[i]);
         }
+        CC_SAFE_DESTROY(cameraUniformBuffer);
+        CC_SAFE_DESTROY(worldUniformBufferView);
+        CC_SAFE_DESTROY(worldUniformBuffer);
         CC_SAFE_DESTROY(descriptorSetLayout);
         CC_SAFE_DESTROY(pipelineLayout);
         CC_SAFE_DESTROY(pipelineState);
     }
-    const static uint BUNNY_NUM = 2;
+    const static uint BUNNY_NUM = BUNNY_COUNT;
     gfx::Device *device = nullptr;
     gfx::Shader *shader = nullptr;
     gfx::Buffer *vertexBuffer = nullptr;
@@ -429,8 +535,15 @@ struct Bunny : public cc::Object {
     gfx::InputAssembler *inputAssembler = nullptr;
     gfx::DescriptorSetLayout *descriptorSetLayout = nullptr;
     gfx::PipelineLayout *pipelineLayout = nullptr;
-    gfx::Buffer *mvpUniformBuffer[BUNNY_NUM] = {nullptr, nullptr};
-    gfx::DescriptorSet *descriptorSet[BUNNY_NUM] = {nullptr, nullptr};
+    gfx::Buffer *mvpUniformBuffer[BUNNY_NUM] = {};
+    gfx::DescriptorSet *descriptorSet[BUNNY_NUM] = {}; // only the first is used with USE_DYNAMIC_UBO
+    gfx::Buffer *cameraUniformBuffer = nullptr;
+    gfx::Buffer *worldUniformBuffer = nullptr;
+    gfx::Buffer *worldUniformBufferView = nullptr;
+    vector<float> worldData; // host copy of worldUniformBuffer, written whole each frame
+    uint worldStride = 0u;
+    vector<MeshLod> lods;
+    uint lod[BUNNY_NUM] = {};
     gfx::PipelineState *pipelineState = nullptr;
 };
 
@@ -441,44 +554,109 @@ Bunny *bunny;
 void DepthTexture::destroy() {
     CC_SAFE_DESTROY(bg);
     CC_SAFE_DESTROY(bunny);
-    CC_SAFE_DELETE(_bunnyFBO);
+    CC_SAFE_DELETE(_dynamicResolution);
+    CC_SAFE_DELETE(_frameGraph);
 }
 
 bool DepthTexture::initialize() {
-    _bunnyFBO = CC_NEW(Framebuffer);
-
-    gfx::RenderPassInfo renderPassInfo;
-
-    gfx::DepthStencilAttachment &depthStencilAttachment = renderPassInfo.depthStencilAttachment;
-    depthStencilAttachment.format = _device->getDepthStencilFormat();
-    depthStencilAttachment.depthLoadOp = gfx::LoadOp::CLEAR;
-    depthStencilAttachment.depthStoreOp = gfx::StoreOp::STORE;
-    depthStencilAttachment.stencilLoadOp = gfx::LoadOp::CLEAR;
-    depthStencilAttachment.stencilStoreOp = gfx::StoreOp::STORE;
-    depthStencilAttachment.sampleCount = 1;
-    depthStencilAttachment.beginLayout = gfx::TextureLayout::UNDEFINED;
-    depthStencilAttachment.endLayout = gfx::TextureLayout::SHADER_READONLY_OPTIMAL;
-
-    _bunnyFBO->renderPass = _device->createRenderPass(renderPassInfo);
-
-    gfx::TextureInfo depthStecnilTexInfo;
-    depthStecnilTexInfo.type = gfx::TextureType::TEX2D;
-    depthStecnilTexInfo.usage = gfx::TextureUsageBit::DEPTH_STENCIL_ATTACHMENT | gfx::TextureUsageBit::SAMPLED;
-    depthStecnilTexInfo.format = _device->getDepthStencilFormat();
-    depthStecnilTexInfo.width = _device->getWidth();
-    depthStecnilTexInfo.height = _device->getHeight();
-    _bunnyFBO->depthStencilTex = _device->createTexture(depthStecnilTexInfo);
-
-    gfx::FramebufferInfo fboInfo;
-    fboInfo.renderPass = _bunnyFBO->renderPass;
-    fboInfo.depthStencilTexture = _bunnyFBO->depthStencilTex;
-    _bunnyFBO->framebuffer = _device->createFramebuffer(fboInfo);
-
-    bunny = CC_NEW(Bunny(_device, _bunnyFBO->framebuffer));
-    bg = CC_NEW(BigTriangle(_device, _fbo));
-
-    bg->descriptorSet->bindTexture(1, _bunnyFBO->depthStencilTex);
-    bg->descriptorSet->update();
+    // reversed-Z only pays off with a float buffer, where precision is densest next to the far value 0
+    gfx::Format depthFormat = _device->getDepthStencilFormat();
+    if (USE_REVERSED_Z && _device->hasFeature(gfx::Feature::FORMAT_D32F)) depthFormat = gfx::Format::D32F;
+
+    // the bunnies' depth is sampled by the full screen pass that draws it, the graph works out the rest
+    _frameGraph = CC_NEW(FrameGraph(_device));
+    _depthTexture = _frameGraph->createTexture("bunny depth", depthFormat);
+
+    FrameGraph::Handle bunnyPass = _frameGraph->addPass("bunny", [](gfx::CommandBuffer *commandBuffer) {
+        commandBuffer->bindPipelineState(bunny->pipelineState);
+        commandBuffer->bindInputAssembler(bunny->inputAssembler);
+        for (uint i = 0; i < Bunny::BUNNY_NUM; i++) {
+            const MeshLod &lod = bunny->lods[bunny->lod[i]];
+            bunny->inputAssembler->setFirstIndex(lod.firstIndex);
+            bunny->inputAssembler->setIndexCount(lod.indexCount);
+#if USE_DYNAMIC_UBO
+            uint dynamicOffset = i * bunny->worldStride;
+            commandBuffer->bindDescriptorSet(0, bunny->descriptorSet[0], 1, &dynamicOffset);
+#else
+            commandBuffer->bindDescriptorSet(0, bunny->descriptorSet[i]);
+#endif
+            commandBuffer->draw(bunny->inputAssembler);
+        }
+    });
+    _frameGraph->writeDepthStencil(bunnyPass, _depthTexture, true, USE_REVERSED_Z ? 0.0f : 1.0f);
+
+    FrameGraph::Handle depthViewPass = _frameGraph->addPass("depth view", [](gfx::CommandBuffer *commandBuffer) {
+        commandBuffer->bindInputAssembler(bg->inputAssembler);
+        commandBuffer->bindPipelineState(bg->pipelineState);
+        commandBuffer->bindDescriptorSet(0, bg->descriptorSet);
+        commandBuffer->draw(bg->inputAssembler);
+        TestBaseI::getRenderPassAnalyzer()->draw(true);
+    });
+    _frameGraph->read(depthViewPass, _depthTexture);
+#if USE_DYNAMIC_RESOLUTION
+    FrameGraph::Handle sceneColor = _frameGraph->createTexture("scene color", _device->getColorFormat());
+    // the depth view covers the screen, so the color is never cleared
+    _frameGraph->writeColor(depthViewPass, sceneColor);
+
+    _dynamicResolution = CC_NEW(DynamicResolution(_device, _frameGraph, "DepthTest"));
+    _dynamicResolution->addTarget(_depthTexture);
+    _dynamicResolution->addTarget(sceneColor);
+    _dynamicResolution->addUpscalePass(sceneColor);
+#else
+    _frameGraph->writeColor(depthViewPass, FrameGraph::BACKBUFFER);
+#endif
+
+    _frameGraph->compile();
+#if USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->initialize();
+#endif
+
+    bunny = CC_NEW(Bunny(_device, _frameGraph->getRenderPass(bunnyPass)));
+    bg = CC_NEW(BigTriangle(_device, _frameGraph->getRenderPass(depthViewPass), USE_DYNAMIC_RESOLUTION));
+
+    bg->setDepthTexture(_frameGraph->getTexture(_depthTexture), _frameGraph->getUVScale(_depthTexture));
+
+#if RESIZE_SWEEP_STEPS
+    // drag the window corner in to half size and back out with some jitter, as WM_SIZE would report it
+    RenderTargetPool &pool = _frameGraph->getRenderTargetPool();
+    pool.resetStats();
+    uint width = _device->getWidth();
+    uint height = _device->getHeight();
+    for (uint i = 1u; i <= RESIZE_SWEEP_STEPS; ++i) {
+        float t = 1.0f - std::abs(2.0f * i / RESIZE_SWEEP_STEPS - 1.0f);
+        float scale = 1.0f - 0.5f * t;
+        uint jitter = (i * 7u) % 5u;
+        _frameGraph->resize(static_cast<uint>(width * scale) + jitter, static_cast<uint>(height * scale) + jitter);
+    }
+    _frameGraph->resize(width, height);
+    // resizing each texture and rebuilding its framebuffer every time was two allocations per target per resize
+    uint allocations = pool.getTextureAllocations() + pool.getFramebufferAllocations();
+    uint unpooled = 2u * _frameGraph->getTextureCount() * (RESIZE_SWEEP_STEPS + 1u);
+    CC_LOG_INFO("DepthTest resize sweep: %u resizes, %u of %u render target and %u of %u framebuffer requests allocated, %u of %u allocations avoided",
+                RESIZE_SWEEP_STEPS + 1u, pool.getTextureAllocations(), pool.getTextureRequests(),
+                pool.getFramebufferAllocations(), pool.getFramebufferRequests(), unpooled - allocations, unpooled);
+    bg->setDepthTexture(_frameGraph->getTexture(_depthTexture), _frameGraph->getUVScale(_depthTexture));
+#if USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->updateBindings();
+#endif
+#endif
+
+#if USE_REVERSED_Z
+    // window depth should come out as near / distance whatever getClipSpaceMinZ is; with -1 the
+    // remap to [0, 1] happens after the divide, so far away depth loses the precision float had
+    float minZ = _device->getClipSpaceMinZ();
+    Mat4 projection;
+    TestBaseI::createPerspective(45.f, 1.0f, 0.1f, std::numeric_limits<float>::infinity(), &projection, true, true);
+    float maxError = 0.0f;
+    for (float distance : {0.1f, 1.0f, 100.0f, 10000.0f}) {
+        float z = projection.m[10] * -distance + projection.m[14];
+        float w = projection.m[11] * -distance + projection.m[15];
+        float depth = minZ < 0.0f ? z / w * 0.5f + 0.5f : z / w;
+        maxError = std::max(maxError, std::abs(depth * distance / 0.1f - 1.0f));
+    }
+    CC_LOG_INFO("DepthTest reversed-Z: %s depth, clip space min z %.0f, window depth within %.2g of near / distance up to 10km",
+                depthFormat == gfx::Format::D32F ? "float" : "fixed point", minZ, maxError);
+#endif
 
     return true;
 }
@@ -486,68 +664,90 @@ bool DepthTexture::initialize() {
 void DepthTexture::resize(uint width, uint height) {
     TestBaseI::resize(width, height);
 
-    _bunnyFBO->depthStencilTex->resize(width, height);
-
-    gfx::FramebufferInfo fboInfo;
-    fboInfo.renderPass = _bunnyFBO->renderPass;
-    fboInfo.depthStencilTexture = _bunnyFBO->depthStencilTex;
-
-    _bunnyFBO->framebuffer->destroy();
-    _bunnyFBO->framebuffer->initialize(fboInfo);
+    _frameGraph->resize(width, height);
+    bg->setDepthTexture(_frameGraph->getTexture(_depthTexture), _frameGraph->getUVScale(_depthTexture));
+#if USE_DYNAMIC_RESOLUTION
+    _dynamicResolution->updateBindings();
+#endif
 }
 
 void DepthTexture::tick() {
     lookupTime();
     _dt += hostThread.dt;
 
+#if USE_DYNAMIC_RESOLUTION
+    if (_dynamicResolution->update(hostThread.dt)) {
+        bg->setDepthTexture(_frameGraph->getTexture(_depthTexture), _frameGraph->getUVScale(_depthTexture));
+    }
+    float renderScale = _dynamicResolution->getScale();
+#else
+    float renderScale = 1.0f;
+#endif
+
     _eye.set(30.f * std::cos(_dt), 20.f, 30.f * std::sin(_dt));
     _center.set(0, 2.5f, 0);
     _up.set(0, 1.f, 0);
     Mat4::createLookAt(_eye, _center, _up, &_view);
     gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+#if USE_REVERSED_Z
+    TestBaseI::createPerspective(45.f, 1.0f * orientedSize.width / orientedSize.height, 0.1f, std::numeric_limits<float>::infinity(), &_projection, true, true);
+#else
     TestBaseI::createPerspective(45.f, 1.0f * orientedSize.width / orientedSize.height, 0.1f, 100.f, &_projection, true);
-
-    gfx::Color clearColor = {1.0, 0, 0, 1.0f};
+#endif
 
     _device->acquire();
 
+    auto start = std::chrono::steady_clock::now();
+#if USE_DYNAMIC_UBO
+    Mat4 camera[2] = {_view, _projection};
+    bunny->cameraUniformBuffer->update(camera, 0, sizeof(camera));
+    _statsUpdates++;
+    _statsBytes += sizeof(camera);
+#endif
+    uint columns = static_cast<uint>(std::ceil(std::sqrt(static_cast<float>(Bunny::BUNNY_NUM))));
+    uint rows = (Bunny::BUNNY_NUM + columns - 1u) / columns;
     for (uint i = 0; i < Bunny::BUNNY_NUM; i++) {
         _model = Mat4::IDENTITY;
-        if (i % 2 == 0)
-            _model.translate(5, 0, 0);
-        else
-            _model.translate(-5, 0, 0);
+        _model.translate(10.0f * (i % columns) - 5.0f * (columns - 1u), 0, 10.0f * (i / columns) - 5.0f * (rows - 1u));
+#if USE_DYNAMIC_UBO
+        std::copy(_model.m, _model.m + 16, &bunny->worldData[i * bunny->worldStride / sizeof(float)]);
+#else
         bunny->mvpUniformBuffer[i]->update(_model.m, 0, sizeof(_model));
         bunny->mvpUniformBuffer[i]->update(_view.m, sizeof(_model), sizeof(_view));
         bunny->mvpUniformBuffer[i]->update(_projection.m, sizeof(_model) + sizeof(_view), sizeof(_projection));
+        _statsUpdates += 3u;
+        _statsBytes += 3u * sizeof(Mat4);
+#endif
+
+        Vec3 position(_model.m[12], _model.m[13], _model.m[14]);
+        bunny->lod[i] = selectMeshLod(bunny->lods, _eye.distance(position), math::PI / 4.0f, orientedSize.height * renderScale);
     }
-    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+#if USE_DYNAMIC_UBO
+    bunny->worldUniformBuffer->update(bunny->worldData.data(), 0, bunny->worldStride * Bunny::BUNNY_NUM);
+    _statsUpdates++;
+    _statsBytes += bunny->worldStride * Bunny::BUNNY_NUM;
+#endif
+    _statsUpdateTime += TestBaseI::millisecondsSince(start);
 
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
 
-    // render bunny
-    commandBuffer->beginRenderPass(_bunnyFBO->renderPass, _bunnyFBO->framebuffer, renderArea, nullptr, 1.0f, 0);
-    commandBuffer->bindPipelineState(bunny->pipelineState);
-    commandBuffer->bindInputAssembler(bunny->inputAssembler);
-    for (uint i = 0; i < Bunny::BUNNY_NUM; i++) {
-        commandBuffer->bindDescriptorSet(0, bunny->descriptorSet[i]);
-        commandBuffer->draw(bunny->inputAssembler);
-    }
-    commandBuffer->endRenderPass();
-
-    // render bg
-    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
-    commandBuffer->bindInputAssembler(bg->inputAssembler);
-    commandBuffer->bindPipelineState(bg->pipelineState);
-    commandBuffer->bindDescriptorSet(0, bg->descriptorSet);
-    commandBuffer->draw(bg->inputAssembler);
-    commandBuffer->endRenderPass();
+    _frameGraph->execute(commandBuffer);
 
     commandBuffer->end();
 
     _device->getQueue()->submit(_commandBuffers);
     _device->present();
+
+    if (++_statsFrames == 60u) {
+        CC_LOG_INFO("DepthTest (%s): %u bunnies, %u uniform updates and %u bytes per frame | %.3fms update",
+                    USE_DYNAMIC_UBO ? "dynamic UBO" : "UBO per bunny", Bunny::BUNNY_NUM,
+                    _statsUpdates / _statsFrames, _statsBytes / _statsFrames, _statsUpdateTime / _statsFrames);
+        _statsFrames = 0u;
+        _statsUpdates = 0u;
+        _statsBytes = 0u;
+        _statsUpdateTime = 0.0f;
+    }
 }
 
 } // namespace cc
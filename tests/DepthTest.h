@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TestBase.h"
+#include "DynamicResolution.h"
 
 namespace cc {
 
@@ -18,7 +19,9 @@ public:
      virtual void resize(uint width, uint height) override;
 
 private:
-    Framebuffer* _bunnyFBO;
+    FrameGraph *_frameGraph = nullptr;
+    FrameGraph::Handle _depthTexture = 0u;
+    DynamicResolution *_dynamicResolution = nullptr;
 
     Mat4 _view;
     Mat4 _model;
@@ -28,6 +31,10 @@ private:
     Vec3 _up;
     
     float _dt = 0.0f;
+    uint _statsFrames = 0u;
+    uint _statsUpdates = 0u;
+    uint _statsBytes = 0u;
+    float _statsUpdateTime = 0.0f;
 };
 
 } // namespace cc
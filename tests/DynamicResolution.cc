@@ -0,0 +1,251 @@
+#include "DynamicResolution.h"
+#include "RenderPassAnalyzer.h"
+
+namespace cc {
+
+DynamicResolution::DynamicResolution(gfx::Device *device, FrameGraph *frameGraph, const String &name)
+: _device(device),
+  _frameGraph(frameGraph),
+  _name(name) {
+}
+
+DynamicResolution::~DynamicResolution() {
+    destroy();
+}
+
+void DynamicResolution::addTarget(FrameGraph::Handle texture) {
+    _targets.push_back(texture);
+}
+
+void DynamicResolution::addUpscalePass(FrameGraph::Handle source) {
+    _source = source;
+    _upscalePass = _frameGraph->addPass("upscale", [this](gfx::CommandBuffer *commandBuffer) {
+        commandBuffer->bindInputAssembler(_inputAssembler);
+        commandBuffer->bindPipelineState(_pipelineState);
+        commandBuffer->bindDescriptorSet(0, _descriptorSet);
+        commandBuffer->draw(_inputAssembler);
+        TestBaseI::getRenderPassAnalyzer()->draw(true);
+    });
+    _frameGraph->read(_upscalePass, source);
+    // every pixel is drawn over, nothing to clear
+    _frameGraph->writeColor(_upscalePass, FrameGraph::BACKBUFFER);
+}
+
+void DynamicResolution::createShader() {
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec2 a_position;
+            layout(location = 1) in vec2 a_texCoord;
+            layout(location = 0) out vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            layout(location = 0) in vec2 v_texCoord;
+            layout(set = 0, binding = 0) uniform Upscale {
+                vec2 u_uvScale;
+            };
+            layout(set = 0, binding = 1) uniform sampler2D u_texture;
+            layout(location = 0) out vec4 o_color;
+            void main() {
+                o_color = texture(u_texture, v_texCoord * u_uvScale);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec2 a_position;
+            in vec2 a_texCoord;
+            out vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec2 v_texCoord;
+            layout(std140) uniform Upscale {
+                vec2 u_uvScale;
+            };
+            uniform sampler2D u_texture;
+            out vec4 o_color;
+            void main() {
+                o_color = texture(u_texture, v_texCoord * u_uvScale);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec2 a_position;
+            attribute vec2 a_texCoord;
+            varying vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec2 v_texCoord;
+            uniform vec2 u_uvScale;
+            uniform sampler2D u_texture;
+            void main() {
+                gl_FragColor = texture2D(u_texture, v_texCoord * u_uvScale);
+            }
+        )",
+    };
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::AttributeList attributeList = {
+        {"a_position", gfx::Format::RG32F, false, 0, false, 0},
+        {"a_texCoord", gfx::Format::RG32F, false, 0, false, 1},
+    };
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "Upscale", {{"u_uvScale", gfx::Type::FLOAT2, 1}}, 1}};
+    gfx::UniformSamplerList samplers = {{0, 1, "u_texture", gfx::Type::SAMPLER2D, 1}};
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = "Upscale";
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    shaderInfo.samplers = std::move(samplers);
+    _shader = _device->createShader(shaderInfo);
+}
+
+void DynamicResolution::initialize() {
+    createShader();
+
+    // one triangle over the screen, UV space origin is at top-left
+    float ySign = _device->getScreenSpaceSignY();
+    float vertices[] = {-1, 4 * ySign, 0.0, -1.5,
+                        -1, -1 * ySign, 0.0, 1.0,
+                        4, -1 * ySign, 2.5, 1.0};
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        sizeof(vertices),
+        4 * sizeof(float),
+    });
+    _vertexBuffer->update(vertices, 0, sizeof(vertices));
+
+    _uniformBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE,
+        TestBaseI::getUBOSize(2 * sizeof(float)),
+    });
+
+    // bilinear, the source is smaller than the screen whenever the scale is below 1
+    gfx::SamplerInfo samplerInfo;
+    samplerInfo.addressU = gfx::Address::CLAMP;
+    samplerInfo.addressV = gfx::Address::CLAMP;
+    _sampler = _device->createSampler(samplerInfo);
+
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.push_back({"a_position", gfx::Format::RG32F, false, 0, false});
+    inputAssemblerInfo.attributes.push_back({"a_texCoord", gfx::Format::RG32F, false, 0, false});
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    dslInfo.bindings.push_back({1, gfx::DescriptorType::SAMPLER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(0, _uniformBuffer);
+    _descriptorSet->bindSampler(1, _sampler);
+    updateBindings();
+
+    gfx::PipelineStateInfo pipelineInfo;
+    pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineInfo.shader = _shader;
+    pipelineInfo.inputState.attributes = _inputAssembler->getAttributes();
+    pipelineInfo.renderPass = _frameGraph->getRenderPass(_upscalePass);
+    pipelineInfo.depthStencilState.depthTest = false;
+    pipelineInfo.depthStencilState.depthWrite = false;
+    pipelineInfo.rasterizerState.cullMode = gfx::CullMode::NONE;
+    pipelineInfo.pipelineLayout = _pipelineLayout;
+    _pipelineState = _device->createPipelineState(pipelineInfo);
+}
+
+void DynamicResolution::updateBindings() {
+    Vec2 uvScale = _frameGraph->getUVScale(_source);
+    _uniformBuffer->update(&uvScale, 0, sizeof(uvScale));
+    _descriptorSet->bindTexture(1, _frameGraph->getTexture(_source));
+    _descriptorSet->update();
+}
+
+bool DynamicResolution::update(float frameTime) {
+    if (frameTime <= 0.0f) return false;
+
+    _smoothedFrameTime += (frameTime - _smoothedFrameTime) * DYNAMIC_RESOLUTION_SMOOTHING;
+    float error = (DYNAMIC_RESOLUTION_TARGET - _smoothedFrameTime) / DYNAMIC_RESOLUTION_TARGET;
+    // vsync holds the frame time at the budget however much room is left, so a met budget
+    // reads as a little headroom and the scale creeps back up until a frame is missed; anything
+    // over the budget is left alone, or the loop settles past it
+    if (error >= -DYNAMIC_RESOLUTION_TOLERANCE) error = std::max(error, DYNAMIC_RESOLUTION_HEADROOM);
+
+    // the integral alone can't take the scale past its range, so it doesn't wind up
+    _integral = std::min(std::max(_integral + error * frameTime, (DYNAMIC_RESOLUTION_MIN_SCALE - 1.0f) / DYNAMIC_RESOLUTION_KI), 0.0f);
+    float derivative = (error - _lastError) / frameTime;
+    _lastError = error;
+
+    float scale = 1.0f + DYNAMIC_RESOLUTION_KP * error + DYNAMIC_RESOLUTION_KI * _integral + DYNAMIC_RESOLUTION_KD * derivative;
+    scale = std::min(std::max(scale, DYNAMIC_RESOLUTION_MIN_SCALE), 1.0f);
+    scale = std::ceil(scale * DYNAMIC_RESOLUTION_STEPS) / DYNAMIC_RESOLUTION_STEPS;
+
+    bool rescaled = scale != _scale;
+    if (rescaled) {
+        _scale = scale;
+        for (FrameGraph::Handle texture : _targets) _frameGraph->setScale(texture, scale);
+        updateBindings();
+        _statsRescales++;
+    }
+
+    _statsScale += _scale;
+    _statsFrameTime += frameTime;
+    if (++_statsFrames == 60u) {
+        CC_LOG_INFO("%s dynamic resolution: %.2f average scale, %u rescales | %.2fms frame, %.2fms target",
+                    _name.c_str(), _statsScale / _statsFrames, _statsRescales, _statsFrameTime * 1000.0f / _statsFrames,
+                    DYNAMIC_RESOLUTION_TARGET * 1000.0f);
+        _statsFrames = 0u;
+        _statsRescales = 0u;
+        _statsScale = 0.0f;
+        _statsFrameTime = 0.0f;
+    }
+    return rescaled;
+}
+
+void DynamicResolution::destroy() {
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_uniformBuffer);
+    CC_SAFE_DESTROY(_sampler);
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_pipelineState);
+}
+
+} // namespace cc
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "TestBase.h"
+#include "FrameGraph.h"
+
+// the frame time the controller holds, in seconds
+#define DYNAMIC_RESOLUTION_TARGET     (1.0f / 60.0f)
+#define DYNAMIC_RESOLUTION_MIN_SCALE  0.5f
+// the scale moves in steps of 1 / this, so jitter in the frame time doesn't resize every frame
+#define DYNAMIC_RESOLUTION_STEPS      32.0f
+// weight of the newest frame in the smoothed frame time
+#define DYNAMIC_RESOLUTION_SMOOTHING  0.1f
+// relative error read as headroom while the budget is met, see update
+#define DYNAMIC_RESOLUTION_HEADROOM   0.1f
+// frames at most this fraction over the budget still count as meeting it, timer jitter around a vsync
+#define DYNAMIC_RESOLUTION_TOLERANCE  0.01f
+#define DYNAMIC_RESOLUTION_KP         0.2f
+#define DYNAMIC_RESOLUTION_KI         0.5f
+#define DYNAMIC_RESOLUTION_KD         0.01f
+
+namespace cc {
+
+/**
+ * Renders a test's scene at a fraction of the surface and upscales it to the backbuffer, with the
+ * fraction driven by a PID loop on the measured frame time.
+ *
+ * The test declares its scene targets on the frame graph at scale 1, registers them with
+ * addTarget() and has its last scene pass write a color target that addUpscalePass() samples into
+ * the backbuffer with a bilinear blit. update() runs the controller once per frame and rescales the
+ * targets through the graph's render target pool, so small changes land in the same textures.
+ */
+class DynamicResolution {
+public:
+    DynamicResolution(gfx::Device *device, FrameGraph *frameGraph, const String &name);
+    ~DynamicResolution();
+
+    // follows the scale, anything aliased on it too
+    void addTarget(FrameGraph::Handle texture);
+    // before the graph compiles
+    void addUpscalePass(FrameGraph::Handle source);
+    // after the graph compiles, creates the blit pipeline against the upscale pass
+    void initialize();
+    void destroy();
+
+    // with the last frame time in seconds; true when the targets were rescaled and whatever samples
+    // them has to be rebound
+    bool update(float frameTime);
+    // after the graph resizes or rescales
+    void updateBindings();
+
+    float getScale() const { return _scale; }
+
+private:
+    void createShader();
+
+    gfx::Device *_device = nullptr;
+    FrameGraph *_frameGraph = nullptr;
+    String _name;
+    vector<FrameGraph::Handle> _targets;
+    FrameGraph::Handle _source = 0u;
+    FrameGraph::Handle _upscalePass = 0u;
+
+    float _scale = 1.0f;
+    float _smoothedFrameTime = DYNAMIC_RESOLUTION_TARGET;
+    float _integral = 0.0f;
+    float _lastError = 0.0f;
+
+    gfx::Shader *_shader = nullptr;
+    gfx::Buffer *_vertexBuffer = nullptr;
+    gfx::Buffer *_uniformBuffer = nullptr;
+    gfx::Sampler *_sampler = nullptr;
+    gfx::InputAssembler *_inputAssembler = nullptr;
+    gfx::DescriptorSetLayout *_descriptorSetLayout = nullptr;
+    gfx::PipelineLayout *_pipelineLayout = nullptr;
+    gfx::DescriptorSet *_descriptorSet = nullptr;
+    gfx::PipelineState *_pipelineState = nullptr;
+
+    uint _statsFrames = 0u;
+    uint _statsRescales = 0u;
+    float _statsScale = 0.0f;
+    float _statsFrameTime = 0.0f;
+};
+
+} // namespace cc
@@ -0,0 +1,347 @@
+#include "FrameGraph.h"
+#include "RenderPassAnalyzer.h"
+
+namespace cc {
+
+FrameGraph::FrameGraph(gfx::Device *device)
+: _device(device),
+  _width(device->getWidth()),
+  _height(device->getHeight()),
+  _pool(device) {
+    _textures.resize(2u);
+    _textures[BACKBUFFER].name = "backbuffer";
+    _textures[BACKBUFFER].format = device->getColorFormat();
+    _textures[BACKBUFFER_DEPTH_STENCIL].name = "backbuffer depth stencil";
+    _textures[BACKBUFFER_DEPTH_STENCIL].format = device->getDepthStencilFormat();
+}
+
+FrameGraph::~FrameGraph() {
+    destroy();
+    _pool.destroy();
+}
+
+FrameGraph::Handle FrameGraph::createTexture(const String &name, gfx::Format format, float scale) {
+    VirtualTexture texture;
+    texture.name = name;
+    texture.format = format;
+    texture.scale = scale;
+    _textures.push_back(texture);
+    return static_cast<Handle>(_textures.size() - 1u);
+}
+
+FrameGraph::Handle FrameGraph::addPass(const String &name, const Execute &execute) {
+    Pass pass;
+    pass.name = name;
+    pass.execute = execute;
+    _passes.push_back(pass);
+    return static_cast<Handle>(_passes.size() - 1u);
+}
+
+void FrameGraph::writeColor(Handle pass, Handle texture, bool clear, const gfx::Color &clearColor) {
+    CCASSERT(texture != BACKBUFFER_DEPTH_STENCIL, "FrameGraph: the backbuffer depth stencil is not a color attachment");
+    Attachment attachment;
+    attachment.texture = texture;
+    attachment.clear = clear;
+    attachment.clearColor = clearColor;
+    _passes[pass].colors.push_back(attachment);
+}
+
+void FrameGraph::writeDepthStencil(Handle pass, Handle texture, bool clear, float clearDepth, int clearStencil) {
+    CCASSERT(texture != BACKBUFFER && !_passes[pass].hasDepthStencil, "FrameGraph: one depth stencil attachment per pass");
+    Pass &target = _passes[pass];
+    target.hasDepthStencil = true;
+    target.depthStencil.texture = texture;
+    target.depthStencil.clear = clear;
+    target.depthStencil.clearDepth = clearDepth;
+    target.depthStencil.clearStencil = clearStencil;
+}
+
+void FrameGraph::read(Handle pass, Handle texture) {
+    CCASSERT(texture > BACKBUFFER_DEPTH_STENCIL, "FrameGraph: the backbuffer can't be sampled");
+    _passes[pass].reads.push_back(texture);
+}
+
+gfx::Texture *FrameGraph::getTexture(Handle texture) const {
+    uint physical = _textures[texture].physical;
+    return physical < _physicalTextures.size() ? _physicalTextures[physical].texture : nullptr;
+}
+
+Vec2 FrameGraph::getUVScale(Handle texture) const {
+    const gfx::Texture *physical = getTexture(texture);
+    if (!physical) return Vec2(1.0f, 1.0f);
+    float scale = _textures[texture].scale;
+    return Vec2(float(getScaledSize(_width, scale)) / physical->getWidth(), float(getScaledSize(_height, scale)) / physical->getHeight());
+}
+
+uint FrameGraph::getScaledSize(uint size, float scale) const {
+    return std::max(1u, static_cast<uint>(static_cast<float>(size) * scale));
+}
+
+void FrameGraph::compile() {
+    destroy();
+
+    for (Pass &pass : _passes) {
+        bool backbuffer = pass.colors.size() && pass.colors[0].texture == BACKBUFFER;
+        for (const Attachment &color : pass.colors) {
+            CCASSERT((color.texture == BACKBUFFER) == backbuffer, "FrameGraph: a pass renders to the backbuffer or offscreen, not both");
+        }
+        // the swapchain framebuffer always comes with its depth stencil
+        if (backbuffer && !pass.hasDepthStencil) writeDepthStencil(static_cast<Handle>(&pass - _passes.data()), BACKBUFFER_DEPTH_STENCIL, true);
+        CCASSERT(!pass.hasDepthStencil || (pass.depthStencil.texture == BACKBUFFER_DEPTH_STENCIL) == backbuffer,
+                 "FrameGraph: a pass renders to the backbuffer or offscreen, not both");
+        pass.backbuffer = backbuffer;
+    }
+
+    cull();
+    deriveAttachmentOps();
+    allocateTextures();
+    createPasses();
+
+    uint kept = 0u;
+    uint used = 0u;
+    for (const Pass &pass : _passes) kept += !pass.culled;
+    for (uint i = BACKBUFFER_DEPTH_STENCIL + 1u; i < _textures.size(); ++i) used += _textures[i].physical != ~0u;
+    CC_LOG_INFO("FrameGraph: %u of %u passes kept, %u transient attachments on %u textures, %.1fKB allocated for %.1fKB of attachments (%.1fKB saved by aliasing)",
+                kept, static_cast<uint>(_passes.size()), used, static_cast<uint>(_physicalTextures.size()),
+                _physicalBytes / 1024.0f, _virtualBytes / 1024.0f, _aliasedBytes / 1024.0f);
+}
+
+void FrameGraph::cull() {
+    // walking back from the presented image: a pass is needed if it writes something a later
+    // kept pass consumes, a clear ends the interest in what came before
+    vector<bool> needed(_textures.size(), false);
+    needed[BACKBUFFER] = true;
+    for (uint i = static_cast<uint>(_passes.size()); i-- > 0u;) {
+        Pass &pass = _passes[i];
+        pass.culled = !(pass.hasDepthStencil && needed[pass.depthStencil.texture]);
+        for (const Attachment &color : pass.colors) pass.culled = pass.culled && !needed[color.texture];
+        if (pass.culled) continue;
+
+        for (const Attachment &color : pass.colors) {
+            if (color.clear) needed[color.texture] = false;
+        }
+        if (pass.hasDepthStencil && pass.depthStencil.clear) needed[pass.depthStencil.texture] = false;
+        for (Handle texture : pass.reads) needed[texture] = true;
+    }
+}
+
+void FrameGraph::deriveAttachmentOps() {
+    struct Use {
+        uint pass;
+        Attachment *attachment; // null when sampled
+        bool depthStencil;
+    };
+    vector<vector<Use>> uses(_textures.size());
+    for (uint i = 0u; i < _passes.size(); ++i) {
+        Pass &pass = _passes[i];
+        if (pass.culled) continue;
+        for (Attachment &color : pass.colors) uses[color.texture].push_back({i, &color, false});
+        if (pass.hasDepthStencil) uses[pass.depthStencil.texture].push_back({i, &pass.depthStencil, true});
+        for (Handle texture : pass.reads) uses[texture].push_back({i, nullptr, false});
+    }
+
+    for (uint t = 0u; t < _textures.size(); ++t) {
+        VirtualTexture &texture = _textures[t];
+        const vector<Use> &textureUses = uses[t];
+        texture.usage = gfx::TextureUsageBit::NONE;
+        texture.firstUse = ~0u;
+        texture.lastUse = 0u;
+        if (textureUses.empty()) continue;
+        CCASSERT(textureUses[0].attachment, "FrameGraph: an attachment is sampled before any pass writes it");
+        texture.firstUse = textureUses.front().pass;
+        texture.lastUse = textureUses.back().pass;
+
+        gfx::TextureLayout layout = gfx::TextureLayout::UNDEFINED;
+        for (uint u = 0u; u < textureUses.size(); ++u) {
+            const Use &use = textureUses[u];
+            if (!use.attachment) {
+                texture.usage = texture.usage | gfx::TextureUsageBit::SAMPLED;
+                continue;
+            }
+            CCASSERT(u + 1u == textureUses.size() || textureUses[u + 1u].pass != use.pass, "FrameGraph: a pass can't sample what it writes");
+            texture.usage = texture.usage | (use.depthStencil ? gfx::TextureUsageBit::DEPTH_STENCIL_ATTACHMENT : gfx::TextureUsageBit::COLOR_ATTACHMENT);
+
+            const Use *next = u + 1u < textureUses.size() ? &textureUses[u + 1u] : nullptr;
+            bool presented = t == BACKBUFFER && !next;
+            bool consumed = next && (!next->attachment || !next->attachment->clear);
+
+            Attachment &attachment = *use.attachment;
+            attachment.loadOp = attachment.clear ? gfx::LoadOp::CLEAR : (u ? gfx::LoadOp::LOAD : gfx::LoadOp::DISCARD);
+            attachment.storeOp = consumed || presented ? gfx::StoreOp::STORE : gfx::StoreOp::DISCARD;
+            attachment.beginLayout = attachment.loadOp == gfx::LoadOp::LOAD ? layout : gfx::TextureLayout::UNDEFINED;
+            if (next && !next->attachment) {
+                attachment.endLayout = gfx::TextureLayout::SHADER_READONLY_OPTIMAL;
+            } else if (presented) {
+                attachment.endLayout = gfx::TextureLayout::PRESENT_SRC;
+            } else {
+                attachment.endLayout = use.depthStencil ? gfx::TextureLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL : gfx::TextureLayout::COLOR_ATTACHMENT_OPTIMAL;
+            }
+            layout = attachment.endLayout;
+        }
+    }
+}
+
+void FrameGraph::allocateTextures() {
+    // earliest first use first, each takes the first free texture it matches
+    vector<uint> order;
+    for (uint i = BACKBUFFER_DEPTH_STENCIL + 1u; i < _textures.size(); ++i) {
+        if (_textures[i].firstUse != ~0u) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint a, uint b) { return _textures[a].firstUse < _textures[b].firstUse; });
+
+    for (uint index : order) {
+        VirtualTexture &texture = _textures[index];
+        uint width = getScaledSize(_width, texture.scale);
+        uint height = getScaledSize(_height, texture.scale);
+        uint bytes = gfx::FormatSize(texture.format, width, height, 1u);
+        _virtualBytes += bytes;
+
+        for (uint i = 0u; i < _physicalTextures.size(); ++i) {
+            PhysicalTexture &physical = _physicalTextures[i];
+            if (physical.lastUse < texture.firstUse && physical.format == texture.format &&
+                physical.scale == texture.scale && physical.usage == texture.usage) {
+                texture.physical = i;
+                physical.lastUse = texture.lastUse;
+                _aliasedBytes += bytes;
+                break;
+            }
+        }
+        if (texture.physical != ~0u) continue;
+
+        PhysicalTexture physical;
+        physical.format = texture.format;
+        physical.scale = texture.scale;
+        physical.usage = texture.usage;
+        physical.lastUse = texture.lastUse;
+
+        physical.texture = _pool.acquire(texture.format, width, height, texture.usage);
+
+        texture.physical = static_cast<uint>(_physicalTextures.size());
+        _physicalTextures.push_back(physical);
+        _physicalBytes += gfx::FormatSize(texture.format, physical.texture->getWidth(), physical.texture->getHeight(), 1u);
+    }
+}
+
+void FrameGraph::createPasses() {
+    for (Pass &pass : _passes) {
+        if (pass.culled) continue;
+
+        gfx::RenderPassInfo renderPassInfo;
+        pass.clearColors.clear();
+        for (const Attachment &color : pass.colors) {
+            gfx::ColorAttachment colorAttachment;
+            colorAttachment.format = _textures[color.texture].format;
+            colorAttachment.sampleCount = 1;
+            colorAttachment.loadOp = color.loadOp;
+            colorAttachment.storeOp = color.storeOp;
+            colorAttachment.beginLayout = color.beginLayout;
+            colorAttachment.endLayout = color.endLayout;
+            renderPassInfo.colorAttachments.emplace_back(colorAttachment);
+            pass.clearColors.push_back(color.clearColor);
+        }
+        if (pass.hasDepthStencil) {
+            const Attachment &depthStencil = pass.depthStencil;
+            gfx::DepthStencilAttachment &depthStencilAttachment = renderPassInfo.depthStencilAttachment;
+            depthStencilAttachment.format = _textures[depthStencil.texture].format;
+            depthStencilAttachment.sampleCount = 1;
+            depthStencilAttachment.depthLoadOp = depthStencil.loadOp;
+            depthStencilAttachment.depthStoreOp = depthStencil.storeOp;
+            depthStencilAttachment.stencilLoadOp = depthStencil.loadOp;
+            depthStencilAttachment.stencilStoreOp = depthStencil.storeOp;
+            depthStencilAttachment.beginLayout = depthStencil.beginLayout;
+            depthStencilAttachment.endLayout = depthStencil.endLayout;
+        }
+
+        pass.renderPass = _device->createRenderPass(renderPassInfo);
+        updateFramebuffer(pass);
+    }
+}
+
+void FrameGraph::updateFramebuffer(Pass &pass) {
+    gfx::FramebufferInfo framebufferInfo;
+    framebufferInfo.renderPass = pass.renderPass;
+    for (const Attachment &color : pass.colors) {
+        framebufferInfo.colorTextures.push_back(getTexture(color.texture)); // null is the swapchain
+    }
+    if (pass.hasDepthStencil) framebufferInfo.depthStencilTexture = getTexture(pass.depthStencil.texture);
+    pass.framebuffer = _pool.getFramebuffer(framebufferInfo);
+}
+
+void FrameGraph::resize(uint width, uint height) {
+    _width = width;
+    _height = height;
+    refit();
+}
+
+void FrameGraph::setScale(Handle texture, float scale) {
+    uint physical = _textures[texture].physical;
+    if (physical == ~0u) {
+        _textures[texture].scale = scale;
+        return;
+    }
+    for (VirtualTexture &aliased : _textures) {
+        if (aliased.physical == physical) aliased.scale = scale;
+    }
+    _physicalTextures[physical].scale = scale;
+    refit();
+}
+
+void FrameGraph::refit() {
+    // targets that still fit are kept, and so are the framebuffers on them
+    bool changed = false;
+    for (PhysicalTexture &physical : _physicalTextures) {
+        uint scaledWidth = getScaledSize(_width, physical.scale);
+        uint scaledHeight = getScaledSize(_height, physical.scale);
+        if (_pool.fits(physical.texture, scaledWidth, scaledHeight)) continue;
+        _pool.release(physical.texture);
+        physical.texture = _pool.acquire(physical.format, scaledWidth, scaledHeight, physical.usage);
+        changed = true;
+    }
+    if (!changed) return;
+
+    _physicalBytes = 0u;
+    for (const PhysicalTexture &physical : _physicalTextures) {
+        _physicalBytes += gfx::FormatSize(physical.format, physical.texture->getWidth(), physical.texture->getHeight(), 1u);
+    }
+    for (Pass &pass : _passes) {
+        if (!pass.culled && !pass.backbuffer) updateFramebuffer(pass);
+    }
+}
+
+void FrameGraph::execute(gfx::CommandBuffer *commandBuffer) {
+    _pool.tick();
+
+    RenderPassAnalyzer *analyzer = TestBaseI::getRenderPassAnalyzer();
+    for (Pass &pass : _passes) {
+        if (pass.culled) continue;
+
+        float scale = 1.0f;
+        if (!pass.backbuffer) scale = _textures[pass.colors.size() ? pass.colors[0].texture : pass.depthStencil.texture].scale;
+        gfx::Rect renderArea = {0, 0, getScaledSize(_width, scale), getScaledSize(_height, scale)};
+
+        commandBuffer->beginRenderPass(pass.renderPass, pass.framebuffer, renderArea, pass.clearColors.data(),
+                                       pass.depthStencil.clearDepth, pass.depthStencil.clearStencil);
+        analyzer->record(pass.name, pass.framebuffer, renderArea);
+        for (Handle texture : pass.reads) analyzer->read(getTexture(texture));
+        pass.execute(commandBuffer);
+        commandBuffer->endRenderPass();
+    }
+}
+
+void FrameGraph::destroy() {
+    for (Pass &pass : _passes) {
+        if (pass.renderPass) _pool.releaseRenderPass(pass.renderPass);
+        pass.framebuffer = nullptr;
+        CC_SAFE_DESTROY(pass.renderPass);
+    }
+    for (PhysicalTexture &physical : _physicalTextures) {
+        _pool.release(physical.texture);
+    }
+    _physicalTextures.clear();
+    for (VirtualTexture &texture : _textures) texture.physical = ~0u;
+    _virtualBytes = 0u;
+    _aliasedBytes = 0u;
+    _physicalBytes = 0u;
+}
+
+} // namespace cc
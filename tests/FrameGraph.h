@@ -0,0 +1,137 @@
+#pragma once
+
+#include "TestBase.h"
+#include "RenderTargetPool.h"
+#include <functional>
+
+namespace cc {
+
+/**
+ * Declares the render passes of a frame and the attachments they write and sample, and derives
+ * everything the tests used to spell out by hand.
+ *
+ * compile() walks back from the backbuffer and culls passes whose writes nothing later consumes.
+ * Load and store ops and begin and end layouts come from each attachment's neighbouring uses: a
+ * write clears when asked, loads when an earlier pass wrote it and discards otherwise, and stores
+ * only when a later pass samples or loads it. Transient textures of the same format, scale and
+ * usage whose lifetimes don't overlap share one gfx::Texture; the gfx layer has no memory heaps to
+ * alias on, so that is the memory the report counts as saved.
+ *
+ * Textures and framebuffers come from a RenderTargetPool, so a target may be larger than what is
+ * rendered into it; samplers scale their coordinates by getUVScale().
+ *
+ * Passes run in declaration order. Pipelines are created against getRenderPass() after compile().
+ */
+class FrameGraph {
+public:
+    using Handle = uint;
+    using Execute = std::function<void(gfx::CommandBuffer *)>;
+
+    // the swapchain images, never culled away and never aliased
+    static const Handle BACKBUFFER = 0u;
+    static const Handle BACKBUFFER_DEPTH_STENCIL = 1u;
+
+    explicit FrameGraph(gfx::Device *device);
+    ~FrameGraph();
+
+    // a transient attachment scale times the surface size, lives from its first write to its last use
+    Handle createTexture(const String &name, gfx::Format format, float scale = 1.0f);
+    Handle addPass(const String &name, const Execute &execute);
+    // one color attachment per call, in attachment order; without clear the contents are loaded
+    void writeColor(Handle pass, Handle texture, bool clear = false, const gfx::Color &clearColor = {});
+    void writeDepthStencil(Handle pass, Handle texture, bool clear = false, float clearDepth = 1.0f, int clearStencil = 0);
+    // sampled in the pass, left in SHADER_READONLY_OPTIMAL by its last writer
+    void read(Handle pass, Handle texture);
+
+    // culls, derives the attachment ops and creates the textures, render passes and framebuffers
+    void compile();
+    void resize(uint width, uint height);
+    // rescales the texture and everything aliased on it after compile, through the pool like a resize
+    void setScale(Handle texture, float scale);
+    void execute(gfx::CommandBuffer *commandBuffer);
+    void destroy();
+
+    // null for culled passes and for textures no kept pass uses
+    gfx::RenderPass *getRenderPass(Handle pass) const { return _passes[pass].renderPass; }
+    gfx::Texture *getTexture(Handle texture) const;
+    // the fraction of the texture the passes render into, changes on resize
+    Vec2 getUVScale(Handle texture) const;
+    bool isCulled(Handle pass) const { return _passes[pass].culled; }
+
+    uint getAttachmentBytes() const { return _virtualBytes; }
+    uint getAllocatedBytes() const { return _physicalBytes; }
+    uint getAliasedBytes() const { return _aliasedBytes; }
+    uint getTextureCount() const { return static_cast<uint>(_physicalTextures.size()); }
+    RenderTargetPool &getRenderTargetPool() { return _pool; }
+
+private:
+    struct Attachment {
+        Handle texture = 0u;
+        bool clear = false;
+        gfx::Color clearColor;
+        float clearDepth = 1.0f;
+        int clearStencil = 0;
+
+        // derived by compile
+        gfx::LoadOp loadOp = gfx::LoadOp::DISCARD;
+        gfx::StoreOp storeOp = gfx::StoreOp::DISCARD;
+        gfx::TextureLayout beginLayout = gfx::TextureLayout::UNDEFINED;
+        gfx::TextureLayout endLayout = gfx::TextureLayout::UNDEFINED;
+    };
+
+    struct Pass {
+        String name;
+        Execute execute;
+        vector<Attachment> colors;
+        bool hasDepthStencil = false;
+        Attachment depthStencil;
+        vector<Handle> reads;
+
+        bool culled = false;
+        bool backbuffer = false;
+        gfx::RenderPass *renderPass = nullptr;
+        gfx::Framebuffer *framebuffer = nullptr; // owned by the pool
+        vector<gfx::Color> clearColors;
+    };
+
+    struct VirtualTexture {
+        String name;
+        gfx::Format format = gfx::Format::UNKNOWN;
+        float scale = 1.0f;
+        gfx::TextureUsage usage = gfx::TextureUsageBit::NONE;
+        uint physical = ~0u;
+        uint firstUse = ~0u; // kept pass indices
+        uint lastUse = 0u;
+    };
+
+    struct PhysicalTexture {
+        gfx::Texture *texture = nullptr;
+        gfx::Format format = gfx::Format::UNKNOWN;
+        float scale = 1.0f;
+        gfx::TextureUsage usage = gfx::TextureUsageBit::NONE;
+        uint lastUse = 0u;
+    };
+
+    void cull();
+    void deriveAttachmentOps();
+    void allocateTextures();
+    void createPasses();
+    void updateFramebuffer(Pass &pass);
+    void refit();
+    uint getScaledSize(uint size, float scale) const;
+
+    gfx::Device *_device = nullptr;
+    uint _width = 0u;
+    uint _height = 0u;
+
+    vector<Pass> _passes;
+    vector<VirtualTexture> _textures;
+    vector<PhysicalTexture> _physicalTextures;
+    RenderTargetPool _pool;
+
+    uint _virtualBytes = 0u;
+    uint _physicalBytes = 0u;
+    uint _aliasedBytes = 0u; // attachments that got a texture an earlier one was done with
+};
+
+} // namespace cc
@@ -0,0 +1,260 @@
+#include "Geometry.h"
+
+namespace cc {
+
+namespace {
+// round to nearest, denormals flushed to zero, plenty for texture coordinates
+uint16_t toHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    int exponent = static_cast<int>((bits >> 23) & 0xFFu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+    if (exponent <= 0) return static_cast<uint16_t>(sign);
+    if (exponent >= 31) return static_cast<uint16_t>(sign | 0x7C00u);
+    // a mantissa rounding up carries into the exponent, which is the correct result
+    return static_cast<uint16_t>((sign | (exponent << 10)) + ((mantissa + 0x1000u) >> 13));
+}
+
+int8_t toSnorm8(float value) {
+    return static_cast<int8_t>(std::round(std::max(-1.0f, std::min(1.0f, value)) * 127.0f));
+}
+
+void writeFloats(uint8_t *dst, std::initializer_list<float> values) {
+    memcpy(dst, values.begin(), values.size() * sizeof(float));
+}
+
+// latitude rings from pole to pole, the pole rows only get one triangle per segment
+void generateSphere(GeometryBuffers &out, uint triangles, VertexFormat format) {
+    uint rings = std::max(2u, static_cast<uint>(0.5f + std::sqrt(0.25f + triangles * 0.25f) + 0.5f));
+    uint segments = rings * 2u;
+    out.reset(format, (rings + 1u) * (segments + 1u), segments * (rings - 1u) * 6u);
+
+    for (uint i = 0u; i <= rings; ++i) {
+        float theta = math::PI * i / rings;
+        for (uint j = 0u; j <= segments; ++j) {
+            float phi = 2.0f * math::PI * j / segments;
+            Vec3 normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            out.writeVertex(i * (segments + 1u) + j, normal, normal, float(j) / segments, float(i) / rings);
+        }
+    }
+
+    uint triangle = 0u;
+    for (uint i = 0u; i < rings; ++i) {
+        for (uint j = 0u; j < segments; ++j) {
+            uint a = i * (segments + 1u) + j;
+            uint b = a + segments + 1u;
+            if (i != 0u) out.writeTriangle(triangle++, a, a + 1u, b);
+            if (i != rings - 1u) out.writeTriangle(triangle++, a + 1u, b + 1u, b);
+        }
+    }
+}
+
+void generateTorus(GeometryBuffers &out, uint triangles, VertexFormat format) {
+    const float major = 0.7f;
+    const float minor = 0.3f;
+    uint sides = std::max(3u, static_cast<uint>(std::sqrt(triangles * 0.25f) + 0.5f));
+    uint segments = sides * 2u;
+    out.reset(format, (segments + 1u) * (sides + 1u), segments * sides * 6u);
+
+    for (uint i = 0u; i <= segments; ++i) {
+        float u = 2.0f * math::PI * i / segments;
+        for (uint j = 0u; j <= sides; ++j) {
+            float v = 2.0f * math::PI * j / sides;
+            Vec3 normal(std::cos(v) * std::cos(u), std::sin(v), std::cos(v) * std::sin(u));
+            Vec3 position((major + minor * std::cos(v)) * std::cos(u), minor * std::sin(v), (major + minor * std::cos(v)) * std::sin(u));
+            out.writeVertex(i * (sides + 1u) + j, position, normal, float(i) / segments, float(j) / sides);
+        }
+    }
+
+    uint triangle = 0u;
+    for (uint i = 0u; i < segments; ++i) {
+        for (uint j = 0u; j < sides; ++j) {
+            uint a = i * (sides + 1u) + j;
+            uint b = a + sides + 1u;
+            out.writeTriangle(triangle++, a, a + 1u, b);
+            out.writeTriangle(triangle++, a + 1u, b + 1u, b);
+        }
+    }
+}
+
+// gently waving height field on the xz plane, facing up
+void generateGrid(GeometryBuffers &out, uint triangles, VertexFormat format) {
+    const float extent = 0.7f;
+    const float amplitude = 0.05f;
+    const float frequency = 12.0f;
+    uint quads = std::max(1u, static_cast<uint>(std::sqrt(triangles * 0.5f) + 0.5f));
+    uint verts = quads + 1u;
+    out.reset(format, verts * verts, quads * quads * 6u);
+
+    for (uint z = 0u; z < verts; ++z) {
+        for (uint x = 0u; x < verts; ++x) {
+            float px = (2.0f * x / quads - 1.0f) * extent;
+            float pz = (2.0f * z / quads - 1.0f) * extent;
+            float dydx = amplitude * frequency * std::cos(frequency * px) * std::cos(frequency * pz);
+            float dydz = -amplitude * frequency * std::sin(frequency * px) * std::sin(frequency * pz);
+            Vec3 position(px, amplitude * std::sin(frequency * px) * std::cos(frequency * pz), pz);
+            out.writeVertex(z * verts + x, position, Vec3(-dydx, 1.0f, -dydz).getNormalized(), float(x) / quads, float(z) / quads);
+        }
+    }
+
+    uint triangle = 0u;
+    for (uint z = 0u; z < quads; ++z) {
+        for (uint x = 0u; x < quads; ++x) {
+            uint i = z * verts + x;
+            out.writeTriangle(triangle++, i, i + verts, i + 1u);
+            out.writeTriangle(triangle++, i + 1u, i + verts, i + verts + 1u);
+        }
+    }
+}
+
+// equilateral triangles at random places and orientations in the unit ball, sized so the soup stays about as opaque at any count
+void generateSoup(GeometryBuffers &out, uint triangles, VertexFormat format, uint seed) {
+    triangles = std::max(1u, triangles);
+    out.reset(format, triangles * 3u, triangles * 3u);
+
+    SeededRandom random(seed);
+    float size = 2.0f / std::sqrt(static_cast<float>(triangles));
+    for (uint t = 0u; t < triangles; ++t) {
+        Vec3 center;
+        do {
+            center.set(random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f));
+        } while (center.lengthSquared() > 1.0f);
+        center *= 1.0f - size;
+
+        Vec3 normal;
+        do {
+            normal.set(random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f));
+        } while (normal.lengthSquared() > 1.0f || normal.lengthSquared() < 1e-4f);
+        normal.normalize();
+
+        // tangent frame with normal = tangent x bitangent, so increasing angles wind counter-clockwise
+        Vec3 tangent;
+        Vec3::cross(std::abs(normal.y) < 0.9f ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 0.0f, 0.0f), normal, &tangent);
+        tangent.normalize();
+        Vec3 bitangent;
+        Vec3::cross(normal, tangent, &bitangent);
+
+        float angle = random.range(0.0f, 2.0f * math::PI);
+        static const float uvs[3][2] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}};
+        for (uint k = 0u; k < 3u; ++k) {
+            float a = angle + 2.0f * math::PI * k / 3.0f;
+            Vec3 position = center + tangent * (size * std::cos(a)) + bitangent * (size * std::sin(a));
+            out.writeVertex(t * 3u + k, position, normal, uvs[k][0], uvs[k][1]);
+        }
+        out.writeTriangle(t, t * 3u, t * 3u + 1u, t * 3u + 2u);
+    }
+}
+} // namespace
+
+const char *getShapeName(GeometryShape shape) {
+    switch (shape) {
+        case GeometryShape::SPHERE: return "sphere";
+        case GeometryShape::TORUS: return "torus";
+        case GeometryShape::GRID: return "grid";
+        case GeometryShape::SOUP: return "soup";
+        default: return "unknown";
+    }
+}
+
+const char *getVertexFormatName(VertexFormat format) {
+    switch (format) {
+        case VertexFormat::POSITION: return "position 12B";
+        case VertexFormat::FLOAT_INTERLEAVED: return "float interleaved 32B";
+        case VertexFormat::FLOAT_SPLIT: return "float split 12+12+8B";
+        case VertexFormat::PACKED_INTERLEAVED: return "packed interleaved 20B";
+        default: return "unknown";
+    }
+}
+
+void GeometryBuffers::reset(VertexFormat vertexFormat, uint vertices, uint indexTotal) {
+    format = vertexFormat;
+    vertexCount = vertices;
+    indexCount = indexTotal;
+    indexStride = vertices > 0x10000u ? sizeof(uint) : sizeof(uint16_t);
+
+    switch (format) {
+        case VertexFormat::POSITION:
+            attributes = {{"a_position", gfx::Format::RGB32F, false, 0, false}};
+            strides = {3 * sizeof(float)};
+            break;
+        case VertexFormat::FLOAT_INTERLEAVED:
+            attributes = {
+                {"a_position", gfx::Format::RGB32F, false, 0, false},
+                {"a_normal", gfx::Format::RGB32F, false, 0, false},
+                {"a_texCoord", gfx::Format::RG32F, false, 0, false},
+            };
+            strides = {8 * sizeof(float)};
+            break;
+        case VertexFormat::FLOAT_SPLIT:
+            attributes = {
+                {"a_position", gfx::Format::RGB32F, false, 0, false},
+                {"a_normal", gfx::Format::RGB32F, false, 1, false},
+                {"a_texCoord", gfx::Format::RG32F, false, 2, false},
+            };
+            strides = {3 * sizeof(float), 3 * sizeof(float), 2 * sizeof(float)};
+            break;
+        case VertexFormat::PACKED_INTERLEAVED:
+            attributes = {
+                {"a_position", gfx::Format::RGB32F, false, 0, false},
+                {"a_normal", gfx::Format::RGBA8SN, true, 0, false},
+                {"a_texCoord", gfx::Format::RG16F, false, 0, false},
+            };
+            strides = {3 * sizeof(float) + 4 + 2 * sizeof(uint16_t)};
+            break;
+        default: break;
+    }
+
+    streams.resize(strides.size());
+    for (size_t i = 0u; i < strides.size(); ++i) streams[i].assign(strides[i] * vertexCount, 0u);
+    indices.assign(indexStride * indexCount, 0u);
+}
+
+void GeometryBuffers::writeVertex(uint index, const Vec3 &position, const Vec3 &normal, float u, float v) {
+    uint8_t *vertex = streams[0].data() + index * strides[0];
+    writeFloats(vertex, {position.x, position.y, position.z});
+
+    switch (format) {
+        case VertexFormat::FLOAT_INTERLEAVED:
+            writeFloats(vertex + 3 * sizeof(float), {normal.x, normal.y, normal.z, u, v});
+            break;
+        case VertexFormat::FLOAT_SPLIT:
+            writeFloats(streams[1].data() + index * strides[1], {normal.x, normal.y, normal.z});
+            writeFloats(streams[2].data() + index * strides[2], {u, v});
+            break;
+        case VertexFormat::PACKED_INTERLEAVED: {
+            int8_t packedNormal[4] = {toSnorm8(normal.x), toSnorm8(normal.y), toSnorm8(normal.z), 0};
+            uint16_t packedUV[2] = {toHalf(u), toHalf(v)};
+            memcpy(vertex + 3 * sizeof(float), packedNormal, sizeof(packedNormal));
+            memcpy(vertex + 3 * sizeof(float) + sizeof(packedNormal), packedUV, sizeof(packedUV));
+            break;
+        }
+        default: break;
+    }
+}
+
+void GeometryBuffers::writeTriangle(uint triangle, uint a, uint b, uint c) {
+    if (indexStride == sizeof(uint16_t)) {
+        uint16_t *dst = reinterpret_cast<uint16_t *>(indices.data()) + triangle * 3u;
+        dst[0] = static_cast<uint16_t>(a);
+        dst[1] = static_cast<uint16_t>(b);
+        dst[2] = static_cast<uint16_t>(c);
+    } else {
+        uint *dst = reinterpret_cast<uint *>(indices.data()) + triangle * 3u;
+        dst[0] = a;
+        dst[1] = b;
+        dst[2] = c;
+    }
+}
+
+void generateGeometry(GeometryBuffers &out, GeometryShape shape, uint triangles, VertexFormat format, uint seed) {
+    switch (shape) {
+        case GeometryShape::SPHERE: generateSphere(out, triangles, format); break;
+        case GeometryShape::TORUS: generateTorus(out, triangles, format); break;
+        case GeometryShape::GRID: generateGrid(out, triangles, format); break;
+        case GeometryShape::SOUP: generateSoup(out, triangles, format, seed); break;
+        default: out.reset(format, 0u, 0u); break;
+    }
+}
+
+} // namespace cc
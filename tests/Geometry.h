@@ -0,0 +1,53 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+enum class GeometryShape : uint8_t {
+    SPHERE,
+    TORUS,
+    GRID,
+    SOUP, // independent random triangles, no vertex reuse at all
+    COUNT,
+};
+
+enum class VertexFormat : uint8_t {
+    POSITION,           // RGB32F position, 12 bytes
+    FLOAT_INTERLEAVED,  // RGB32F position, RGB32F normal, RG32F uv in one 32 byte stream
+    FLOAT_SPLIT,        // the same attributes, one stream each
+    PACKED_INTERLEAVED, // RGB32F position, RGBA8SN normal, RG16F uv in one 20 byte stream
+    COUNT,
+};
+
+const char *getShapeName(GeometryShape shape);
+const char *getVertexFormatName(VertexFormat format);
+
+/**
+ * Generated geometry laid out exactly as it is uploaded: one byte array per vertex stream in the
+ * requested format, and indices in 16 bits whenever the vertex count allows.
+ */
+struct GeometryBuffers {
+    VertexFormat format = VertexFormat::POSITION;
+    uint vertexCount = 0u;
+    uint indexCount = 0u;
+    uint indexStride = 0u;
+    gfx::AttributeList attributes;
+    vector<uint> strides;
+    vector<vector<uint8_t>> streams;
+    vector<uint8_t> indices;
+
+    void reset(VertexFormat vertexFormat, uint vertices, uint indexTotal);
+    void writeVertex(uint index, const Vec3 &position, const Vec3 &normal, float u, float v);
+    void writeTriangle(uint triangle, uint a, uint b, uint c);
+    inline bool hasNormals() const { return format != VertexFormat::POSITION; }
+};
+
+/**
+ * Fills out with the shape at roughly the requested triangle count, at least 1, all shapes fit in
+ * a unit sphere around the origin and face outward with counter-clockwise front faces.
+ * The seed only affects SOUP.
+ */
+void generateGeometry(GeometryBuffers &out, GeometryShape shape, uint triangles, VertexFormat format, uint seed = SIMULATION_SEED);
+
+} // namespace cc
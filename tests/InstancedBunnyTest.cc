@@ -0,0 +1,432 @@
+#include "InstancedBunnyTest.h"
+#include "RenderPassAnalyzer.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+
+// 1 draws every bunny in one instanced draw with model matrices in a per-instance vertex stream,
+// 0 gives each bunny its own MVP uniform buffer and descriptor set the way DepthTest does
+#define USE_INSTANCED_ATTRIBUTES 1
+// the scene scales to 100000 bunnies, the per-object path gets very slow long before that
+#define BUNNY_COUNT   10000u
+#define BUNNY_SPACING 12.0f
+// three rows of the affine model matrix
+#define INSTANCE_STRIDE (12 * sizeof(float))
+
+namespace cc {
+
+void InstancedBunnyTest::destroy() {
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    CC_SAFE_DESTROY(_instanceBuffer);
+    CC_SAFE_DESTROY(_viewProjBuffer);
+    CC_SAFE_DESTROY(_descriptorSet);
+    for (uint i = 0u; i < _objectDescriptorSets.size(); i++) {
+        CC_SAFE_DESTROY(_objectDescriptorSets[i]);
+    }
+    _objectDescriptorSets.clear();
+    for (uint i = 0u; i < _objectBuffers.size(); i++) {
+        CC_SAFE_DESTROY(_objectBuffers[i]);
+    }
+    _objectBuffers.clear();
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_pipelineState);
+}
+
+bool InstancedBunnyTest::initialize() {
+    createShader();
+    createBuffers();
+    createInputAssembler();
+    createPipelineState();
+    return true;
+}
+
+void InstancedBunnyTest::createShader() {
+
+    ShaderSources sources;
+#if USE_INSTANCED_ATTRIBUTES
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+            layout(location = 1) in vec4 a_model0;
+            layout(location = 2) in vec4 a_model1;
+            layout(location = 3) in vec4 a_model2;
+
+            layout(set = 0, binding = 0) uniform ViewProj { mat4 u_viewProj; };
+
+            layout(location = 0) out vec3 v_color;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_viewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_color;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+            in vec4 a_model0;
+            in vec4 a_model1;
+            in vec4 a_model2;
+
+            layout(std140) uniform ViewProj { mat4 u_viewProj; };
+
+            out vec3 v_color;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_viewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_color;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            attribute vec4 a_model0;
+            attribute vec4 a_model1;
+            attribute vec4 a_model2;
+            uniform mat4 u_viewProj;
+            varying vec3 v_color;
+
+            void main () {
+                vec4 position = vec4(a_position, 1);
+                vec3 world = vec3(dot(a_model0, position), dot(a_model1, position), dot(a_model2, position));
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_viewProj * vec4(world, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_color;
+
+            void main () {
+                gl_FragColor = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    gfx::AttributeList attributeList = {
+        {"a_position", gfx::Format::RGB32F, false, 0, false, 0},
+        {"a_model0", gfx::Format::RGBA32F, false, 1, true, 1},
+        {"a_model1", gfx::Format::RGBA32F, false, 1, true, 2},
+        {"a_model2", gfx::Format::RGBA32F, false, 1, true, 3},
+    };
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "ViewProj", {{"u_viewProj", gfx::Type::MAT4, 1}}, 1}};
+#else
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+
+            layout(set = 0, binding = 0) uniform MVP_Matrix {
+                mat4 u_model, u_view, u_projection;
+            };
+
+            layout(location = 0) out vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_color;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+
+            layout(std140) uniform MVP_Matrix {
+                mat4 u_model, u_view, u_projection;
+            };
+
+            out vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_color;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            uniform mat4 u_model, u_view, u_projection;
+            varying vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.1 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_color;
+
+            void main () {
+                gl_FragColor = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
+    gfx::UniformList mvpMatrix = {
+        {"u_model", gfx::Type::MAT4, 1},
+        {"u_view", gfx::Type::MAT4, 1},
+        {"u_projection", gfx::Type::MAT4, 1},
+    };
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "MVP_Matrix", mvpMatrix, 1}};
+#endif
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = "Instanced Bunny Test";
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    _shader = _device->createShader(shaderInfo);
+}
+
+void InstancedBunnyTest::createBuffers() {
+    Mesh mesh;
+    bool valid = mesh.initWithFile("bunny.mesh");
+    CCASSERT(valid, "InstancedBunnyTest load mesh failed");
+
+    MeshData bunny;
+    bunny.initWithMesh(mesh);
+    bunny.optimize("InstancedBunnyTest");
+    vector<uint8_t> indices = bunny.packIndices();
+    _triangleCount = static_cast<uint>(bunny.indices.size() / 3u);
+
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(bunny.positions.size() * sizeof(float)),
+        3 * sizeof(float),
+    });
+    _vertexBuffer->update(bunny.positions.data(), 0, static_cast<uint>(bunny.positions.size() * sizeof(float)));
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(indices.size()),
+        bunny.getIndexStride(),
+    });
+    _indexBuffer->update(indices.data(), 0, static_cast<uint>(indices.size()));
+
+    // a square field of randomly turned bunnies centered on the origin
+    SeededRandom random;
+    uint side = static_cast<uint>(std::ceil(std::sqrt(static_cast<float>(BUNNY_COUNT))));
+    _fieldSize = side * BUNNY_SPACING;
+    float origin = -0.5f * BUNNY_SPACING * (side - 1u);
+    _models.resize(BUNNY_COUNT);
+    for (uint i = 0u; i < BUNNY_COUNT; ++i) {
+        Mat4::createTranslation(origin + BUNNY_SPACING * (i % side), 0.0f, origin + BUNNY_SPACING * (i / side), &_models[i]);
+        _models[i].rotateY(random.range(0.0f, 2.0f * math::PI));
+    }
+
+#if USE_INSTANCED_ATTRIBUTES
+    // static transforms, uploaded once; the affine rows are all the shader reads
+    vector<float> instances(BUNNY_COUNT * 12u);
+    for (uint i = 0u; i < BUNNY_COUNT; ++i) {
+        const float *m = _models[i].m;
+        float *dst = &instances[i * 12u];
+        for (uint row = 0u; row < 3u; ++row) {
+            dst[row * 4u] = m[row];
+            dst[row * 4u + 1u] = m[4u + row];
+            dst[row * 4u + 2u] = m[8u + row];
+            dst[row * 4u + 3u] = m[12u + row];
+        }
+    }
+    _instanceBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(instances.size() * sizeof(float)),
+        INSTANCE_STRIDE,
+    });
+    _instanceBuffer->update(instances.data(), 0, static_cast<uint>(instances.size() * sizeof(float)));
+
+    _viewProjBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(sizeof(Mat4)),
+    });
+#else
+    gfx::BufferInfo uniformBufferInfo = {
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::HOST | gfx::MemoryUsage::DEVICE,
+        TestBaseI::getUBOSize(3 * sizeof(Mat4)),
+    };
+    _objectBuffers.resize(BUNNY_COUNT);
+    for (uint i = 0u; i < BUNNY_COUNT; i++) {
+        _objectBuffers[i] = _device->createBuffer(uniformBufferInfo);
+    }
+#endif
+}
+
+void InstancedBunnyTest::createInputAssembler() {
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.push_back({"a_position", gfx::Format::RGB32F, false, 0, false});
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+#if USE_INSTANCED_ATTRIBUTES
+    inputAssemblerInfo.attributes.push_back({"a_model0", gfx::Format::RGBA32F, false, 1, true});
+    inputAssemblerInfo.attributes.push_back({"a_model1", gfx::Format::RGBA32F, false, 1, true});
+    inputAssemblerInfo.attributes.push_back({"a_model2", gfx::Format::RGBA32F, false, 1, true});
+    inputAssemblerInfo.vertexBuffers.emplace_back(_instanceBuffer);
+#endif
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+#if USE_INSTANCED_ATTRIBUTES
+    _inputAssembler->setInstanceCount(BUNNY_COUNT);
+#endif
+}
+
+void InstancedBunnyTest::createPipelineState() {
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+#if USE_INSTANCED_ATTRIBUTES
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(0, _viewProjBuffer);
+    _descriptorSet->update();
+#else
+    _objectDescriptorSets.resize(_objectBuffers.size());
+    for (uint i = 0u; i < _objectBuffers.size(); ++i) {
+        _objectDescriptorSets[i] = _device->createDescriptorSet({_descriptorSetLayout});
+        _objectDescriptorSets[i]->bindBuffer(0, _objectBuffers[i]);
+        _objectDescriptorSets[i]->update();
+    }
+#endif
+
+    gfx::PipelineStateInfo pipelineStateInfo;
+    pipelineStateInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineStateInfo.shader = _shader;
+    pipelineStateInfo.inputState = {_inputAssembler->getAttributes()};
+    pipelineStateInfo.renderPass = _fbo->getRenderPass();
+    pipelineStateInfo.depthStencilState.depthTest = true;
+    pipelineStateInfo.depthStencilState.depthWrite = true;
+    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineStateInfo.pipelineLayout = _pipelineLayout;
+    _pipelineState = _device->createPipelineState(pipelineStateInfo);
+}
+
+void InstancedBunnyTest::tick() {
+    lookupTime();
+    uint steps = _clock.advance(hostThread.dt);
+    for (uint i = 0; i < steps; ++i) {
+        _prevTime = _time;
+        _time += _clock.step;
+    }
+    float time = (_prevTime + (_time - _prevTime) * _clock.alpha) * 0.2f;
+
+    Mat4 view, projection;
+    float radius = _fieldSize * 0.8f;
+    Mat4::createLookAt(Vec3(radius * std::cos(time), _fieldSize * 0.4f, radius * std::sin(time)),
+                       Vec3::ZERO, Vec3(0.0f, 1.0f, 0.0f), &view);
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 1.0f, _fieldSize * 3.0f, &projection);
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    auto start = std::chrono::steady_clock::now();
+#if USE_INSTANCED_ATTRIBUTES
+    Mat4 viewProjection;
+    Mat4::multiply(projection, view, &viewProjection);
+    _viewProjBuffer->update(viewProjection.m, 0, sizeof(Mat4));
+#else
+    for (uint i = 0u; i < BUNNY_COUNT; i++) {
+        _objectBuffers[i]->update(_models[i].m, 0, sizeof(Mat4));
+        _objectBuffers[i]->update(view.m, sizeof(Mat4), sizeof(Mat4));
+        _objectBuffers[i]->update(projection.m, 2 * sizeof(Mat4), sizeof(Mat4));
+    }
+#endif
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("InstancedBunnyTest", _fbo, renderArea);
+    commandBuffer->bindInputAssembler(_inputAssembler);
+    commandBuffer->bindPipelineState(_pipelineState);
+#if USE_INSTANCED_ATTRIBUTES
+    commandBuffer->bindDescriptorSet(0, _descriptorSet);
+    commandBuffer->draw(_inputAssembler);
+#else
+    for (uint i = 0u; i < BUNNY_COUNT; i++) {
+        commandBuffer->bindDescriptorSet(0, _objectDescriptorSets[i]);
+        commandBuffer->draw(_inputAssembler);
+    }
+#endif
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+    _statsRecordTime += TestBaseI::millisecondsSince(start);
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+
+    _statsFrameTime += hostThread.dt;
+    if (++_statsFrames == 60u) {
+        CC_LOG_INFO("InstancedBunnyTest (%s): %u bunnies, %.1fM triangles, %u draws per frame | %.3fms update + record, %.3fms frame",
+                    USE_INSTANCED_ATTRIBUTES ? "instanced" : "per-object UBO", BUNNY_COUNT, BUNNY_COUNT * _triangleCount * 1e-6f,
+                    USE_INSTANCED_ATTRIBUTES ? 1u : BUNNY_COUNT, _statsRecordTime / _statsFrames, _statsFrameTime * 1000.f / _statsFrames);
+        _statsFrames = 0u;
+        _statsFrameTime = 0.0f;
+        _statsRecordTime = 0.0f;
+    }
+}
+
+} // namespace cc
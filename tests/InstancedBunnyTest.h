@@ -0,0 +1,50 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+class InstancedBunnyTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(InstancedBunnyTest)
+    InstancedBunnyTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~InstancedBunnyTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    void createShader();
+    void createBuffers();
+    void createInputAssembler();
+    void createPipelineState();
+
+    gfx::Shader* _shader = nullptr;
+    gfx::Buffer* _vertexBuffer = nullptr;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::Buffer* _instanceBuffer = nullptr;
+    gfx::Buffer* _viewProjBuffer = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    vector<gfx::Buffer*> _objectBuffers;
+    vector<gfx::DescriptorSet*> _objectDescriptorSets;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+    gfx::PipelineState* _pipelineState = nullptr;
+
+    vector<Mat4> _models;
+    float _fieldSize = 0.0f;
+    uint _triangleCount = 0u;
+
+    FixedStep _clock;
+    float _time = 0.0f;
+    float _prevTime = 0.0f;
+    uint _statsFrames = 0u;
+    float _statsFrameTime = 0.0f;
+    float _statsRecordTime = 0.0f;
+};
+
+} // namespace cc
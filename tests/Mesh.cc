@@ -0,0 +1,168 @@
+#include "Mesh.h"
+
+#if CC_PLATFORM != CC_PLATFORM_WINDOWS && CC_PLATFORM != CC_PLATFORM_ANDROID
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace cc {
+
+bool MappedFile::open(const String &path) {
+    close();
+
+#if CC_PLATFORM == CC_PLATFORM_WINDOWS
+    _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (_file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_file, &size) || !size.QuadPart) {
+        close();
+        return false;
+    }
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!_mapping) {
+        close();
+        return false;
+    }
+    _data = static_cast<const uint8_t *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!_data) {
+        close();
+        return false;
+    }
+    _size = static_cast<size_t>(size.QuadPart);
+#elif CC_PLATFORM == CC_PLATFORM_ANDROID
+    _contents = FileUtils::getInstance()->getDataFromFile(path);
+    if (_contents.isNull()) return false;
+    _data = _contents.getBytes();
+    _size = static_cast<size_t>(_contents.getSize());
+#else
+    _fd = ::open(path.c_str(), O_RDONLY);
+    if (_fd < 0) return false;
+
+    struct stat st;
+    if (fstat(_fd, &st) || !st.st_size) {
+        close();
+        return false;
+    }
+    void *data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (data == MAP_FAILED) {
+        close();
+        return false;
+    }
+    // everything is read once front to back on its way to the GPU
+    madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    _data = static_cast<const uint8_t *>(data);
+    _size = static_cast<size_t>(st.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close() {
+#if CC_PLATFORM == CC_PLATFORM_WINDOWS
+    if (_data) UnmapViewOfFile(_data);
+    if (_mapping) CloseHandle(_mapping);
+    if (_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+    _mapping = nullptr;
+    _file = INVALID_HANDLE_VALUE;
+#elif CC_PLATFORM == CC_PLATFORM_ANDROID
+    _contents = Data();
+#else
+    if (_data) munmap(const_cast<uint8_t *>(_data), _size);
+    if (_fd >= 0) ::close(_fd);
+    _fd = -1;
+#endif
+    _data = nullptr;
+    _size = 0u;
+}
+
+bool Mesh::initWithFile(const String &file) {
+    _header = nullptr;
+    _streams = nullptr;
+
+    String path = FileUtils::getInstance()->fullPathForFilename(file);
+    if (!_file.open(path)) {
+        CC_LOG_ERROR("Mesh: failed to open %s", file.c_str());
+        return false;
+    }
+
+    const uint8_t *data = _file.getData();
+    size_t size = _file.getSize();
+    const MeshHeader *header = reinterpret_cast<const MeshHeader *>(data);
+    if (size < sizeof(MeshHeader) || header->magic != MESH_MAGIC) {
+        CC_LOG_ERROR("Mesh: %s is not a mesh file", file.c_str());
+        return false;
+    }
+    if (header->version != MESH_VERSION) {
+        CC_LOG_ERROR("Mesh: %s has version %u, expected %u", file.c_str(), header->version, MESH_VERSION);
+        return false;
+    }
+
+    // validate every range up front so accessors never read past the mapping
+    const MeshStream *streams = reinterpret_cast<const MeshStream *>(data + sizeof(MeshHeader));
+    bool valid = sizeof(MeshHeader) + header->streamCount * sizeof(MeshStream) <= size;
+    for (uint i = 0u; valid && i < header->streamCount; ++i) {
+        uint64_t end = uint64_t(streams[i].offset) + uint64_t(header->vertexCount) * streams[i].components * sizeof(float);
+        valid = streams[i].offset % 4u == 0u && end <= size;
+    }
+    valid = valid && (header->indexStride == 2u || header->indexStride == 4u) && header->indexOffset % 4u == 0u &&
+            uint64_t(header->indexOffset) + uint64_t(header->indexCount) * header->indexStride <= size;
+    if (!valid) {
+        CC_LOG_ERROR("Mesh: %s is truncated or corrupt", file.c_str());
+        return false;
+    }
+
+    _header = header;
+    _streams = streams;
+    return true;
+}
+
+bool Mesh::write(const String &path, const float *positions, uint vertexCount, const void *indices, uint indexCount, uint indexStride) {
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp) return false;
+
+    MeshHeader header;
+    header.vertexCount = vertexCount;
+    header.indexCount = indexCount;
+    header.indexStride = indexStride;
+    header.streamCount = 1u;
+
+    MeshStream position;
+    position.offset = sizeof(MeshHeader) + sizeof(MeshStream);
+    uint positionSize = vertexCount * 3u * sizeof(float);
+    header.indexOffset = position.offset + positionSize;
+
+    for (uint c = 0u; c < 3u; ++c) {
+        header.boundsMin[c] = vertexCount ? positions[c] : 0.0f;
+        header.boundsMax[c] = header.boundsMin[c];
+    }
+    for (uint v = 0u; v < vertexCount; ++v) {
+        for (uint c = 0u; c < 3u; ++c) {
+            header.boundsMin[c] = std::min(header.boundsMin[c], positions[v * 3u + c]);
+            header.boundsMax[c] = std::max(header.boundsMax[c], positions[v * 3u + c]);
+        }
+    }
+
+    // 16-bit index data is padded out to the next 4-byte boundary
+    uint indexSize = indexCount * indexStride;
+    uint padding = (4u - indexSize % 4u) % 4u;
+    const uint8_t zeros[4] = {0u, 0u, 0u, 0u};
+
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+              fwrite(&position, sizeof(position), 1, fp) == 1 &&
+              (!positionSize || fwrite(positions, positionSize, 1, fp) == 1) &&
+              (!indexSize || fwrite(indices, indexSize, 1, fp) == 1) &&
+              (!padding || fwrite(zeros, padding, 1, fp) == 1);
+    ok = fclose(fp) == 0 && ok;
+    return ok;
+}
+
+const MeshStream *Mesh::getStream(MeshSemantic semantic) const {
+    for (uint i = 0u; i < _header->streamCount; ++i) {
+        if (_streams[i].semantic == semantic) return &_streams[i];
+    }
+    return nullptr;
+}
+
+} // namespace cc
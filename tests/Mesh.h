@@ -0,0 +1,107 @@
+#pragma once
+
+#include "TestBase.h"
+
+#if CC_PLATFORM == CC_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#endif
+
+#define MESH_MAGIC   0x4853454Du // "MESH"
+#define MESH_VERSION 1u
+
+namespace cc {
+
+enum class MeshSemantic : uint32_t {
+    POSITION,
+    NORMAL,
+    TEXCOORD,
+};
+
+/**
+ * On-disk layout, little endian, every block 4-byte aligned:
+ *     MeshHeader | MeshStream[streamCount] | vertex stream data... | index data
+ * Offsets are relative to the start of the file so a mapped file is used in place.
+ */
+struct MeshHeader {
+    uint32_t magic = MESH_MAGIC;
+    uint32_t version = MESH_VERSION;
+    uint32_t vertexCount = 0u;
+    uint32_t indexCount = 0u;
+    uint32_t indexStride = 0u; // 2 or 4
+    uint32_t indexOffset = 0u;
+    uint32_t streamCount = 0u;
+    float boundsMin[3] = {0.0f, 0.0f, 0.0f};
+    float boundsMax[3] = {0.0f, 0.0f, 0.0f};
+};
+
+struct MeshStream {
+    MeshSemantic semantic = MeshSemantic::POSITION;
+    uint32_t components = 3u; // 32-bit floats per vertex, tightly packed
+    uint32_t offset = 0u;
+};
+
+/**
+ * Read-only view of a whole file, memory mapped where the platform allows it.
+ * Android assets live inside the APK and can't be mapped by path, they are read into memory instead.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    bool open(const String &path);
+    void close();
+
+    inline const uint8_t *getData() const { return _data; }
+    inline size_t getSize() const { return _size; }
+
+private:
+    const uint8_t *_data = nullptr;
+    size_t _size = 0u;
+
+#if CC_PLATFORM == CC_PLATFORM_WINDOWS
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+#elif CC_PLATFORM == CC_PLATFORM_ANDROID
+    Data _contents;
+#else
+    int _fd = -1;
+#endif
+};
+
+/**
+ * Versioned binary mesh. Stream and index pointers point straight into the mapped file,
+ * so they can be handed to Buffer::update without an intermediate copy.
+ */
+class Mesh {
+public:
+    Mesh() = default;
+    ~Mesh() = default;
+
+    // file is resolved through FileUtils search paths
+    bool initWithFile(const String &file);
+    // writes a position-only mesh, used to produce test assets
+    static bool write(const String &path, const float *positions, uint vertexCount, const void *indices, uint indexCount, uint indexStride);
+
+    const MeshStream *getStream(MeshSemantic semantic) const;
+    inline const void *getStreamData(const MeshStream &stream) const { return _file.getData() + stream.offset; }
+    inline uint getStreamSize(const MeshStream &stream) const { return _header->vertexCount * stream.components * sizeof(float); }
+
+    inline const void *getIndexData() const { return _file.getData() + _header->indexOffset; }
+    inline uint getIndexSize() const { return _header->indexCount * _header->indexStride; }
+    inline uint getIndexStride() const { return _header->indexStride; }
+    inline uint getIndexCount() const { return _header->indexCount; }
+    inline uint getVertexCount() const { return _header->vertexCount; }
+    inline Vec3 getBoundsMin() const { return Vec3(_header->boundsMin[0], _header->boundsMin[1], _header->boundsMin[2]); }
+    inline Vec3 getBoundsMax() const { return Vec3(_header->boundsMax[0], _header->boundsMax[1], _header->boundsMax[2]); }
+
+private:
+    MappedFile _file;
+    const MeshHeader *_header = nullptr;
+    const MeshStream *_streams = nullptr;
+};
+
+} // namespace cc
@@ -0,0 +1,374 @@
+#include "MeshLoadTest.h"
+#include "RenderPassAnalyzer.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+
+// 1 extends the generated series to 10M triangles; generating and optimizing those takes hundreds of MB on
+// the loading thread and their buffers another ~180MB, so by default it stops at 100k, all 16 bit indexed
+#define LARGE_MESH_BENCHMARK    0
+// largest generated mesh, the series goes up by 10x from 10k triangles
+#define MAX_BENCHMARK_TRIANGLES (LARGE_MESH_BENCHMARK ? 10000000u : 100000u)
+#define FRAMES_PER_MESH         120u
+// 1 streams meshes in chunks on a background thread, 0 maps the whole file and uploads it in one go
+#define USE_MESH_STREAMING      1
+
+namespace cc {
+
+namespace {
+uint getGridQuadsPerSide(uint triangles) {
+    return static_cast<uint>(std::ceil(std::sqrt(triangles * 0.5f)));
+}
+
+// wavy grid on the xz plane with at least the given number of triangles, cache optimized like any other asset
+bool writeGridMesh(const String &path, uint triangles) {
+    uint quadsPerSide = getGridQuadsPerSide(triangles);
+    uint vertsPerSide = quadsPerSide + 1u;
+
+    MeshData grid;
+    grid.vertexCount = vertsPerSide * vertsPerSide;
+    vector<float> &positions = grid.positions;
+    positions.resize(grid.vertexCount * 3u);
+    for (uint z = 0u; z < vertsPerSide; ++z) {
+        for (uint x = 0u; x < vertsPerSide; ++x) {
+            float *p = &positions[(z * vertsPerSide + x) * 3u];
+            p[0] = float(x) / quadsPerSide * 20.0f - 10.0f;
+            p[2] = float(z) / quadsPerSide * 20.0f - 10.0f;
+            p[1] = std::sin(p[0]) * std::cos(p[2]);
+        }
+    }
+
+    vector<uint> &indices = grid.indices;
+    indices.reserve(quadsPerSide * quadsPerSide * 6u);
+    for (uint z = 0u; z < quadsPerSide; ++z) {
+        for (uint x = 0u; x < quadsPerSide; ++x) {
+            uint i = z * vertsPerSide + x;
+            indices.insert(indices.end(), {i, i + vertsPerSide, i + 1u, i + 1u, i + vertsPerSide, i + vertsPerSide + 1u});
+        }
+    }
+
+    grid.optimize(path.c_str());
+    vector<uint8_t> packed = grid.packIndices();
+    return Mesh::write(path, positions.data(), grid.vertexCount, packed.data(), static_cast<uint>(indices.size()), grid.getIndexStride());
+}
+} // namespace
+
+void MeshLoadTest::destroy() {
+    CC_SAFE_DESTROY(_inputAssembler);
+    _streamer.close();
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    CC_SAFE_DESTROY(_uniformBuffer);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_pipelineState);
+}
+
+bool MeshLoadTest::initialize() {
+    createShader();
+    createMeshFiles();
+    createPipeline();
+    return loadMesh(_meshFiles[0]);
+}
+
+void MeshLoadTest::createShader() {
+
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+
+            layout(set = 0, binding = 0) uniform MVP_Matrix {
+                mat4 u_model, u_view, u_projection;
+            };
+
+            layout(location = 0) out vec3 v_position;
+
+            void main () {
+                v_position = a_position * 0.05 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_position;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position, 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+
+            layout(std140) uniform MVP_Matrix {
+                mat4 u_model, u_view, u_projection;
+            };
+
+            out vec3 v_position;
+
+            void main () {
+                v_position = a_position * 0.05 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_position;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position, 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            uniform mat4 u_model, u_view, u_projection;
+            varying vec3 v_position;
+
+            void main () {
+                v_position = a_position * 0.05 + 0.5;
+                gl_Position = u_projection * u_view * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_position;
+
+            void main () {
+                gl_FragColor = vec4(v_position, 1);
+            }
+        )",
+    };
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
+    gfx::UniformList mvpMatrix = {
+        {"u_model", gfx::Type::MAT4, 1},
+        {"u_view", gfx::Type::MAT4, 1},
+        {"u_projection", gfx::Type::MAT4, 1},
+    };
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "MVP_Matrix", mvpMatrix, 1}};
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = "Mesh Load Test";
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    _shader = _device->createShader(shaderInfo);
+}
+
+void MeshLoadTest::createMeshFiles() {
+    // the bunny ships with the app, the larger meshes are generated once into the writable path
+    _meshFiles.push_back("bunny.mesh");
+
+    String dir = FileUtils::getInstance()->getWritablePath();
+    for (uint triangles = 10000u; triangles <= MAX_BENCHMARK_TRIANGLES; triangles *= 10u) {
+        uint vertsPerSide = getGridQuadsPerSide(triangles) + 1u;
+        if (vertsPerSide * vertsPerSide > 0x10000u && !_device->hasFeature(gfx::Feature::ELEMENT_INDEX_UINT)) {
+            CC_LOG_INFO("MeshLoadTest: skipping %u triangles, 32 bit indices are not supported", triangles);
+            break;
+        }
+        String path = dir + "grid_" + std::to_string(triangles) + ".mesh";
+        if (!FileUtils::getInstance()->isFileExist(path)) {
+            auto start = std::chrono::steady_clock::now();
+            if (!writeGridMesh(path, triangles)) {
+                CC_LOG_ERROR("MeshLoadTest: failed to write %s", path.c_str());
+                continue;
+            }
+            CC_LOG_INFO("MeshLoadTest: generated %s in %.1fms", path.c_str(), TestBaseI::millisecondsSince(start));
+        }
+        _meshFiles.push_back(path);
+    }
+}
+
+void MeshLoadTest::createPipeline() {
+    _uniformBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(3 * sizeof(Mat4)),
+    });
+    Mat4 model;
+    _uniformBuffer->update(model.m, 0, sizeof(model));
+
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(0, _uniformBuffer);
+    _descriptorSet->update();
+
+    gfx::PipelineStateInfo pipelineInfo;
+    pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineInfo.shader = _shader;
+    pipelineInfo.inputState = {{{"a_position", gfx::Format::RGB32F, false, 0, false}}};
+    pipelineInfo.renderPass = _fbo->getRenderPass();
+    pipelineInfo.depthStencilState.depthTest = true;
+    pipelineInfo.depthStencilState.depthWrite = true;
+    pipelineInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineInfo.pipelineLayout = _pipelineLayout;
+    _pipelineState = _device->createPipelineState(pipelineInfo);
+}
+
+bool MeshLoadTest::loadMesh(const String &file) {
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    _streamer.close();
+    _streamingFile.clear();
+
+#if USE_MESH_STREAMING
+    // APK assets can't be streamed from a path, they fall back to the mapped load
+    if (streamMesh(file)) return true;
+#endif
+    return mapMesh(file);
+}
+
+bool MeshLoadTest::mapMesh(const String &file) {
+    auto start = std::chrono::steady_clock::now();
+
+    Mesh mesh;
+    if (!mesh.initWithFile(file)) return false;
+    float mapTime = TestBaseI::millisecondsSince(start);
+
+    // pages are faulted in by the uploads themselves, nothing is copied on the way
+    const MeshStream *positions = mesh.getStream(MeshSemantic::POSITION);
+    if (!positions || positions->components != 3u) {
+        CC_LOG_ERROR("MeshLoadTest: %s has no 3 component position stream", file.c_str());
+        return false;
+    }
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        mesh.getStreamSize(*positions),
+        3 * sizeof(float),
+    });
+    _vertexBuffer->update(mesh.getStreamData(*positions), 0, mesh.getStreamSize(*positions));
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        mesh.getIndexSize(),
+        mesh.getIndexStride(),
+    });
+    _indexBuffer->update(mesh.getIndexData(), 0, mesh.getIndexSize());
+
+    float totalTime = TestBaseI::millisecondsSince(start);
+    float megabytes = (mesh.getStreamSize(*positions) + mesh.getIndexSize()) / (1024.f * 1024.f);
+    CC_LOG_INFO("MeshLoadTest: %s, %u triangles, %.1fMB: %.3fms map, %.3fms map + upload (%.0fMB/s)",
+                file.c_str(), mesh.getIndexCount() / 3, megabytes, mapTime, totalTime, megabytes * 1000.f / totalTime);
+
+    gfx::Attribute position = {"a_position", gfx::Format::RGB32F, false, 0, false};
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.emplace_back(std::move(position));
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+    return true;
+}
+
+bool MeshLoadTest::streamMesh(const String &file) {
+    _loadStart = std::chrono::steady_clock::now();
+    if (!_streamer.open(_device, file)) return false;
+    _streamingFile = file;
+    _firstPixelLogged = false;
+
+    gfx::Attribute position = {"a_position", gfx::Format::RGB32F, false, 0, false};
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.emplace_back(std::move(position));
+    inputAssemblerInfo.vertexBuffers.emplace_back(_streamer.getVertexBuffer());
+    inputAssemblerInfo.indexBuffer = _streamer.getIndexBuffer();
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+    return true;
+}
+
+void MeshLoadTest::tick() {
+    lookupTime();
+    _time += hostThread.dt;
+
+    if (!_streamingFile.empty() && _streamer.hasFailed()) {
+        CC_LOG_ERROR("MeshLoadTest: streaming %s failed", _streamingFile.c_str());
+        CC_SAFE_DESTROY(_inputAssembler);
+        _streamer.close();
+        _streamingFile.clear();
+    }
+
+    // a streamed mesh gets its FRAMES_PER_MESH frames once it is complete
+    if ((_streamingFile.empty() || _streamer.isDone()) && ++_frames == FRAMES_PER_MESH) {
+        _frames = 0u;
+        _meshIndex = (_meshIndex + 1u) % _meshFiles.size();
+        loadMesh(_meshFiles[_meshIndex]);
+    }
+
+    Mat4 view, projection;
+    Mat4::createLookAt(Vec3(25.0f * std::cos(_time * 0.3f), 15.0f, 25.0f * std::sin(_time * 0.3f)),
+                       Vec3(0.0f, 2.5f, 0.0f), Vec3(0.0f, 1.0f, 0.f), &view);
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 0.01f, 1000.0f, &projection);
+
+    // whatever prefix of the mesh has arrived is drawn
+    bool loading = !_streamingFile.empty() && !_streamer.isDone();
+    if (loading) _streamer.upload();
+    uint drawableIndexCount = _streamingFile.empty() ? 0u : _streamer.getDrawableIndexCount();
+    if (drawableIndexCount) _inputAssembler->setIndexCount(drawableIndexCount);
+    bool draw = _inputAssembler && (_streamingFile.empty() || drawableIndexCount);
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    _uniformBuffer->update(view.m, sizeof(Mat4), sizeof(view));
+    _uniformBuffer->update(projection.m, sizeof(Mat4) * 2, sizeof(projection));
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("MeshLoadTest", _fbo, renderArea);
+    if (draw) {
+        commandBuffer->bindInputAssembler(_inputAssembler);
+        commandBuffer->bindPipelineState(_pipelineState);
+        commandBuffer->bindDescriptorSet(0, _descriptorSet);
+        commandBuffer->draw(_inputAssembler);
+    }
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+
+    if (_streamingFile.empty()) return;
+    if (draw && !_firstPixelLogged) {
+        _firstPixelLogged = true;
+        CC_LOG_INFO("MeshLoadTest: streaming %s, first pixel after %.3fms with %u of %u triangles",
+                    _streamingFile.c_str(), TestBaseI::millisecondsSince(_loadStart), drawableIndexCount / 3u, _streamer.getIndexCount() / 3u);
+    }
+    if (loading && _streamer.isDone()) {
+        float totalTime = TestBaseI::millisecondsSince(_loadStart);
+        float megabytes = _streamer.getTotalBytes() / (1024.f * 1024.f);
+        CC_LOG_INFO("MeshLoadTest: streamed %s, %u triangles, %.1fMB through %.1fMB of staging: %.3fms total (%.0fMB/s)",
+                    _streamingFile.c_str(), _streamer.getIndexCount() / 3u, megabytes, _streamer.getStagingSize() / (1024.f * 1024.f),
+                    totalTime, megabytes * 1000.f / totalTime);
+    }
+}
+
+} // namespace cc
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "TestBase.h"
+#include "MeshStreamer.h"
+
+namespace cc {
+
+class MeshLoadTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(MeshLoadTest)
+    MeshLoadTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~MeshLoadTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    void createShader();
+    void createMeshFiles();
+    void createPipeline();
+    bool loadMesh(const String &file);
+    bool mapMesh(const String &file);
+    bool streamMesh(const String &file);
+
+    gfx::Shader* _shader = nullptr;
+    gfx::Buffer* _vertexBuffer = nullptr;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::Buffer* _uniformBuffer = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::PipelineState* _pipelineState = nullptr;
+
+    MeshStreamer _streamer;
+    std::chrono::steady_clock::time_point _loadStart;
+    bool _firstPixelLogged = false;
+    String _streamingFile; // empty unless a mesh is streamed
+
+    vector<String> _meshFiles;
+    uint _meshIndex = 0u;
+    uint _frames = 0u;
+    float _time = 0.0f;
+};
+
+} // namespace cc
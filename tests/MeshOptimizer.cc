@@ -0,0 +1,516 @@
+#include "MeshOptimizer.h"
+#include "Mesh.h"
+#include "MeshSimplifier.h"
+#include <cfloat>
+
+namespace cc {
+
+namespace {
+// compressed vertex -> triangle adjacency
+struct Adjacency {
+    vector<uint> offsets;
+    vector<uint> triangles;
+
+    void build(const uint *indices, uint indexCount, uint vertexCount) {
+        offsets.assign(vertexCount + 1u, 0u);
+        for (uint i = 0u; i < indexCount; ++i) ++offsets[indices[i] + 1u];
+        for (uint v = 0u; v < vertexCount; ++v) offsets[v + 1u] += offsets[v];
+
+        triangles.resize(indexCount);
+        vector<uint> cursor(offsets.begin(), offsets.end() - 1);
+        for (uint i = 0u; i < indexCount; ++i) triangles[cursor[indices[i]]++] = i / 3u;
+    }
+};
+
+// unnormalized face normal, its length is twice the triangle area
+Vec3 faceNormal(const float *positions, const uint *triangle) {
+    const float *a = positions + triangle[0] * 3u;
+    const float *b = positions + triangle[1] * 3u;
+    const float *c = positions + triangle[2] * 3u;
+    Vec3 ab(b[0] - a[0], b[1] - a[1], b[2] - a[2]);
+    Vec3 ac(c[0] - a[0], c[1] - a[1], c[2] - a[2]);
+    return Vec3(ab.y * ac.z - ab.z * ac.y, ab.z * ac.x - ab.x * ac.z, ab.x * ac.y - ab.y * ac.x);
+}
+
+Vec3 faceCentroid(const float *positions, const uint *triangle) {
+    Vec3 centroid;
+    for (uint k = 0u; k < 3u; ++k) {
+        const float *p = positions + triangle[k] * 3u;
+        centroid += Vec3(p[0], p[1], p[2]);
+    }
+    return centroid * (1.0f / 3.0f);
+}
+
+// counts fragments passing a LESS depth test, sampled at pixel centers
+void rasterize(vector<float> &depth, uint size, const Vec3 &a, const Vec3 &b, const Vec3 &c, uint &shaded) {
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    // back facing or degenerate
+    if (area <= 0.0f) return;
+
+    int minX = std::max(0, static_cast<int>(std::floor(std::min({a.x, b.x, c.x}))));
+    int minY = std::max(0, static_cast<int>(std::floor(std::min({a.y, b.y, c.y}))));
+    int maxX = std::min(static_cast<int>(size) - 1, static_cast<int>(std::ceil(std::max({a.x, b.x, c.x}))));
+    int maxY = std::min(static_cast<int>(size) - 1, static_cast<int>(std::ceil(std::max({a.y, b.y, c.y}))));
+
+    float invArea = 1.0f / area;
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            float px = x + 0.5f;
+            float py = y + 0.5f;
+            float w0 = (c.x - b.x) * (py - b.y) - (c.y - b.y) * (px - b.x);
+            float w1 = (a.x - c.x) * (py - c.y) - (a.y - c.y) * (px - c.x);
+            float w2 = (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+            if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) continue;
+
+            float z = (w0 * a.z + w1 * b.z + w2 * c.z) * invArea;
+            float &stored = depth[y * size + x];
+            if (z < stored) {
+                stored = z;
+                ++shaded;
+            }
+        }
+    }
+}
+
+// soft boundaries: cut a hard cluster as soon as the ACMR since the last cut, starting from a cold
+// cache, is back within threshold of what the cache order achieved over the hard cluster
+void findClusters(vector<uint> &clusters, const uint *indices, uint vertexCount, const vector<uint> &misses,
+                  const vector<uint> &hardClusters, float threshold, uint cacheSize) {
+    clusters.clear();
+    vector<uint> cacheTime(vertexCount, 0u);
+    uint time = cacheSize + 1u;
+    for (uint h = 0u; h + 1u < hardClusters.size(); ++h) {
+        uint begin = hardClusters[h];
+        uint end = hardClusters[h + 1u];
+
+        uint hardMisses = 0u;
+        for (uint t = begin; t < end; ++t) hardMisses += misses[t];
+        float target = float(hardMisses) / (end - begin) * threshold;
+
+        uint start = begin;
+        uint startMisses = 0u;
+        time += cacheSize + 1u;
+        clusters.push_back(start);
+        for (uint t = begin; t < end; ++t) {
+            for (uint k = 0u; k < 3u; ++k) {
+                uint v = indices[t * 3u + k];
+                if (time - cacheTime[v] > cacheSize) {
+                    cacheTime[v] = time++;
+                    ++startMisses;
+                }
+            }
+            if (t + 1u < end && float(startMisses) / (t + 1u - start) <= target) {
+                start = t + 1u;
+                startMisses = 0u;
+                time += cacheSize + 1u;
+                clusters.push_back(start);
+            }
+        }
+    }
+    clusters.push_back(hardClusters.back());
+}
+
+// writes the clusters to dst by occlusion potential, how far a cluster sits out along its own average normal
+void sortClusters(uint *dst, const uint *indices, const float *positions, const vector<uint> &clusters) {
+    uint clusterCount = static_cast<uint>(clusters.size()) - 1u;
+    vector<Vec3> clusterCentroids(clusterCount);
+    vector<Vec3> clusterNormals(clusterCount);
+    Vec3 meshCentroid;
+    float meshArea = 0.0f;
+    for (uint c = 0u; c < clusterCount; ++c) {
+        float clusterArea = 0.0f;
+        for (uint t = clusters[c]; t < clusters[c + 1u]; ++t) {
+            Vec3 normal = faceNormal(positions, indices + t * 3u);
+            float area = normal.length();
+            Vec3 centroid = faceCentroid(positions, indices + t * 3u) * area;
+            clusterCentroids[c] += centroid;
+            clusterNormals[c] += normal;
+            clusterArea += area;
+            meshCentroid += centroid;
+            meshArea += area;
+        }
+        if (clusterArea > 0.0f) clusterCentroids[c] *= 1.0f / clusterArea;
+        clusterNormals[c].normalize();
+    }
+    if (meshArea > 0.0f) meshCentroid *= 1.0f / meshArea;
+
+    vector<float> potential(clusterCount);
+    vector<uint> order(clusterCount);
+    for (uint c = 0u; c < clusterCount; ++c) {
+        potential[c] = (clusterCentroids[c] - meshCentroid).dot(clusterNormals[c]);
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint a, uint b) { return potential[a] > potential[b]; });
+
+    uint written = 0u;
+    for (uint c : order) {
+        for (uint t = clusters[c]; t < clusters[c + 1u]; ++t) {
+            for (uint k = 0u; k < 3u; ++k) dst[written++] = indices[t * 3u + k];
+        }
+    }
+}
+} // namespace
+
+VertexCacheStats analyzeVertexCache(const uint *indices, uint indexCount, uint vertexCount, uint cacheSize) {
+    VertexCacheStats stats;
+    if (!indexCount) return stats;
+
+    // a vertex is still cached while fewer than cacheSize misses happened since it was loaded
+    vector<uint> cacheTime(vertexCount, 0u);
+    vector<bool> referenced(vertexCount, false);
+    uint time = cacheSize + 1u;
+    uint unique = 0u;
+
+    for (uint i = 0u; i < indexCount; ++i) {
+        uint v = indices[i];
+        if (time - cacheTime[v] > cacheSize) {
+            cacheTime[v] = time++;
+            ++stats.transforms;
+        }
+        if (!referenced[v]) {
+            referenced[v] = true;
+            ++unique;
+        }
+    }
+
+    stats.acmr = float(stats.transforms) / (indexCount / 3u);
+    stats.atvr = float(stats.transforms) / unique;
+    return stats;
+}
+
+OverdrawStats analyzeOverdraw(const uint *indices, uint indexCount, const float *positions, uint vertexCount, uint viewCount) {
+    OverdrawStats stats;
+    if (!vertexCount || !indexCount) return stats;
+
+    Vec3 boundsMin(positions[0], positions[1], positions[2]);
+    Vec3 boundsMax = boundsMin;
+    for (uint v = 1u; v < vertexCount; ++v) {
+        const float *p = positions + v * 3u;
+        boundsMin.set(std::min(boundsMin.x, p[0]), std::min(boundsMin.y, p[1]), std::min(boundsMin.z, p[2]));
+        boundsMax.set(std::max(boundsMax.x, p[0]), std::max(boundsMax.y, p[1]), std::max(boundsMax.z, p[2]));
+    }
+    Vec3 center = (boundsMin + boundsMax) * 0.5f;
+    float radius = std::max((boundsMax - boundsMin).length() * 0.5f, 1e-6f);
+    float scale = OVERDRAW_VIEWPORT_SIZE * 0.5f / radius;
+
+    vector<float> depth(OVERDRAW_VIEWPORT_SIZE * OVERDRAW_VIEWPORT_SIZE);
+    vector<Vec3> projected(vertexCount);
+
+    for (uint view = 0u; view < viewCount; ++view) {
+        // fibonacci sphere, the camera looks along -forward
+        float z = 1.0f - (view + 0.5f) * 2.0f / viewCount;
+        float r = std::sqrt(1.0f - z * z);
+        float phi = view * math::PI * (3.0f - std::sqrt(5.0f));
+        Vec3 forward(r * std::cos(phi), r * std::sin(phi), z);
+        Vec3 helper = std::abs(forward.y) < 0.99f ? Vec3(0.0f, 1.0f, 0.0f) : Vec3(1.0f, 0.0f, 0.0f);
+        Vec3 right(helper.y * forward.z - helper.z * forward.y, helper.z * forward.x - helper.x * forward.z, helper.x * forward.y - helper.y * forward.x);
+        right.normalize();
+        Vec3 up(forward.y * right.z - forward.z * right.y, forward.z * right.x - forward.x * right.z, forward.x * right.y - forward.y * right.x);
+
+        for (uint v = 0u; v < vertexCount; ++v) {
+            const float *p = positions + v * 3u;
+            Vec3 offset(p[0] - center.x, p[1] - center.y, p[2] - center.z);
+            // smaller is nearer, the camera sits on the +forward side
+            projected[v].set((offset.dot(right) + radius) * scale, (offset.dot(up) + radius) * scale, -offset.dot(forward));
+        }
+
+        std::fill(depth.begin(), depth.end(), FLT_MAX);
+        for (uint i = 0u; i + 2u < indexCount; i += 3u) {
+            rasterize(depth, OVERDRAW_VIEWPORT_SIZE, projected[indices[i]], projected[indices[i + 1u]], projected[indices[i + 2u]], stats.shaded);
+        }
+        for (float d : depth) stats.covered += d != FLT_MAX;
+    }
+
+    stats.overdraw = stats.covered ? float(stats.shaded) / stats.covered : 0.0f;
+    return stats;
+}
+
+void optimizeVertexCache(uint *dst, const uint *indices, uint indexCount, uint vertexCount, uint cacheSize) {
+    if (!indexCount || !vertexCount) return;
+
+    Adjacency adjacency;
+    adjacency.build(indices, indexCount, vertexCount);
+
+    vector<uint> live(vertexCount);
+    for (uint v = 0u; v < vertexCount; ++v) live[v] = adjacency.offsets[v + 1u] - adjacency.offsets[v];
+
+    vector<uint> cacheTime(vertexCount, 0u);
+    vector<bool> emitted(indexCount / 3u, false);
+    vector<uint> deadEnd;
+    vector<uint> candidates;
+    deadEnd.reserve(indexCount);
+
+    uint time = cacheSize + 1u;
+    uint cursor = 0u;
+    uint written = 0u;
+    int fanning = 0;
+
+    while (fanning >= 0) {
+        candidates.clear();
+
+        for (uint a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; ++a) {
+            uint triangle = adjacency.triangles[a];
+            if (emitted[triangle]) continue;
+
+            for (uint k = 0u; k < 3u; ++k) {
+                uint v = indices[triangle * 3u + k];
+                dst[written++] = v;
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                --live[v];
+                if (time - cacheTime[v] > cacheSize) cacheTime[v] = time++;
+            }
+            emitted[triangle] = true;
+        }
+
+        // prefer the candidate that stays in cache longest while its remaining fan still fits
+        fanning = -1;
+        int best = -1;
+        for (uint v : candidates) {
+            if (!live[v]) continue;
+            int priority = 0;
+            if (time - cacheTime[v] + 2u * live[v] <= cacheSize) priority = static_cast<int>(time - cacheTime[v]);
+            if (priority > best) {
+                best = priority;
+                fanning = static_cast<int>(v);
+            }
+        }
+        if (fanning >= 0) continue;
+
+        // dead end: back off to recently emitted vertices, then to any vertex with work left
+        while (!deadEnd.empty() && fanning < 0) {
+            uint v = deadEnd.back();
+            deadEnd.pop_back();
+            if (live[v]) fanning = static_cast<int>(v);
+        }
+        while (fanning < 0 && cursor < vertexCount) {
+            if (live[cursor]) fanning = static_cast<int>(cursor);
+            ++cursor;
+        }
+    }
+}
+
+void optimizeOverdraw(uint *dst, const uint *indices, uint indexCount, const float *positions, uint vertexCount, float threshold, uint cacheSize) {
+    uint triangleCount = indexCount / 3u;
+    if (!triangleCount) return;
+
+    // hard boundaries: the cache order restarts wherever a triangle misses on all three vertices
+    vector<uint> misses(triangleCount);
+    vector<uint> hardClusters;
+    uint baseline = 0u;
+    {
+        vector<uint> cacheTime(vertexCount, 0u);
+        uint time = cacheSize + 1u;
+        for (uint t = 0u; t < triangleCount; ++t) {
+            uint count = 0u;
+            for (uint k = 0u; k < 3u; ++k) {
+                uint v = indices[t * 3u + k];
+                if (time - cacheTime[v] > cacheSize) {
+                    cacheTime[v] = time++;
+                    ++count;
+                }
+            }
+            misses[t] = count;
+            baseline += count;
+            if (count == 3u) hardClusters.push_back(t);
+        }
+    }
+    if (hardClusters.empty() || hardClusters[0]) hardClusters.insert(hardClusters.begin(), 0u);
+    hardClusters.push_back(triangleCount);
+
+    // the per cluster bound says nothing about the seams between reordered clusters, so tighten it
+    // until the whole mesh stays within threshold, then try the hard clusters alone, a cut threshold
+    // of 0, and keep the cache order if even those cost too much
+    float clusterThreshold = threshold;
+    vector<uint> clusters;
+    for (uint attempt = 0u; attempt <= OVERDRAW_CLUSTER_ATTEMPTS; ++attempt) {
+        findClusters(clusters, indices, vertexCount, misses, hardClusters, attempt < OVERDRAW_CLUSTER_ATTEMPTS ? clusterThreshold : 0.0f, cacheSize);
+        sortClusters(dst, indices, positions, clusters);
+        if (analyzeVertexCache(dst, indexCount, vertexCount, cacheSize).transforms <= baseline * threshold) return;
+        clusterThreshold = 1.0f + (clusterThreshold - 1.0f) * 0.5f;
+    }
+    std::copy(indices, indices + indexCount, dst);
+}
+
+uint optimizeVertexFetch(void *dst, uint *indices, uint indexCount, const void *vertices, uint vertexCount, uint vertexSize) {
+    vector<uint> remap(vertexCount, ~0u);
+    uint next = 0u;
+
+    uint8_t *out = static_cast<uint8_t *>(dst);
+    const uint8_t *in = static_cast<const uint8_t *>(vertices);
+    for (uint i = 0u; i < indexCount; ++i) {
+        uint &target = remap[indices[i]];
+        if (target == ~0u) {
+            target = next++;
+            memcpy(out + target * vertexSize, in + indices[i] * vertexSize, vertexSize);
+        }
+        indices[i] = target;
+    }
+    return next;
+}
+
+uint selectMeshLod(const vector<MeshLod> &lods, float distance, float fovY, float viewportHeight, float pixelThreshold) {
+    // a world space error e at distance d covers e / (2 d tan(fov / 2)) of the viewport height
+    float pixelsPerUnit = viewportHeight / (2.0f * std::max(distance, 1e-4f) * std::tan(fovY * 0.5f));
+    uint selected = 0u;
+    for (uint i = 1u; i < lods.size(); ++i) {
+        if (lods[i].error * pixelsPerUnit > pixelThreshold) break;
+        selected = i;
+    }
+    return selected;
+}
+
+bool MeshData::initWithMesh(const Mesh &mesh) {
+    const MeshStream *stream = mesh.getStream(MeshSemantic::POSITION);
+    if (!stream || stream->components != 3u) return false;
+
+    vertexCount = mesh.getVertexCount();
+    const float *src = static_cast<const float *>(mesh.getStreamData(*stream));
+    positions.assign(src, src + vertexCount * 3u);
+
+    indices.resize(mesh.getIndexCount());
+    if (mesh.getIndexStride() == sizeof(uint16_t)) {
+        const uint16_t *data = static_cast<const uint16_t *>(mesh.getIndexData());
+        std::copy(data, data + indices.size(), indices.begin());
+    } else {
+        const uint *data = static_cast<const uint *>(mesh.getIndexData());
+        std::copy(data, data + indices.size(), indices.begin());
+    }
+    return true;
+}
+
+void MeshData::buildLods(const char *name, uint maxLods, uint minTriangles) {
+    uint baseCount = static_cast<uint>(lods.empty() ? indices.size() : lods[0].indexCount);
+    indices.resize(baseCount);
+    lods.assign(1u, {0u, baseCount, 0.0f});
+
+    vector<uint> simplified(baseCount);
+    while (lods.size() < maxLods) {
+        const MeshLod &source = lods.back();
+        uint target = source.indexCount / 6u * 3u;
+        if (target / 3u < minTriangles) break;
+
+        // always simplify the full detail mesh so errors do not compound across levels
+        float error = 0.0f;
+        uint count = simplifyMesh(simplified.data(), indices.data(), baseCount, positions.data(), vertexCount, target, FLT_MAX, &error);
+        // stop once the remaining vertices are locked and the mesh no longer shrinks
+        if (count * 4u > source.indexCount * 3u) break;
+
+        lods.push_back({static_cast<uint>(indices.size()), count, std::max(error, source.error)});
+        indices.insert(indices.end(), simplified.begin(), simplified.begin() + count);
+    }
+
+    for (uint i = 0u; i < lods.size(); ++i) {
+        CC_LOG_INFO("%s LOD %u: %u triangles, error %.4f", name, i, lods[i].indexCount / 3u, lods[i].error);
+    }
+}
+
+void MeshData::optimize(const char *name, float overdrawThreshold) {
+    uint indexCount = static_cast<uint>(indices.size());
+    if (lods.empty()) lods.push_back({0u, indexCount, 0.0f});
+    VertexCacheStats before = analyzeVertexCache(indices.data(), indexCount, vertexCount);
+
+    // every LOD is a separate draw, reorder each range on its own
+    vector<uint> ordered(indexCount);
+    for (const MeshLod &lod : lods) {
+        optimizeVertexCache(ordered.data() + lod.firstIndex, indices.data() + lod.firstIndex, lod.indexCount, vertexCount);
+    }
+
+    if (overdrawThreshold > 0.0f) {
+        const MeshLod &base = lods[0];
+        VertexCacheStats cacheOrder = analyzeVertexCache(ordered.data(), base.indexCount, vertexCount);
+        OverdrawStats overdrawBefore = analyzeOverdraw(ordered.data(), base.indexCount, positions.data(), vertexCount);
+
+        vector<uint> clustered(indexCount);
+        for (const MeshLod &lod : lods) {
+            optimizeOverdraw(clustered.data() + lod.firstIndex, ordered.data() + lod.firstIndex, lod.indexCount,
+                             positions.data(), vertexCount, overdrawThreshold);
+        }
+        ordered.swap(clustered);
+
+        VertexCacheStats overdrawOrder = analyzeVertexCache(ordered.data(), base.indexCount, vertexCount);
+        OverdrawStats overdrawAfter = analyzeOverdraw(ordered.data(), base.indexCount, positions.data(), vertexCount);
+        CC_LOG_INFO("%s overdraw over %u views: %.3f -> %.3f, %u -> %u fragments shaded, ACMR %.3f -> %.3f (threshold %.2f)",
+                    name, OVERDRAW_VIEW_COUNT, overdrawBefore.overdraw, overdrawAfter.overdraw, overdrawBefore.shaded, overdrawAfter.shaded,
+                    cacheOrder.acmr, overdrawOrder.acmr, overdrawThreshold);
+    }
+
+    // LOD 0 comes first and references every vertex, so it decides the fetch order
+    vector<float> fetchOrdered(positions.size());
+    vertexCount = optimizeVertexFetch(fetchOrdered.data(), ordered.data(), indexCount, positions.data(), vertexCount, 3u * sizeof(float));
+    fetchOrdered.resize(vertexCount * 3u);
+
+    positions.swap(fetchOrdered);
+    indices.swap(ordered);
+
+    VertexCacheStats after = analyzeVertexCache(indices.data(), indexCount, vertexCount);
+    CC_LOG_INFO("%s vertex cache (%u entries): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %u -> %u vertex shader invocations",
+                name, VERTEX_CACHE_SIZE, before.acmr, after.acmr, before.atvr, after.atvr, before.transforms, after.transforms);
+}
+
+vector<uint8_t> MeshData::packIndices() const {
+    vector<uint8_t> packed(indices.size() * getIndexStride());
+    if (getIndexStride() == sizeof(uint)) {
+        memcpy(packed.data(), indices.data(), packed.size());
+    } else {
+        uint16_t *out = reinterpret_cast<uint16_t *>(packed.data());
+        for (size_t i = 0u; i < indices.size(); ++i) out[i] = static_cast<uint16_t>(indices[i]);
+    }
+    return packed;
+}
+
+bool createMeshBuffers(gfx::Device *device, const String &file, const char *name, gfx::Buffer *&vertexBuffer,
+                       gfx::Buffer *&indexBuffer, vector<MeshLod> &meshLods, bool optimize, bool lods) {
+    Mesh mesh;
+    if (!mesh.initWithFile(file)) return false;
+
+    if (optimize) {
+        MeshData data;
+        if (!data.initWithMesh(mesh)) return false;
+        if (lods) data.buildLods(name);
+        data.optimize(name);
+        vector<uint8_t> indices = data.packIndices();
+        meshLods = data.lods;
+
+        vertexBuffer = device->createBuffer({
+            gfx::BufferUsage::VERTEX,
+            gfx::MemoryUsage::DEVICE,
+            static_cast<uint>(data.positions.size() * sizeof(float)),
+            3 * sizeof(float),
+        });
+        vertexBuffer->update(data.positions.data(), 0, static_cast<uint>(data.positions.size() * sizeof(float)));
+
+        indexBuffer = device->createBuffer({
+            gfx::BufferUsage::INDEX,
+            gfx::MemoryUsage::DEVICE,
+            static_cast<uint>(indices.size()),
+            data.getIndexStride(),
+        });
+        indexBuffer->update(indices.data(), 0, static_cast<uint>(indices.size()));
+        return true;
+    }
+
+    const MeshStream *positions = mesh.getStream(MeshSemantic::POSITION);
+    if (!positions || positions->components != 3u) return false;
+
+    // vertex buffer, uploaded straight from the mapped file
+    vertexBuffer = device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        mesh.getStreamSize(*positions),
+        3 * sizeof(float),
+    });
+    vertexBuffer->update(mesh.getStreamData(*positions), 0, mesh.getStreamSize(*positions));
+
+    indexBuffer = device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        mesh.getIndexSize(),
+        mesh.getIndexStride(),
+    });
+    indexBuffer->update(mesh.getIndexData(), 0, mesh.getIndexSize());
+    meshLods.assign(1u, {0u, mesh.getIndexCount(), 0.0f});
+    return true;
+}
+
+} // namespace cc
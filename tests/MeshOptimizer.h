@@ -0,0 +1,119 @@
+#pragma once
+
+#include "TestBase.h"
+
+// 0 has createMeshBuffers upload the shipped index order straight from the mapped file
+#define OPTIMIZE_VERTEX_CACHE  1
+// 0 always draws the full detail mesh; LODs need OPTIMIZE_VERTEX_CACHE
+#define USE_MESH_LOD           1
+// post-transform cache modelled as a FIFO, a typical size for current mobile and desktop parts
+#define VERTEX_CACHE_SIZE 16u
+// ACMR the overdraw pass may give up relative to the cache optimized order, 1.05 allows 5% more transforms
+// over the whole mesh
+#define OVERDRAW_ACMR_THRESHOLD 1.05f
+// cluster cuts the overdraw pass tries, halving the per cluster allowance each time, before the hard clusters alone
+#define OVERDRAW_CLUSTER_ATTEMPTS 3u
+// resolution and view count of the CPU overdraw measurement
+#define OVERDRAW_VIEWPORT_SIZE 256u
+#define OVERDRAW_VIEW_COUNT    16u
+// LOD chain length, each level has about half the triangles of the previous one
+#define MESH_LOD_COUNT         5u
+#define MESH_LOD_MIN_TRIANGLES 64u
+// screen space error in pixels a LOD may introduce before the next finer one is drawn
+#define MESH_LOD_PIXEL_ERROR   1.0f
+
+namespace cc {
+
+class Mesh;
+
+struct VertexCacheStats {
+    uint transforms = 0u; // vertex shader invocations
+    float acmr = 0.0f;    // transforms per triangle, 0.5 is the ideal for large regular meshes
+    float atvr = 0.0f;    // transforms per referenced vertex, 1.0 is the ideal
+};
+
+struct OverdrawStats {
+    uint covered = 0u;      // pixels with at least one fragment
+    uint shaded = 0u;       // fragments that passed the depth test
+    float overdraw = 0.0f;  // shaded / covered, 1.0 is the ideal
+};
+
+VertexCacheStats analyzeVertexCache(const uint *indices, uint indexCount, uint vertexCount, uint cacheSize = VERTEX_CACHE_SIZE);
+
+/**
+ * Rasterizes the mesh orthographically from directions spread evenly over the sphere, depth test LESS
+ * and counter-clockwise front faces like the default pipeline state, and sums fragments that pass the
+ * depth test. Only triangle order changes the result, which is what the overdraw pass targets.
+ */
+OverdrawStats analyzeOverdraw(const uint *indices, uint indexCount, const float *positions, uint vertexCount, uint viewCount = OVERDRAW_VIEW_COUNT);
+
+/**
+ * Tipsify (Sander, Nehab, Barczak 2007): fans around the most recently used vertex and picks
+ * the next fanning vertex among the ones still likely to be in the cache. Linear in the index count.
+ * dst must not alias indices.
+ */
+void optimizeVertexCache(uint *dst, const uint *indices, uint indexCount, uint vertexCount, uint cacheSize = VERTEX_CACHE_SIZE);
+
+/**
+ * Sander et al. overdraw pass on top of a cache optimized order: the order is cut into clusters
+ * wherever a cluster's own ACMR is within threshold of the cache optimized ACMR, and clusters
+ * are sorted by view-independent occlusion potential, outward facing clusters far from the
+ * mesh centroid first, so they tend to be drawn before what they hide. Reordering adds misses at
+ * the seams, so the cuts get coarser until the whole mesh is within threshold of the input ACMR,
+ * and dst keeps the input order if no clustering is. dst must not alias indices.
+ */
+void optimizeOverdraw(uint *dst, const uint *indices, uint indexCount, const float *positions, uint vertexCount,
+                      float threshold = OVERDRAW_ACMR_THRESHOLD, uint cacheSize = VERTEX_CACHE_SIZE);
+
+/**
+ * Reorders vertices into first-use order so vertex fetch walks memory linearly, and rewrites
+ * indices to match. Unreferenced vertices are dropped; returns the number of vertices written to dst.
+ */
+uint optimizeVertexFetch(void *dst, uint *indices, uint indexCount, const void *vertices, uint vertexCount, uint vertexSize);
+
+struct MeshLod {
+    uint firstIndex = 0u;
+    uint indexCount = 0u;
+    float error = 0.0f; // quadric estimate of the object space deviation from LOD 0
+};
+
+/**
+ * Coarsest LOD whose error projects to at most pixelThreshold pixels at the given view distance,
+ * fovY in radians. Distance is measured to the mesh origin in mesh units, so scale it for scaled instances.
+ */
+uint selectMeshLod(const vector<MeshLod> &lods, float distance, float fovY, float viewportHeight,
+                   float pixelThreshold = MESH_LOD_PIXEL_ERROR);
+
+/**
+ * Editable copy of a position-only mesh, indices widened to 32 bits for processing.
+ */
+struct MeshData {
+    uint vertexCount = 0u;
+    vector<float> positions;
+    vector<uint> indices;
+    // index ranges from finest to coarsest, all drawing from the same vertices; empty until buildLods or optimize
+    vector<MeshLod> lods;
+
+    bool initWithMesh(const Mesh &mesh);
+    // appends progressively simplified copies of LOD 0 to indices, halving the triangle count per level
+    void buildLods(const char *name, uint maxLods = MESH_LOD_COUNT, uint minTriangles = MESH_LOD_MIN_TRIANGLES);
+    // vertex cache, overdraw then vertex fetch optimization, logs ACMR/ATVR and overdraw before and after;
+    // a threshold of 0 skips the overdraw pass
+    void optimize(const char *name, float overdrawThreshold = OVERDRAW_ACMR_THRESHOLD);
+
+    inline uint getIndexStride() const { return vertexCount > 0x10000u ? sizeof(uint) : sizeof(uint16_t); }
+    // index data in getIndexStride() sized elements, ready for upload
+    vector<uint8_t> packIndices() const;
+};
+
+/**
+ * Position-only vertex and index buffers for a mesh file. With optimize the mesh goes through
+ * MeshData::optimize, after buildLods when lods is set too, and name labels the logs; without it the
+ * streams are uploaded straight from the mapped file and drawn as a single LOD. Returns false, and
+ * creates nothing, when the file doesn't load or has no 3 component position stream.
+ */
+bool createMeshBuffers(gfx::Device *device, const String &file, const char *name, gfx::Buffer *&vertexBuffer,
+                       gfx::Buffer *&indexBuffer, vector<MeshLod> &meshLods, bool optimize = OPTIMIZE_VERTEX_CACHE,
+                       bool lods = USE_MESH_LOD);
+
+} // namespace cc
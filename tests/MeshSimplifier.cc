@@ -0,0 +1,214 @@
+#include "MeshSimplifier.h"
+#include <cfloat>
+
+namespace cc {
+
+namespace {
+struct Quadric {
+    double a2 = 0.0, b2 = 0.0, c2 = 0.0, d2 = 0.0;
+    double ab = 0.0, ac = 0.0, ad = 0.0, bc = 0.0, bd = 0.0, cd = 0.0;
+    double weight = 0.0;
+
+    void addPlane(double a, double b, double c, double d, double w) {
+        a2 += w * a * a;
+        b2 += w * b * b;
+        c2 += w * c * c;
+        d2 += w * d * d;
+        ab += w * a * b;
+        ac += w * a * c;
+        ad += w * a * d;
+        bc += w * b * c;
+        bd += w * b * d;
+        cd += w * c * d;
+        weight += w;
+    }
+
+    void add(const Quadric &q) {
+        a2 += q.a2;
+        b2 += q.b2;
+        c2 += q.c2;
+        d2 += q.d2;
+        ab += q.ab;
+        ac += q.ac;
+        ad += q.ad;
+        bc += q.bc;
+        bd += q.bd;
+        cd += q.cd;
+        weight += q.weight;
+    }
+
+    // area weighted mean squared distance to the accumulated planes
+    double error(const float *p) const {
+        double x = p[0], y = p[1], z = p[2];
+        double e = a2 * x * x + b2 * y * y + c2 * z * z + d2 +
+                   2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z);
+        return weight > 0.0 ? std::abs(e) / weight : 0.0;
+    }
+};
+
+struct Collapse {
+    uint from;
+    uint to;
+    float cost; // squared distance
+};
+
+inline uint64_t edgeKey(uint a, uint b) {
+    return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+}
+
+Vec3 triangleNormal(const float *a, const float *b, const float *c) {
+    Vec3 ab(b[0] - a[0], b[1] - a[1], b[2] - a[2]);
+    Vec3 ac(c[0] - a[0], c[1] - a[1], c[2] - a[2]);
+    return Vec3(ab.y * ac.z - ab.z * ac.y, ab.z * ac.x - ab.x * ac.z, ab.x * ac.y - ab.y * ac.x);
+}
+
+// collapsing from onto to must not turn any surviving triangle around from
+bool flips(const vector<uint> &indices, const vector<uint> &offsets, const vector<uint> &triangles,
+           const float *positions, uint from, uint to) {
+    for (uint a = offsets[from]; a < offsets[from + 1u]; ++a) {
+        const uint *tri = &indices[triangles[a] * 3u];
+        if (tri[0] == to || tri[1] == to || tri[2] == to) continue; // collapses away
+
+        const float *p[3];
+        const float *q[3];
+        for (uint k = 0u; k < 3u; ++k) {
+            p[k] = positions + tri[k] * 3u;
+            q[k] = positions + (tri[k] == from ? to : tri[k]) * 3u;
+        }
+        Vec3 before = triangleNormal(p[0], p[1], p[2]);
+        Vec3 after = triangleNormal(q[0], q[1], q[2]);
+        if (before.dot(after) <= 0.0f) return true;
+    }
+    return false;
+}
+} // namespace
+
+uint simplifyMesh(uint *dst, const uint *indices, uint indexCount, const float *positions, uint vertexCount,
+                  uint targetIndexCount, float targetError, float *resultError) {
+    vector<uint> current(indices, indices + indexCount);
+    float maxCost = targetError * targetError;
+    float worst = 0.0f;
+
+    // area weighted plane quadrics
+    vector<Quadric> quadrics(vertexCount);
+    for (uint i = 0u; i + 2u < indexCount; i += 3u) {
+        const float *a = positions + indices[i] * 3u;
+        Vec3 n = triangleNormal(a, positions + indices[i + 1u] * 3u, positions + indices[i + 2u] * 3u);
+        float length = n.length();
+        if (length <= 0.0f) continue;
+        n *= 1.0f / length;
+        double d = -(n.x * a[0] + n.y * a[1] + n.z * a[2]);
+        for (uint k = 0u; k < 3u; ++k) quadrics[indices[i + k]].addPlane(n.x, n.y, n.z, d, length * 0.5);
+    }
+
+    // edges used by exactly two triangles are interior, anything else pins its vertices
+    vector<bool> locked(vertexCount, false);
+    {
+        vector<uint64_t> edges;
+        edges.reserve(indexCount);
+        for (uint i = 0u; i + 2u < indexCount; i += 3u) {
+            for (uint k = 0u; k < 3u; ++k) edges.push_back(edgeKey(indices[i + k], indices[i + (k + 1u) % 3u]));
+        }
+        std::sort(edges.begin(), edges.end());
+        for (size_t e = 0u; e < edges.size();) {
+            size_t end = e;
+            while (end < edges.size() && edges[end] == edges[e]) ++end;
+            if (end - e != 2u) {
+                locked[uint(edges[e] >> 32)] = true;
+                locked[uint(edges[e] & 0xFFFFFFFFu)] = true;
+            }
+            e = end;
+        }
+    }
+
+    vector<uint64_t> edges;
+    vector<Collapse> collapses;
+    vector<uint> offsets;
+    vector<uint> triangles;
+    vector<uint> remap(vertexCount);
+    vector<bool> touched(vertexCount);
+
+    while (current.size() > targetIndexCount) {
+        uint count = static_cast<uint>(current.size());
+
+        // unique edges of the current mesh and the cheaper valid direction of each
+        edges.clear();
+        for (uint i = 0u; i < count; i += 3u) {
+            for (uint k = 0u; k < 3u; ++k) edges.push_back(edgeKey(current[i + k], current[i + (k + 1u) % 3u]));
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        collapses.clear();
+        for (uint64_t key : edges) {
+            uint a = uint(key >> 32);
+            uint b = uint(key & 0xFFFFFFFFu);
+            Quadric q = quadrics[a];
+            q.add(quadrics[b]);
+
+            float costAB = locked[a] ? FLT_MAX : float(q.error(positions + b * 3u));
+            float costBA = locked[b] ? FLT_MAX : float(q.error(positions + a * 3u));
+            if (costAB == FLT_MAX && costBA == FLT_MAX) continue;
+
+            if (costAB <= costBA) {
+                collapses.push_back({a, b, costAB});
+            } else {
+                collapses.push_back({b, a, costBA});
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse &x, const Collapse &y) { return x.cost < y.cost; });
+
+        // vertex -> triangle adjacency for the flip test
+        offsets.assign(vertexCount + 1u, 0u);
+        for (uint i = 0u; i < count; ++i) ++offsets[current[i] + 1u];
+        for (uint v = 0u; v < vertexCount; ++v) offsets[v + 1u] += offsets[v];
+        triangles.resize(count);
+        {
+            vector<uint> cursor(offsets.begin(), offsets.end() - 1);
+            for (uint i = 0u; i < count; ++i) triangles[cursor[current[i]]++] = i / 3u;
+        }
+
+        for (uint v = 0u; v < vertexCount; ++v) remap[v] = v;
+        std::fill(touched.begin(), touched.end(), false);
+
+        uint removeGoal = (count - targetIndexCount) / 3u;
+        uint removed = 0u;
+        uint applied = 0u;
+        for (const Collapse &c : collapses) {
+            if (c.cost > maxCost || removed >= removeGoal) break;
+            if (touched[c.from] || touched[c.to]) continue;
+            if (flips(current, offsets, triangles, positions, c.from, c.to)) continue;
+
+            remap[c.from] = c.to;
+            quadrics[c.to].add(quadrics[c.from]);
+            worst = std::max(worst, c.cost);
+            ++applied;
+
+            // the one-ring of from changed shape, keep it out of the rest of this pass
+            for (uint a = offsets[c.from]; a < offsets[c.from + 1u]; ++a) {
+                const uint *tri = &current[triangles[a] * 3u];
+                if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) ++removed;
+                for (uint k = 0u; k < 3u; ++k) touched[tri[k]] = true;
+            }
+        }
+        if (!applied) break;
+
+        uint written = 0u;
+        for (uint i = 0u; i < count; i += 3u) {
+            uint a = remap[current[i]];
+            uint b = remap[current[i + 1u]];
+            uint c = remap[current[i + 2u]];
+            if (a == b || b == c || c == a) continue;
+            current[written++] = a;
+            current[written++] = b;
+            current[written++] = c;
+        }
+        current.resize(written);
+    }
+
+    std::copy(current.begin(), current.end(), dst);
+    if (resultError) *resultError = std::sqrt(worst);
+    return static_cast<uint>(current.size());
+}
+
+} // namespace cc
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+/**
+ * Quadric error metric simplification (Garland, Heckbert 1997) by half-edge collapse.
+ *
+ * Vertices only ever collapse onto an existing neighbor, so the result indexes a subset of
+ * the input vertices and every level of a LOD chain can share one vertex buffer. Boundary
+ * and non-manifold vertices are locked, and collapses that would flip a triangle are rejected.
+ *
+ * Collapses are applied in passes of independent edges, cheapest first, until the index count
+ * reaches targetIndexCount or the next collapse would exceed targetError (a distance, in mesh
+ * units). Returns the number of indices written to dst, which must hold indexCount entries;
+ * resultError receives the largest error introduced.
+ */
+uint simplifyMesh(uint *dst, const uint *indices, uint indexCount, const float *positions, uint vertexCount,
+                  uint targetIndexCount, float targetError, float *resultError = nullptr);
+
+} // namespace cc
@@ -0,0 +1,208 @@
+#include "MeshStreamer.h"
+
+namespace cc {
+
+MeshStreamer::MeshStreamer(uint chunkSize, uint chunkCount)
+: _chunkSize(chunkSize),
+  _chunkCount(chunkCount) {
+    // an index chunk stays in its slot while the vertices it needs go through the others
+    CCASSERT(chunkCount >= 2u && chunkSize >= 12u, "MeshStreamer needs at least two chunks of one triangle");
+    _staging.resize(static_cast<size_t>(chunkSize) * chunkCount);
+}
+
+MeshStreamer::~MeshStreamer() {
+    close();
+}
+
+bool MeshStreamer::open(gfx::Device *device, const String &file) {
+    close();
+
+    String path = FileUtils::getInstance()->fullPathForFilename(file);
+    _fp = fopen(path.c_str(), "rb");
+    if (!_fp) {
+        CC_LOG_ERROR("MeshStreamer: failed to open %s", file.c_str());
+        return false;
+    }
+
+    // the same checks as Mesh::initWithFile, on the header alone
+    fseek(_fp, 0, SEEK_END);
+    uint64_t size = static_cast<uint64_t>(ftell(_fp));
+    fseek(_fp, 0, SEEK_SET);
+    MeshHeader header;
+    if (size < sizeof(MeshHeader) || fread(&header, sizeof(header), 1, _fp) != 1 || header.magic != MESH_MAGIC) {
+        CC_LOG_ERROR("MeshStreamer: %s is not a mesh file", file.c_str());
+        close();
+        return false;
+    }
+    if (header.version != MESH_VERSION) {
+        CC_LOG_ERROR("MeshStreamer: %s has version %u, expected %u", file.c_str(), header.version, MESH_VERSION);
+        close();
+        return false;
+    }
+
+    const MeshStream *position = nullptr;
+    vector<MeshStream> streams(header.streamCount);
+    bool valid = sizeof(MeshHeader) + header.streamCount * sizeof(MeshStream) <= size &&
+                 (!header.streamCount || fread(streams.data(), sizeof(MeshStream), header.streamCount, _fp) == header.streamCount);
+    for (uint i = 0u; valid && i < header.streamCount; ++i) {
+        uint64_t end = uint64_t(streams[i].offset) + uint64_t(header.vertexCount) * streams[i].components * sizeof(float);
+        valid = streams[i].offset % 4u == 0u && end <= size;
+        if (streams[i].semantic == MeshSemantic::POSITION) position = &streams[i];
+    }
+    valid = valid && (header.indexStride == 2u || header.indexStride == 4u) && header.indexOffset % 4u == 0u &&
+            uint64_t(header.indexOffset) + uint64_t(header.indexCount) * header.indexStride <= size;
+    if (!valid || !position || position->components != 3u || !header.indexCount) {
+        CC_LOG_ERROR("MeshStreamer: %s is truncated, corrupt or has no indexed positions", file.c_str());
+        close();
+        return false;
+    }
+
+    _header = header;
+    _vertexOffset = position->offset;
+    _vertexSize = header.vertexCount * 3u * sizeof(float);
+    _indexSize = header.indexCount * header.indexStride;
+    _totalBytes = _vertexSize + _indexSize;
+
+    _vertexBuffer = device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        _vertexSize,
+        3 * sizeof(float),
+    });
+    _indexBuffer = device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        _indexSize,
+        header.indexStride,
+    });
+
+    _freeSlots.resize(_chunkCount);
+    for (uint i = 0u; i < _chunkCount; ++i) _freeSlots[i] = _chunkCount - 1u - i;
+    _ready.clear();
+    _cancel = false;
+    _failed = false;
+    _thread = std::thread(&MeshStreamer::load, this);
+    return true;
+}
+
+void MeshStreamer::close() {
+    if (_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cancel = true;
+        }
+        _slotFreed.notify_all();
+        _thread.join();
+    }
+    if (_fp) {
+        fclose(_fp);
+        _fp = nullptr;
+    }
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+
+    _header = MeshHeader();
+    _totalBytes = 0u;
+    _uploadedBytes = 0u;
+    _drawableIndexCount = 0u;
+}
+
+bool MeshStreamer::acquireSlot(uint &slot) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _slotFreed.wait(lock, [this]() { return !_freeSlots.empty() || _cancel; });
+    if (_cancel) return false;
+    slot = _freeSlots.back();
+    _freeSlots.pop_back();
+    return true;
+}
+
+bool MeshStreamer::readChunk(Chunk &chunk, uint fileOffset) {
+    if (!acquireSlot(chunk.slot)) return false;
+    if (fseek(_fp, static_cast<long>(fileOffset), SEEK_SET) || fread(&_staging[chunk.slot * _chunkSize], chunk.size, 1, _fp) != 1) {
+        _failed = true;
+        return false;
+    }
+    return true;
+}
+
+void MeshStreamer::load() {
+    // whole vertices and whole triangles of either index size
+    uint payload = _chunkSize - _chunkSize % 12u;
+    uint vertexStride = 3u * sizeof(float);
+    uint vertexRead = 0u;
+
+    auto readVertices = [&](uint end) {
+        while (vertexRead < end) {
+            Chunk vertices;
+            vertices.offset = vertexRead;
+            vertices.size = std::min(payload, end - vertexRead);
+            if (!readChunk(vertices, _vertexOffset + vertexRead)) return false;
+            vertexRead += vertices.size;
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _ready.push_back(vertices);
+        }
+        return true;
+    };
+
+    for (uint indexRead = 0u; indexRead < _indexSize;) {
+        Chunk indices;
+        indices.isIndex = true;
+        indices.offset = indexRead;
+        indices.size = std::min(payload, _indexSize - indexRead);
+        if (!readChunk(indices, _header.indexOffset + indexRead)) return;
+        indexRead += indices.size;
+
+        // the vertices these triangles use are queued ahead of them
+        uint maxVertex = 0u;
+        const uint8_t *data = &_staging[indices.slot * _chunkSize];
+        uint count = indices.size / _header.indexStride;
+        if (_header.indexStride == 2u) {
+            const uint16_t *index = reinterpret_cast<const uint16_t *>(data);
+            for (uint i = 0u; i < count; ++i) maxVertex = std::max(maxVertex, static_cast<uint>(index[i]));
+        } else {
+            const uint32_t *index = reinterpret_cast<const uint32_t *>(data);
+            for (uint i = 0u; i < count; ++i) maxVertex = std::max(maxVertex, index[i]);
+        }
+        if (maxVertex >= _header.vertexCount) {
+            CC_LOG_ERROR("MeshStreamer: index %u out of range of %u vertices", maxVertex, _header.vertexCount);
+            _failed = true;
+            return;
+        }
+        if (!readVertices((maxVertex + 1u) * vertexStride)) return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _ready.push_back(indices);
+    }
+    // vertices no triangle uses, so the buffer still matches the file
+    readVertices(_vertexSize);
+}
+
+uint MeshStreamer::upload(uint budget) {
+    uint sent = 0u;
+    while (sent < budget) {
+        Chunk chunk;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_ready.empty()) break;
+            chunk = _ready.front();
+            _ready.erase(_ready.begin());
+        }
+
+        // update copies the data on its way to the GPU, the slot can be refilled right after
+        gfx::Buffer *buffer = chunk.isIndex ? _indexBuffer : _vertexBuffer;
+        buffer->update(&_staging[chunk.slot * _chunkSize], chunk.offset, chunk.size);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _freeSlots.push_back(chunk.slot);
+        }
+        _slotFreed.notify_one();
+
+        sent += chunk.size;
+        _uploadedBytes += chunk.size;
+        if (chunk.isIndex) _drawableIndexCount = (chunk.offset + chunk.size) / _header.indexStride;
+    }
+    return sent;
+}
+
+} // namespace cc
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "TestBase.h"
+#include "Mesh.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// staging pool shared by every chunk in flight, the only host memory a streamed mesh ever holds
+#define MESH_STREAM_CHUNK_SIZE    (1u << 20)
+#define MESH_STREAM_CHUNK_COUNT   4u
+// bytes handed to Buffer::update per frame
+#define MESH_STREAM_UPLOAD_BUDGET (4u << 20)
+
+namespace cc {
+
+/**
+ * Streams a position-only mesh file into GPU buffers without ever holding it whole in memory.
+ *
+ * A loader thread reads the file front to back in chunks into a fixed pool of staging slots and
+ * blocks while they are all full; upload() drains finished chunks into the buffers on the render
+ * thread under a per-frame byte budget and hands the slots back. Index chunks are queued only after
+ * the vertex chunks they reference, so getDrawableIndexCount() is always a prefix that can be drawn
+ * while the rest is still loading. Meshes in vertex fetch order (see optimizeVertexFetch) start
+ * drawing after the first couple of chunks, any other order still loads but draws late.
+ *
+ * Files are read with stdio instead of mapped so paged in data never piles up in the process.
+ * Assets packed inside an Android APK cannot be opened this way, use Mesh for those.
+ */
+class MeshStreamer {
+public:
+    explicit MeshStreamer(uint chunkSize = MESH_STREAM_CHUNK_SIZE, uint chunkCount = MESH_STREAM_CHUNK_COUNT);
+    ~MeshStreamer();
+
+    // reads the header, creates the buffers at full size and starts the loader thread; file is resolved through FileUtils
+    bool open(gfx::Device *device, const String &file);
+    // stops the loader and destroys the buffers
+    void close();
+
+    // uploads finished chunks in file order until budget bytes are sent, returns the bytes sent
+    uint upload(uint budget = MESH_STREAM_UPLOAD_BUDGET);
+    // every byte is on the GPU
+    inline bool isDone() const { return _totalBytes && _uploadedBytes == _totalBytes; }
+    inline bool hasFailed() const { return _failed; }
+
+    inline gfx::Buffer *getVertexBuffer() const { return _vertexBuffer; }
+    inline gfx::Buffer *getIndexBuffer() const { return _indexBuffer; }
+    inline uint getVertexCount() const { return _header.vertexCount; }
+    inline uint getIndexCount() const { return _header.indexCount; }
+    inline uint getIndexStride() const { return _header.indexStride; }
+    // leading indices whose triangles and vertices are all uploaded
+    inline uint getDrawableIndexCount() const { return _drawableIndexCount; }
+    inline uint getUploadedBytes() const { return _uploadedBytes; }
+    inline uint getTotalBytes() const { return _totalBytes; }
+    inline uint getStagingSize() const { return _chunkSize * _chunkCount; }
+
+private:
+    struct Chunk {
+        uint slot = 0u;
+        bool isIndex = false;
+        uint offset = 0u; // destination in the vertex or index buffer
+        uint size = 0u;
+    };
+
+    void load();
+    bool acquireSlot(uint &slot);
+    bool readChunk(Chunk &chunk, uint fileOffset);
+
+    uint _chunkSize = 0u;
+    uint _chunkCount = 0u;
+    vector<uint8_t> _staging;
+
+    FILE *_fp = nullptr;
+    MeshHeader _header;
+    uint _vertexOffset = 0u; // position stream in the file
+    uint _vertexSize = 0u;
+    uint _indexSize = 0u;
+    uint _totalBytes = 0u;
+
+    gfx::Buffer *_vertexBuffer = nullptr;
+    gfx::Buffer *_indexBuffer = nullptr;
+    uint _uploadedBytes = 0u;
+    uint _drawableIndexCount = 0u;
+
+    // loader thread state, everything below the mutex is guarded by it
+    std::thread _thread;
+    std::atomic<bool> _cancel{false};
+    std::atomic<bool> _failed{false};
+    std::mutex _mutex;
+    std::condition_variable _slotFreed;
+    vector<uint> _freeSlots;
+    vector<Chunk> _ready;
+};
+
+} // namespace cc
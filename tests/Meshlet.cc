@@ -0,0 +1,187 @@
+#include "Meshlet.h"
+#include <cfloat>
+
+namespace cc {
+
+namespace {
+Vec3 vertex(const float *positions, uint index) {
+    return Vec3(positions[index * 3u], positions[index * 3u + 1u], positions[index * 3u + 2u]);
+}
+} // namespace
+
+Meshlet computeMeshletBounds(const uint *indices, uint firstIndex, uint indexCount, const float *positions) {
+    Meshlet meshlet;
+    meshlet.firstIndex = firstIndex;
+    meshlet.indexCount = indexCount;
+    if (!indexCount) return meshlet;
+
+    const uint *range = indices + firstIndex;
+    Vec3 min(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vec3 max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (uint i = 0u; i < indexCount; ++i) {
+        Vec3 p = vertex(positions, range[i]);
+        min.set(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+        max.set(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+    }
+    meshlet.center = (min + max) * 0.5f;
+    for (uint i = 0u; i < indexCount; ++i) {
+        meshlet.radius = std::max(meshlet.radius, vertex(positions, range[i]).distance(meshlet.center));
+    }
+
+    // the cone axis is the mean unit normal, its half angle reaches the normal furthest from it
+    vector<Vec3> normals;
+    normals.reserve(indexCount / 3u);
+    Vec3 axis;
+    for (uint i = 0u; i + 2u < indexCount; i += 3u) {
+        Vec3 a = vertex(positions, range[i]);
+        Vec3 n;
+        Vec3::cross(vertex(positions, range[i + 1u]) - a, vertex(positions, range[i + 2u]) - a, &n);
+        if (n.lengthSquared() <= 0.0f) continue;
+        n.normalize();
+        normals.push_back(n);
+        axis += n;
+    }
+    if (normals.empty() || axis.lengthSquared() <= 0.0f) return meshlet;
+    axis.normalize();
+
+    float minDot = 1.0f;
+    for (const Vec3 &n : normals) minDot = std::min(minDot, n.dot(axis));
+
+    meshlet.coneAxis = axis;
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+    return meshlet;
+}
+
+void buildMeshlets(vector<Meshlet> &meshlets, uint *indices, uint firstIndex, uint indexCount, const float *positions,
+                   uint vertexCount, uint maxVertices, uint maxTriangles, float coneWeight) {
+    vector<uint> source(indices + firstIndex, indices + firstIndex + indexCount);
+    uint triangleCount = indexCount / 3u;
+
+    // compressed vertex -> triangle adjacency and unit face normals
+    vector<uint> offsets(vertexCount + 1u, 0u);
+    for (uint i = 0u; i < indexCount; ++i) ++offsets[source[i] + 1u];
+    for (uint v = 0u; v < vertexCount; ++v) offsets[v + 1u] += offsets[v];
+    vector<uint> adjacency(indexCount);
+    {
+        vector<uint> cursor(offsets.begin(), offsets.end() - 1);
+        for (uint i = 0u; i < indexCount; ++i) adjacency[cursor[source[i]]++] = i / 3u;
+    }
+    vector<Vec3> normals(triangleCount);
+    for (uint t = 0u; t < triangleCount; ++t) {
+        Vec3 a = vertex(positions, source[t * 3u]);
+        Vec3::cross(vertex(positions, source[t * 3u + 1u]) - a, vertex(positions, source[t * 3u + 2u]) - a, &normals[t]);
+        normals[t].normalize();
+    }
+
+    // marks vertices already in the open meshlet by its ordinal, so nothing needs clearing between meshlets
+    vector<uint> owner(vertexCount, ~0u);
+    vector<bool> emitted(triangleCount, false);
+    vector<uint> vertices;
+    uint ordinal = 0u;
+    uint seed = 0u;
+    uint written = firstIndex;
+
+    while (true) {
+        while (seed < triangleCount && emitted[seed]) ++seed;
+        if (seed == triangleCount) break;
+
+        // grow from the first unused triangle in the incoming order, which keeps the cache order's locality
+        uint start = written;
+        uint triangles = 0u;
+        Vec3 normalSum;
+        vertices.clear();
+        ++ordinal;
+
+        uint next = seed;
+        while (next != ~0u) {
+            emitted[next] = true;
+            normalSum += normals[next];
+            for (uint k = 0u; k < 3u; ++k) {
+                uint v = source[next * 3u + k];
+                indices[written++] = v;
+                if (owner[v] != ordinal) {
+                    owner[v] = ordinal;
+                    vertices.push_back(v);
+                }
+            }
+            if (++triangles == maxTriangles) break;
+
+            // cheapest neighbor: fewest new vertices, then closest to the current mean normal
+            Vec3 axis = normalSum.getNormalized();
+            float bestScore = FLT_MAX;
+            next = ~0u;
+            for (uint v : vertices) {
+                for (uint a = offsets[v]; a < offsets[v + 1u]; ++a) {
+                    uint t = adjacency[a];
+                    if (emitted[t]) continue;
+
+                    uint added = 0u;
+                    for (uint k = 0u; k < 3u; ++k) {
+                        if (owner[source[t * 3u + k]] != ordinal) ++added;
+                    }
+                    if (vertices.size() + added > maxVertices) continue;
+
+                    float score = float(added) + coneWeight * (1.0f - normals[t].dot(axis));
+                    if (score < bestScore) {
+                        bestScore = score;
+                        next = t;
+                    }
+                }
+            }
+        }
+        meshlets.push_back(computeMeshletBounds(indices, start, written - start, positions));
+    }
+}
+
+void MeshletCuller::setCamera(const Vec3 &eye, const Mat4 &viewProjection) {
+    _eye = eye;
+    _frustum.update(viewProjection);
+}
+
+bool MeshletCuller::isVisible(const Meshlet &meshlet, const Mat4 &model, float scale) {
+    ++_stats.tested;
+    _stats.triangles += meshlet.indexCount / 3u;
+
+    Vec3 center;
+    model.transformPoint(meshlet.center, &center);
+    float radius = meshlet.radius * scale;
+    if (!_frustum.intersectsSphere(center, radius)) {
+        ++_stats.frustumCulled;
+        return false;
+    }
+
+    // every normal is back facing from anywhere in the sphere once the view direction lies within
+    // 90 degrees minus the cone half angle of the axis, padded by the radius for the sphere's extent
+    if (meshlet.coneCutoff < 1.0f) {
+        Vec3 axis;
+        model.transformVector(meshlet.coneAxis, &axis);
+        axis *= 1.0f / scale;
+        Vec3 view = center - _eye;
+        if (view.dot(axis) >= meshlet.coneCutoff * view.length() + radius * (1.0f + meshlet.coneCutoff)) {
+            ++_stats.backfaceCulled;
+            return false;
+        }
+    }
+
+    _stats.submittedTriangles += meshlet.indexCount / 3u;
+    return true;
+}
+
+void MeshletCuller::cull(const vector<Meshlet> &meshlets, const Mat4 &model, vector<MeshletDraw> &draws, float scale) {
+    auto start = std::chrono::steady_clock::now();
+
+    size_t firstDraw = draws.size();
+    for (const Meshlet &meshlet : meshlets) {
+        if (!isVisible(meshlet, model, scale)) continue;
+
+        if (draws.size() > firstDraw && draws.back().firstIndex + draws.back().indexCount == meshlet.firstIndex) {
+            draws.back().indexCount += meshlet.indexCount;
+        } else {
+            draws.push_back({meshlet.firstIndex, meshlet.indexCount});
+        }
+    }
+    _stats.draws += static_cast<uint>(draws.size() - firstDraw);
+    _stats.cullTime += TestBaseI::secondsSince(start);
+}
+
+} // namespace cc
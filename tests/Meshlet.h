@@ -0,0 +1,76 @@
+#pragma once
+
+#include "TestBase.h"
+
+// cluster size limits, in line with what mesh shading hardware favors
+#define MESHLET_MAX_VERTICES  64u
+#define MESHLET_MAX_TRIANGLES 124u
+// how many extra vertices a meshlet may spend to keep its normals together, per unit of 1 - cos(normal deviation)
+#define MESHLET_CONE_WEIGHT   1.0f
+
+namespace cc {
+
+/**
+ * A contiguous index range of a mesh with bounds for culling.
+ * Every triangle normal lies within the cone around coneAxis whose half angle has sine coneCutoff;
+ * a cutoff of 1 means the normals spread too wide for the cone to ever cull.
+ */
+struct Meshlet {
+    uint firstIndex = 0u;
+    uint indexCount = 0u;
+    Vec3 center;
+    float radius = 0.0f;
+    Vec3 coneAxis;
+    float coneCutoff = 1.0f;
+};
+
+struct MeshletDraw {
+    uint firstIndex = 0u;
+    uint indexCount = 0u;
+};
+
+struct MeshletCullStats {
+    uint tested = 0u;
+    uint frustumCulled = 0u;
+    uint backfaceCulled = 0u;
+    uint triangles = 0u;          // triangles of every tested meshlet
+    uint submittedTriangles = 0u; // triangles that survived
+    uint draws = 0u;              // ranges emitted after merging neighbors
+    float cullTime = 0.0f;
+
+    void reset() { *this = MeshletCullStats(); }
+};
+
+// bounding sphere and normal cone of any index range
+Meshlet computeMeshletBounds(const uint *indices, uint firstIndex, uint indexCount, const float *positions);
+
+/**
+ * Regroups indices[firstIndex, firstIndex + indexCount) in place into meshlets and appends them.
+ * Each meshlet grows greedily from the first unused triangle through its neighbors, preferring
+ * triangles that add few vertices and face the way the meshlet already does, which keeps the
+ * normal cones narrow enough to cull. Run it on a vertex cache optimized order so seeds follow it.
+ */
+void buildMeshlets(vector<Meshlet> &meshlets, uint *indices, uint firstIndex, uint indexCount, const float *positions, uint vertexCount,
+                   uint maxVertices = MESHLET_MAX_VERTICES, uint maxTriangles = MESHLET_MAX_TRIANGLES, float coneWeight = MESHLET_CONE_WEIGHT);
+
+/**
+ * Per-frame CPU culling of meshlets against the view frustum and their normal cones.
+ * Instances are placed by a rigid model matrix with a uniform scale; front faces are counter-clockwise.
+ */
+class MeshletCuller {
+public:
+    void setCamera(const Vec3 &eye, const Mat4 &viewProjection);
+
+    bool isVisible(const Meshlet &meshlet, const Mat4 &model, float scale = 1.0f);
+    // appends the visible ranges of one instance to draws, merging ranges that are adjacent in the index buffer
+    void cull(const vector<Meshlet> &meshlets, const Mat4 &model, vector<MeshletDraw> &draws, float scale = 1.0f);
+
+    inline MeshletCullStats &getStats() { return _stats; }
+
+private:
+    Vec3 _eye;
+    Frustum _frustum;
+    MeshletCullStats _stats;
+};
+
+} // namespace cc
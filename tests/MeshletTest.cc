@@ -0,0 +1,336 @@
+#include "MeshletTest.h"
+#include "RenderPassAnalyzer.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+
+// 0 draws every bunny whole, the baseline the culled numbers compare against
+#define USE_MESHLET_CULLING 1
+// BUNNY_GRID x BUNNY_GRID bunnies, BUNNY_SPACING apart on the ground plane
+#define BUNNY_GRID    16u
+#define BUNNY_SPACING 14.0f
+
+namespace cc {
+
+namespace {
+enum class Binding : uint8_t { VIEW_PROJ, WORLD };
+}
+
+void MeshletTest::destroy() {
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    CC_SAFE_DESTROY(_viewProjBuffer);
+    CC_SAFE_DESTROY(_worldBufferView);
+    CC_SAFE_DESTROY(_worldBuffer);
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_pipelineState);
+}
+
+bool MeshletTest::initialize() {
+    createShader();
+    createBuffers();
+    createInputAssembler();
+    createPipelineState();
+    return true;
+}
+
+void MeshletTest::createShader() {
+
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+
+            layout(set = 0, binding = 0) uniform ViewProj { mat4 u_viewProj; };
+            layout(set = 0, binding = 1) uniform World { mat4 u_model; };
+
+            layout(location = 0) out vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_position;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+
+            layout(std140) uniform ViewProj { mat4 u_viewProj; };
+            layout(std140) uniform World { mat4 u_model; };
+
+            out vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_position;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            uniform mat4 u_viewProj, u_model;
+            varying vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_position;
+
+            void main () {
+                gl_FragColor = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
+    gfx::UniformBlockList uniformBlockList = {
+        {0, static_cast<uint>(Binding::VIEW_PROJ), "ViewProj", {{"u_viewProj", gfx::Type::MAT4, 1}}, 1},
+        {0, static_cast<uint>(Binding::WORLD), "World", {{"u_model", gfx::Type::MAT4, 1}}, 1},
+    };
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = "Meshlet Test";
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    _shader = _device->createShader(shaderInfo);
+}
+
+void MeshletTest::createBuffers() {
+    Mesh mesh;
+    bool valid = mesh.initWithFile("bunny.mesh");
+    CCASSERT(valid, "MeshletTest load mesh failed");
+
+    MeshData bunny;
+    bunny.initWithMesh(mesh);
+    bunny.optimize("MeshletTest");
+    _indexCount = static_cast<uint>(bunny.indices.size());
+
+    buildMeshlets(_meshlets, bunny.indices.data(), 0u, _indexCount, bunny.positions.data(), bunny.vertexCount);
+
+    // grouping for narrow cones undoes part of the cache order, restore it inside each meshlet
+    vector<uint> ordered(_indexCount);
+    float cutoff = 0.0f;
+    for (const Meshlet &meshlet : _meshlets) {
+        optimizeVertexCache(ordered.data() + meshlet.firstIndex, bunny.indices.data() + meshlet.firstIndex, meshlet.indexCount, bunny.vertexCount);
+        cutoff += meshlet.coneCutoff;
+    }
+    bunny.indices.swap(ordered);
+    CC_LOG_INFO("MeshletTest: %u triangles in %u meshlets, mean cone cutoff %.3f, ACMR %.3f",
+                _indexCount / 3u, static_cast<uint>(_meshlets.size()), cutoff / _meshlets.size(),
+                analyzeVertexCache(bunny.indices.data(), _indexCount, bunny.vertexCount).acmr);
+
+    vector<uint8_t> indices = bunny.packIndices();
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(bunny.positions.size() * sizeof(float)),
+        3 * sizeof(float),
+    });
+    _vertexBuffer->update(bunny.positions.data(), 0, static_cast<uint>(bunny.positions.size() * sizeof(float)));
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(indices.size()),
+        bunny.getIndexStride(),
+    });
+    _indexBuffer->update(indices.data(), 0, static_cast<uint>(indices.size()));
+
+    _viewProjBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(sizeof(Mat4)),
+    });
+
+    // static world matrices, one dynamic offset per bunny
+    SeededRandom random;
+    _models.resize(BUNNY_GRID * BUNNY_GRID);
+    _worldBufferStride = TestBaseI::getAlignedUBOStride(_device, sizeof(Mat4));
+    _worldBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(_worldBufferStride * BUNNY_GRID * BUNNY_GRID),
+        _worldBufferStride,
+    });
+
+    uint stride = _worldBufferStride / sizeof(float);
+    vector<float> buffer(stride * BUNNY_GRID * BUNNY_GRID);
+    float origin = -0.5f * BUNNY_SPACING * (BUNNY_GRID - 1u);
+    for (uint i = 0u, idx = 0u; i < BUNNY_GRID; i++) {
+        for (uint j = 0u; j < BUNNY_GRID; j++, idx++) {
+            Mat4 &model = _models[idx];
+            Mat4::createTranslation(origin + BUNNY_SPACING * j, 0.0f, origin + BUNNY_SPACING * i, &model);
+            model.rotateY(random.range(0.0f, 2.0f * math::PI));
+            std::copy(model.m, model.m + 16, &buffer[idx * stride]);
+        }
+    }
+    _worldBuffer->update(buffer.data(), 0, static_cast<uint>(buffer.size() * sizeof(float)));
+
+    _worldBufferView = _device->createBuffer({
+        _worldBuffer,
+        0,
+        sizeof(Mat4),
+    });
+}
+
+void MeshletTest::createInputAssembler() {
+    gfx::Attribute position = {"a_position", gfx::Format::RGB32F, false, 0, false};
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.emplace_back(std::move(position));
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+}
+
+void MeshletTest::createPipelineState() {
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    dslInfo.bindings.push_back({1, gfx::DescriptorType::DYNAMIC_UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(static_cast<uint>(Binding::VIEW_PROJ), _viewProjBuffer);
+    _descriptorSet->bindBuffer(static_cast<uint>(Binding::WORLD), _worldBufferView);
+    _descriptorSet->update();
+
+    gfx::PipelineStateInfo pipelineStateInfo;
+    pipelineStateInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineStateInfo.shader = _shader;
+    pipelineStateInfo.inputState = {_inputAssembler->getAttributes()};
+    pipelineStateInfo.renderPass = _fbo->getRenderPass();
+    pipelineStateInfo.depthStencilState.depthTest = true;
+    pipelineStateInfo.depthStencilState.depthWrite = true;
+    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineStateInfo.pipelineLayout = _pipelineLayout;
+    _pipelineState = _device->createPipelineState(pipelineStateInfo);
+}
+
+void MeshletTest::tick() {
+    lookupTime();
+    uint steps = _clock.advance(hostThread.dt);
+    for (uint i = 0; i < steps; ++i) {
+        _prevTime = _time;
+        _time += _clock.step;
+    }
+    float time = _prevTime + (_time - _prevTime) * _clock.alpha;
+
+    // stand in the middle of the field and turn around, so most bunnies are off screen or seen from one side
+    Vec3 eye(0.0f, 8.0f, 0.0f);
+    Vec3 target(100.0f * std::cos(time * 0.3f), 0.0f, 100.0f * std::sin(time * 0.3f));
+    Mat4 view;
+    Mat4::createLookAt(eye, target, Vec3(0.0f, 1.0f, 0.0f), &view);
+
+    Mat4 projection;
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 0.1f, 400.0f, &projection);
+    Mat4 viewProjection = projection * view;
+
+    _draws.clear();
+    _drawCounts.resize(_models.size());
+#if USE_MESHLET_CULLING
+    _culler.setCamera(eye, viewProjection);
+    for (uint i = 0u; i < _models.size(); ++i) {
+        size_t before = _draws.size();
+        _culler.cull(_meshlets, _models[i], _draws);
+        _drawCounts[i] = static_cast<uint>(_draws.size() - before);
+    }
+#else
+    MeshletCullStats &stats = _culler.getStats();
+    for (uint i = 0u; i < _models.size(); ++i) {
+        _draws.push_back({0u, _indexCount});
+        _drawCounts[i] = 1u;
+        stats.tested += static_cast<uint>(_meshlets.size());
+        stats.triangles += _indexCount / 3u;
+        stats.submittedTriangles += _indexCount / 3u;
+        stats.draws++;
+    }
+#endif
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    _viewProjBuffer->update(viewProjection.m, 0, sizeof(Mat4));
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("MeshletTest", _fbo, renderArea);
+
+    commandBuffer->bindInputAssembler(_inputAssembler);
+    commandBuffer->bindPipelineState(_pipelineState);
+    const MeshletDraw *draw = _draws.data();
+    for (uint i = 0u, dynamicOffset = 0u; i < _models.size(); ++i, dynamicOffset += _worldBufferStride) {
+        if (!_drawCounts[i]) continue;
+        commandBuffer->bindDescriptorSet(0, _descriptorSet, 1, &dynamicOffset);
+        for (uint d = 0u; d < _drawCounts[i]; ++d, ++draw) {
+            _inputAssembler->setFirstIndex(draw->firstIndex);
+            _inputAssembler->setIndexCount(draw->indexCount);
+            commandBuffer->draw(_inputAssembler);
+        }
+    }
+
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+
+    _statsFrameTime += hostThread.dt;
+    if (++_statsFrames == 60u) {
+        MeshletCullStats &stats = _culler.getStats();
+        CC_LOG_INFO("Meshlets (%s): %u bunnies, %u of %u triangles submitted per frame in %u draws | %u meshlets tested, %u off screen, %u back facing | %.3fms cull, %.3fms frame",
+                    USE_MESHLET_CULLING ? "culled" : "baseline", static_cast<uint>(_models.size()),
+                    stats.submittedTriangles / _statsFrames, stats.triangles / _statsFrames, stats.draws / _statsFrames,
+                    stats.tested / _statsFrames, stats.frustumCulled / _statsFrames, stats.backfaceCulled / _statsFrames,
+                    stats.cullTime * 1000.f / _statsFrames, _statsFrameTime * 1000.f / _statsFrames);
+        stats.reset();
+        _statsFrames = 0u;
+        _statsFrameTime = 0.0f;
+    }
+}
+
+} // namespace cc
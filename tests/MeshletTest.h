@@ -0,0 +1,53 @@
+#pragma once
+
+#include "TestBase.h"
+#include "Meshlet.h"
+
+namespace cc {
+
+class MeshletTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(MeshletTest)
+    MeshletTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~MeshletTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    void createShader();
+    void createBuffers();
+    void createInputAssembler();
+    void createPipelineState();
+
+    gfx::Shader* _shader = nullptr;
+    gfx::Buffer* _vertexBuffer = nullptr;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::Buffer* _viewProjBuffer = nullptr;
+    gfx::Buffer* _worldBuffer = nullptr;
+    gfx::Buffer* _worldBufferView = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+    gfx::PipelineState* _pipelineState = nullptr;
+
+    vector<Meshlet> _meshlets;
+    vector<Mat4> _models;
+    vector<MeshletDraw> _draws;
+    vector<uint> _drawCounts; // ranges per instance this frame
+    MeshletCuller _culler;
+    uint _worldBufferStride = 0u;
+    uint _indexCount = 0u;
+
+    FixedStep _clock;
+    float _time = 0.0f;
+    float _prevTime = 0.0f;
+    uint _statsFrames = 0u;
+    float _statsFrameTime = 0.0f;
+};
+
+} // namespace cc
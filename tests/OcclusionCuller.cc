@@ -0,0 +1,298 @@
+#include "OcclusionCuller.h"
+#include <cfloat>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define OCCLUSION_SIMD_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define OCCLUSION_SIMD_NEON 1
+#endif
+
+namespace cc {
+
+namespace {
+// just enough of a 4 wide float vector for the rasterizer, the transforms and the hierarchy
+#if OCCLUSION_SIMD_SSE
+using Float4 = __m128;
+using Mask4 = __m128;
+
+inline Float4 splat(float f) { return _mm_set1_ps(f); }
+inline Float4 set4(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+inline Float4 load4(const float *p) { return _mm_loadu_ps(p); }
+inline void store4(float *p, Float4 v) { _mm_storeu_ps(p, v); }
+inline Float4 add4(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+inline Float4 mul4(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+inline Float4 min4(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+inline Float4 max4(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+inline Mask4 greaterEqual4(Float4 a, Float4 b) { return _mm_cmpge_ps(a, b); }
+inline Mask4 and4(Mask4 a, Mask4 b) { return _mm_and_ps(a, b); }
+inline Float4 select4(Mask4 m, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+inline bool any4(Mask4 m) { return _mm_movemask_ps(m) != 0; }
+// max of neighboring lanes: (max(a0, a1), max(a2, a3), max(b0, b1), max(b2, b3))
+inline Float4 maxPairs4(Float4 a, Float4 b) {
+    return _mm_max_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+#elif OCCLUSION_SIMD_NEON
+using Float4 = float32x4_t;
+using Mask4 = uint32x4_t;
+
+inline Float4 splat(float f) { return vdupq_n_f32(f); }
+inline Float4 set4(float a, float b, float c, float d) {
+    float v[4] = {a, b, c, d};
+    return vld1q_f32(v);
+}
+inline Float4 load4(const float *p) { return vld1q_f32(p); }
+inline void store4(float *p, Float4 v) { vst1q_f32(p, v); }
+inline Float4 add4(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+inline Float4 mul4(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+inline Float4 min4(Float4 a, Float4 b) { return vminq_f32(a, b); }
+inline Float4 max4(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+inline Mask4 greaterEqual4(Float4 a, Float4 b) { return vcgeq_f32(a, b); }
+inline Mask4 and4(Mask4 a, Mask4 b) { return vandq_u32(a, b); }
+inline Float4 select4(Mask4 m, Float4 a, Float4 b) { return vbslq_f32(m, a, b); }
+inline bool any4(Mask4 m) {
+    uint32x2_t r = vorr_u32(vget_low_u32(m), vget_high_u32(m));
+    return (vget_lane_u32(r, 0) | vget_lane_u32(r, 1)) != 0u;
+}
+inline Float4 maxPairs4(Float4 a, Float4 b) {
+    float32x4x2_t lanes = vuzpq_f32(a, b);
+    return vmaxq_f32(lanes.val[0], lanes.val[1]);
+}
+#else
+struct Float4 {
+    float v[4];
+};
+struct Mask4 {
+    bool v[4];
+};
+
+inline Float4 splat(float f) { return {{f, f, f, f}}; }
+inline Float4 set4(float a, float b, float c, float d) { return {{a, b, c, d}}; }
+inline Float4 load4(const float *p) { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store4(float *p, Float4 v) { std::copy(v.v, v.v + 4, p); }
+inline Float4 add4(Float4 a, Float4 b) { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+inline Float4 mul4(Float4 a, Float4 b) { return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; }
+inline Float4 min4(Float4 a, Float4 b) {
+    return {{std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]), std::min(a.v[3], b.v[3])}};
+}
+inline Float4 max4(Float4 a, Float4 b) {
+    return {{std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]), std::max(a.v[3], b.v[3])}};
+}
+inline Mask4 greaterEqual4(Float4 a, Float4 b) { return {{a.v[0] >= b.v[0], a.v[1] >= b.v[1], a.v[2] >= b.v[2], a.v[3] >= b.v[3]}}; }
+inline Mask4 and4(Mask4 a, Mask4 b) { return {{a.v[0] && b.v[0], a.v[1] && b.v[1], a.v[2] && b.v[2], a.v[3] && b.v[3]}}; }
+inline Float4 select4(Mask4 m, Float4 a, Float4 b) {
+    return {{m.v[0] ? a.v[0] : b.v[0], m.v[1] ? a.v[1] : b.v[1], m.v[2] ? a.v[2] : b.v[2], m.v[3] ? a.v[3] : b.v[3]}};
+}
+inline bool any4(Mask4 m) { return m.v[0] || m.v[1] || m.v[2] || m.v[3]; }
+inline Float4 maxPairs4(Float4 a, Float4 b) {
+    return {{std::max(a.v[0], a.v[1]), std::max(a.v[2], a.v[3]), std::max(b.v[0], b.v[1]), std::max(b.v[2], b.v[3])}};
+}
+#endif
+
+// clip space x, y, z, w of a point, the matrix columns preloaded
+inline void transformPoint(const Float4 *columns, float x, float y, float z, float *out) {
+    store4(out, add4(add4(mul4(columns[0], splat(x)), mul4(columns[1], splat(y))), add4(mul4(columns[2], splat(z)), columns[3])));
+}
+} // namespace
+
+OcclusionCuller::OcclusionCuller(uint width, uint height)
+: _width(width),
+  _height(height) {
+    CCASSERT(width % 4u == 0u && !(width & (width - 1u)) && !(height & (height - 1u)), "OcclusionCuller buffer size must be powers of two, at least 4 wide");
+
+    // down to a single texel, a narrow buffer keeps halving its long side alone
+    for (uint w = width, h = height;; w = std::max(w / 2u, 1u), h = std::max(h / 2u, 1u)) {
+        _levelSizes.push_back({w, h});
+        _levels.emplace_back(w * h, FLT_MAX);
+        if (w == 1u && h == 1u) break;
+    }
+}
+
+void OcclusionCuller::beginFrame(const Mat4 &viewProjection) {
+    _viewProjection = viewProjection;
+    std::fill(_levels[0].begin(), _levels[0].end(), FLT_MAX);
+}
+
+void OcclusionCuller::addOccluder(const float *positions, uint vertexCount, const uint *indices, uint indexCount, const Mat4 &model) {
+    auto start = std::chrono::steady_clock::now();
+
+    Mat4 mvp = _viewProjection * model;
+    Float4 columns[4] = {load4(mvp.m), load4(mvp.m + 4), load4(mvp.m + 8), load4(mvp.m + 12)};
+
+    // to pixels once per vertex, the w kept so triangles behind the camera can be told apart
+    _screen.resize(vertexCount * 4u);
+    float halfWidth = 0.5f * _width;
+    float halfHeight = 0.5f * _height;
+    for (uint i = 0u; i < vertexCount; ++i) {
+        float *v = &_screen[i * 4u];
+        transformPoint(columns, positions[i * 3u], positions[i * 3u + 1u], positions[i * 3u + 2u], v);
+        if (v[3] < OCCLUSION_NEAR_W) continue;
+        float invW = 1.0f / v[3];
+        v[0] = (v[0] * invW + 1.0f) * halfWidth;
+        v[1] = (v[1] * invW + 1.0f) * halfHeight;
+        v[2] *= invW;
+    }
+
+    for (uint i = 0u; i + 2u < indexCount; i += 3u) {
+        const float *v0 = &_screen[indices[i] * 4u];
+        const float *v1 = &_screen[indices[i + 1u] * 4u];
+        const float *v2 = &_screen[indices[i + 2u] * 4u];
+        if (v0[3] < OCCLUSION_NEAR_W || v1[3] < OCCLUSION_NEAR_W || v2[3] < OCCLUSION_NEAR_W) continue;
+        rasterizeTriangle(v0, v1, v2);
+    }
+
+    _stats.occluders++;
+    _stats.occluderTriangles += indexCount / 3u;
+    _stats.rasterTime += TestBaseI::secondsSince(start);
+}
+
+void OcclusionCuller::rasterizeTriangle(const float *v0, const float *v1, const float *v2) {
+    // both windings are drawn, so occluders need not be closed or consistently wound
+    float area = (v1[0] - v0[0]) * (v2[1] - v0[1]) - (v2[0] - v0[0]) * (v1[1] - v0[1]);
+    if (area < 0.0f) {
+        std::swap(v1, v2);
+        area = -area;
+    }
+    if (area < 1e-6f) return;
+
+    // pixels whose centers fall inside the bounding box, the first column aligned down to a SIMD group
+    int minX = std::max(static_cast<int>(std::ceil(std::min({v0[0], v1[0], v2[0]}) - 0.5f)), 0);
+    int maxX = std::min(static_cast<int>(std::floor(std::max({v0[0], v1[0], v2[0]}) - 0.5f)), static_cast<int>(_width) - 1);
+    int minY = std::max(static_cast<int>(std::ceil(std::min({v0[1], v1[1], v2[1]}) - 0.5f)), 0);
+    int maxY = std::min(static_cast<int>(std::floor(std::max({v0[1], v1[1], v2[1]}) - 0.5f)), static_cast<int>(_height) - 1);
+    if (minX > maxX || minY > maxY) return;
+    minX &= ~3;
+
+    // edge functions, each positive on the inner side of the edge opposite one vertex
+    float a0 = v1[1] - v2[1], b0 = v2[0] - v1[0], c0 = v1[0] * v2[1] - v1[1] * v2[0];
+    float a1 = v2[1] - v0[1], b1 = v0[0] - v2[0], c1 = v2[0] * v0[1] - v2[1] * v0[0];
+    float a2 = v0[1] - v1[1], b2 = v1[0] - v0[0], c2 = v0[0] * v1[1] - v0[1] * v1[0];
+
+    // depth after the perspective divide is linear in screen space
+    float invArea = 1.0f / area;
+    float dzdx = ((v1[2] - v0[2]) * (v2[1] - v0[1]) - (v2[2] - v0[2]) * (v1[1] - v0[1])) * invArea;
+    float dzdy = ((v1[0] - v0[0]) * (v2[2] - v0[2]) - (v2[0] - v0[0]) * (v1[2] - v0[2])) * invArea;
+    float z0 = v0[2] - dzdx * v0[0] - dzdy * v0[1];
+
+    Float4 zero = splat(0.0f);
+    Float4 columnX = add4(splat(static_cast<float>(minX)), set4(0.5f, 1.5f, 2.5f, 3.5f));
+    Float4 stepE0 = splat(4.0f * a0), stepE1 = splat(4.0f * a1), stepE2 = splat(4.0f * a2), stepZ = splat(4.0f * dzdx);
+    Float4 rowE0 = mul4(splat(a0), columnX), rowE1 = mul4(splat(a1), columnX), rowE2 = mul4(splat(a2), columnX);
+    Float4 rowZ = mul4(splat(dzdx), columnX);
+
+    float *depth = _levels[0].data();
+    for (int y = minY; y <= maxY; ++y) {
+        float py = y + 0.5f;
+        Float4 e0 = add4(rowE0, splat(b0 * py + c0));
+        Float4 e1 = add4(rowE1, splat(b1 * py + c1));
+        Float4 e2 = add4(rowE2, splat(b2 * py + c2));
+        Float4 z = add4(rowZ, splat(dzdy * py + z0));
+        float *row = depth + y * _width;
+        for (int x = minX; x <= maxX; x += 4) {
+            Mask4 inside = and4(and4(greaterEqual4(e0, zero), greaterEqual4(e1, zero)), greaterEqual4(e2, zero));
+            if (any4(inside)) {
+                Float4 current = load4(row + x);
+                store4(row + x, select4(inside, min4(current, z), current));
+            }
+            e0 = add4(e0, stepE0);
+            e1 = add4(e1, stepE1);
+            e2 = add4(e2, stepE2);
+            z = add4(z, stepZ);
+        }
+    }
+    _stats.rasterizedTriangles++;
+}
+
+void OcclusionCuller::endOccluders() {
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint level = 1u; level < _levels.size(); ++level) {
+        const Level &src = _levelSizes[level - 1u];
+        const Level &dst = _levelSizes[level];
+        const float *in = _levels[level - 1u].data();
+        float *out = _levels[level].data();
+        for (uint y = 0u; y < dst.height; ++y) {
+            const float *row0 = in + std::min(y * 2u, src.height - 1u) * src.width;
+            const float *row1 = in + std::min(y * 2u + 1u, src.height - 1u) * src.width;
+            float *dstRow = out + y * dst.width;
+            uint x = 0u;
+            if (src.width >= 2u * dst.width) {
+                for (; x + 4u <= dst.width; x += 4u) {
+                    Float4 left = max4(load4(row0 + x * 2u), load4(row1 + x * 2u));
+                    Float4 right = max4(load4(row0 + x * 2u + 4u), load4(row1 + x * 2u + 4u));
+                    store4(dstRow + x, maxPairs4(left, right));
+                }
+            }
+            for (; x < dst.width; ++x) {
+                uint x0 = std::min(x * 2u, src.width - 1u);
+                uint x1 = std::min(x * 2u + 1u, src.width - 1u);
+                dstRow[x] = std::max(std::max(row0[x0], row0[x1]), std::max(row1[x0], row1[x1]));
+            }
+        }
+    }
+
+    _stats.rasterTime += TestBaseI::secondsSince(start);
+}
+
+bool OcclusionCuller::isVisible(const Vec3 &boundsMin, const Vec3 &boundsMax, const Mat4 &model) {
+    auto start = std::chrono::steady_clock::now();
+    _stats.tested++;
+
+    Mat4 mvp = _viewProjection * model;
+    Float4 columns[4] = {load4(mvp.m), load4(mvp.m + 4), load4(mvp.m + 8), load4(mvp.m + 12)};
+
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, nearest = FLT_MAX;
+    for (uint i = 0u; i < 8u; ++i) {
+        float v[4];
+        transformPoint(columns, i & 1u ? boundsMax.x : boundsMin.x, i & 2u ? boundsMax.y : boundsMin.y, i & 4u ? boundsMax.z : boundsMin.z, v);
+        // crossing the camera plane, the projected box is meaningless
+        if (v[3] < OCCLUSION_NEAR_W) {
+            _stats.testTime += TestBaseI::secondsSince(start);
+            return true;
+        }
+        float invW = 1.0f / v[3];
+        float x = (v[0] * invW + 1.0f) * 0.5f * _width;
+        float y = (v[1] * invW + 1.0f) * 0.5f * _height;
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        nearest = std::min(nearest, v[2] * invW);
+    }
+
+    // every pixel the box touches, not just those whose centers it covers
+    int x0 = std::max(static_cast<int>(std::floor(minX)), 0);
+    int x1 = std::min(static_cast<int>(std::floor(maxX)), static_cast<int>(_width) - 1);
+    int y0 = std::max(static_cast<int>(std::floor(minY)), 0);
+    int y1 = std::min(static_cast<int>(std::floor(maxY)), static_cast<int>(_height) - 1);
+    if (x0 > x1 || y0 > y1) {
+        _stats.testTime += TestBaseI::secondsSince(start);
+        return true;
+    }
+
+    // the level where the rectangle spans at most 3 texels either way
+    uint extent = static_cast<uint>(std::max(x1 - x0, y1 - y0)) + 1u;
+    uint level = 0u;
+    while ((extent > (2u << level)) && level + 1u < _levels.size()) ++level;
+
+    const Level &size = _levelSizes[level];
+    const float *depth = _levels[level].data();
+    uint tx0 = std::min(static_cast<uint>(x0) >> level, size.width - 1u);
+    uint tx1 = std::min(static_cast<uint>(x1) >> level, size.width - 1u);
+    uint ty0 = std::min(static_cast<uint>(y0) >> level, size.height - 1u);
+    uint ty1 = std::min(static_cast<uint>(y1) >> level, size.height - 1u);
+    float farthest = -FLT_MAX;
+    for (uint ty = ty0; ty <= ty1; ++ty) {
+        for (uint tx = tx0; tx <= tx1; ++tx) {
+            farthest = std::max(farthest, depth[ty * size.width + tx]);
+        }
+    }
+
+    bool visible = nearest <= farthest;
+    if (!visible) _stats.occluded++;
+    _stats.testTime += TestBaseI::secondsSince(start);
+    return visible;
+}
+
+} // namespace cc
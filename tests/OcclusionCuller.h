@@ -0,0 +1,74 @@
+#pragma once
+
+#include "TestBase.h"
+
+// resolution of the CPU depth buffer, both powers of two and the width a multiple of 4
+#define OCCLUSION_BUFFER_WIDTH  256u
+#define OCCLUSION_BUFFER_HEIGHT 128u
+// clip w below which vertices count as behind the camera, occluder triangles touching it are
+// dropped instead of clipped and bounds touching it are always visible
+#define OCCLUSION_NEAR_W        0.01f
+
+namespace cc {
+
+struct OcclusionStats {
+    uint occluders = 0u;
+    uint occluderTriangles = 0u;   // triangles handed to the rasterizer
+    uint rasterizedTriangles = 0u; // of those, the ones that survived near, size and screen rejection
+    uint tested = 0u;
+    uint occluded = 0u;
+    float rasterTime = 0.0f; // occluder transform, rasterization and hierarchy build
+    float testTime = 0.0f;
+
+    void reset() { *this = OcclusionStats(); }
+};
+
+/**
+ * Software occlusion culling against a small set of occluders, entirely on the CPU and without the
+ * frame of latency GPU queries have. Each frame the occluders are rasterized four pixels at a time
+ * (SSE2 or NEON, scalar elsewhere) into a low resolution depth buffer keeping the nearest depth,
+ * which is then reduced into a max depth hierarchy. Bounds are tested by projecting their box and
+ * comparing its nearest depth with the farthest occluder depth over the texels it covers, picked
+ * from the level where that is at most 3x3 of them.
+ * Coverage is sampled at pixel centers, so an occluder edge can hide up to a pixel of this buffer
+ * that it only partly covers; occluder meshes should sit inside what they stand for.
+ */
+class OcclusionCuller {
+public:
+    explicit OcclusionCuller(uint width = OCCLUSION_BUFFER_WIDTH, uint height = OCCLUSION_BUFFER_HEIGHT);
+
+    // clears the depth buffer, occluders and tests that follow use this camera
+    void beginFrame(const Mat4 &viewProjection);
+    // rasterizes an indexed triangle list, positions are xyz floats in model space
+    void addOccluder(const float *positions, uint vertexCount, const uint *indices, uint indexCount, const Mat4 &model);
+    // builds the depth hierarchy, call once after the last occluder and before the first test
+    void endOccluders();
+
+    // false only when the model space box is entirely behind the occluders; boxes off screen are left to the frustum
+    bool isVisible(const Vec3 &boundsMin, const Vec3 &boundsMax, const Mat4 &model);
+
+    inline uint getWidth() const { return _width; }
+    inline uint getHeight() const { return _height; }
+    inline uint getLevelCount() const { return static_cast<uint>(_levels.size()); }
+    // nearest occluder depth per pixel at level 0, farthest per texel above it, FLT_MAX where nothing was drawn
+    inline const float *getDepth(uint level = 0u) const { return _levels[level].data(); }
+    inline OcclusionStats &getStats() { return _stats; }
+
+private:
+    struct Level {
+        uint width;
+        uint height;
+    };
+
+    void rasterizeTriangle(const float *v0, const float *v1, const float *v2);
+
+    uint _width = 0u;
+    uint _height = 0u;
+    Mat4 _viewProjection;
+    vector<vector<float>> _levels;
+    vector<Level> _levelSizes;
+    vector<float> _screen; // per occluder vertex: x and y in pixels, depth, clip w
+    OcclusionStats _stats;
+};
+
+} // namespace cc
@@ -0,0 +1,424 @@
+#include "OcclusionTest.h"
+#include "RenderPassAnalyzer.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+
+// 0 culls against the frustum only, the baseline the occluded counts compare against
+#define USE_OCCLUSION_CULLING 1
+// BUNNY_GRID x BUNNY_GRID bunnies, BUNNY_SPACING apart on the ground plane, with walls between them
+#define BUNNY_GRID       24u
+#define BUNNY_SPACING    14.0f
+#define WALL_COUNT       40u
+#define WALL_HEIGHT      12.0f
+#define WALL_THICKNESS   1.0f
+// the nearest bunnies on screen occlude too, the rest are only tested
+#define OCCLUDER_BUNNIES 8u
+
+namespace cc {
+
+namespace {
+enum class Binding : uint8_t { VIEW_PROJ, WORLD };
+
+// unit box standing on the ground, counter-clockwise outside
+const float CUBE_POSITIONS[] = {
+    -0.5f, 0.0f, -0.5f, 0.5f, 0.0f, -0.5f, -0.5f, 1.0f, -0.5f, 0.5f, 1.0f, -0.5f,
+    -0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, -0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f,
+};
+const uint CUBE_INDICES[] = {
+    5, 1, 3, 5, 3, 7, // +x
+    0, 4, 6, 0, 6, 2, // -x
+    6, 7, 3, 6, 3, 2, // +y
+    0, 1, 5, 0, 5, 4, // -y
+    4, 5, 7, 4, 7, 6, // +z
+    1, 0, 2, 1, 2, 3, // -z
+};
+
+void computeBounds(const float *positions, uint vertexCount, Vec3 &boundsMin, Vec3 &boundsMax) {
+    boundsMin.set(positions[0], positions[1], positions[2]);
+    boundsMax = boundsMin;
+    for (uint i = 1u; i < vertexCount; ++i) {
+        const float *p = positions + i * 3u;
+        boundsMin.set(std::min(boundsMin.x, p[0]), std::min(boundsMin.y, p[1]), std::min(boundsMin.z, p[2]));
+        boundsMax.set(std::max(boundsMax.x, p[0]), std::max(boundsMax.y, p[1]), std::max(boundsMax.z, p[2]));
+    }
+}
+} // namespace
+
+void OcclusionTest::destroy() {
+    CC_SAFE_DESTROY(_shader);
+    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DESTROY(_indexBuffer);
+    CC_SAFE_DESTROY(_viewProjBuffer);
+    CC_SAFE_DESTROY(_worldBufferView);
+    CC_SAFE_DESTROY(_worldBuffer);
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+    CC_SAFE_DESTROY(_pipelineState);
+}
+
+bool OcclusionTest::initialize() {
+    createShader();
+    createBuffers();
+    createInputAssembler();
+    createPipelineState();
+    return true;
+}
+
+void OcclusionTest::createShader() {
+
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+
+            layout(set = 0, binding = 0) uniform ViewProj { mat4 u_viewProj; };
+            layout(set = 0, binding = 1) uniform World { mat4 u_model; };
+
+            layout(location = 0) out vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_position;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec3 a_position;
+
+            layout(std140) uniform ViewProj { mat4 u_viewProj; };
+            layout(std140) uniform World { mat4 u_model; };
+
+            out vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_position;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            uniform mat4 u_viewProj, u_model;
+            varying vec3 v_position;
+
+            void main () {
+                v_position = a_position;
+                gl_Position = u_viewProj * u_model * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_position;
+
+            void main () {
+                gl_FragColor = vec4(v_position * 0.1 + 0.5, 1);
+            }
+        )",
+    };
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::AttributeList attributeList = {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}};
+    gfx::UniformBlockList uniformBlockList = {
+        {0, static_cast<uint>(Binding::VIEW_PROJ), "ViewProj", {{"u_viewProj", gfx::Type::MAT4, 1}}, 1},
+        {0, static_cast<uint>(Binding::WORLD), "World", {{"u_model", gfx::Type::MAT4, 1}}, 1},
+    };
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = "Occlusion Test";
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    _shader = _device->createShader(shaderInfo);
+}
+
+void OcclusionTest::createBuffers() {
+    Mesh mesh;
+    bool valid = mesh.initWithFile("bunny.mesh");
+    CCASSERT(valid, "OcclusionTest load mesh failed");
+
+    MeshData bunny;
+    bunny.initWithMesh(mesh);
+    bunny.buildLods("OcclusionTest");
+    bunny.optimize("OcclusionTest");
+
+    Vec3 bunnyMin, bunnyMax;
+    computeBounds(bunny.positions.data(), bunny.vertexCount, bunnyMin, bunnyMax);
+
+    // the coarsest LOD stands in for every bunny occluder, compacted to the vertices it references
+    const MeshLod &coarsest = bunny.lods.back();
+    vector<uint> remap(bunny.vertexCount, ~0u);
+    for (uint i = 0u; i < coarsest.indexCount; ++i) {
+        uint index = bunny.indices[coarsest.firstIndex + i];
+        if (remap[index] == ~0u) {
+            remap[index] = static_cast<uint>(_bunnyOccluderPositions.size() / 3u);
+            _bunnyOccluderPositions.insert(_bunnyOccluderPositions.end(), &bunny.positions[index * 3u], &bunny.positions[index * 3u] + 3);
+        }
+        _bunnyOccluderIndices.push_back(remap[index]);
+    }
+    _wallPositions.assign(CUBE_POSITIONS, CUBE_POSITIONS + 24);
+    _wallIndices.assign(CUBE_INDICES, CUBE_INDICES + 36);
+
+    // the box goes after the bunny in the same buffers
+    uint wallFirstIndex = static_cast<uint>(bunny.indices.size());
+    for (uint index : _wallIndices) bunny.indices.push_back(bunny.vertexCount + index);
+    bunny.positions.insert(bunny.positions.end(), _wallPositions.begin(), _wallPositions.end());
+    bunny.vertexCount += 8u;
+
+    vector<uint8_t> indices = bunny.packIndices();
+    _vertexBuffer = _device->createBuffer({
+        gfx::BufferUsage::VERTEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(bunny.positions.size() * sizeof(float)),
+        3 * sizeof(float),
+    });
+    _vertexBuffer->update(bunny.positions.data(), 0, static_cast<uint>(bunny.positions.size() * sizeof(float)));
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(indices.size()),
+        bunny.getIndexStride(),
+    });
+    _indexBuffer->update(indices.data(), 0, static_cast<uint>(indices.size()));
+
+    _viewProjBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(sizeof(Mat4)),
+    });
+
+    // a bunny field as in MeshletTest, walls along the lines between the bunnies
+    SeededRandom random;
+    float origin = -0.5f * BUNNY_SPACING * (BUNNY_GRID - 1u);
+    for (uint i = 0u; i < BUNNY_GRID; i++) {
+        for (uint j = 0u; j < BUNNY_GRID; j++) {
+            SceneObject bunnyObject;
+            Mat4::createTranslation(origin + BUNNY_SPACING * j, 0.0f, origin + BUNNY_SPACING * i, &bunnyObject.model);
+            bunnyObject.model.rotateY(random.range(0.0f, 2.0f * math::PI));
+            bunnyObject.boundsMin = bunnyMin;
+            bunnyObject.boundsMax = bunnyMax;
+            bunnyObject.model.transformPoint((bunnyMin + bunnyMax) * 0.5f, &bunnyObject.center);
+            bunnyObject.radius = (bunnyMax - bunnyMin).length() * 0.5f;
+            bunnyObject.firstIndex = bunny.lods[0].firstIndex;
+            bunnyObject.indexCount = bunny.lods[0].indexCount;
+            _objects.push_back(bunnyObject);
+        }
+    }
+    Vec3 wallSize(2.0f * BUNNY_SPACING, WALL_HEIGHT, WALL_THICKNESS);
+    for (uint i = 0u; i < WALL_COUNT; i++) {
+        // keep clear of the camera standing in the middle
+        float x, z;
+        do {
+            x = origin + BUNNY_SPACING * (random.range(0, static_cast<int>(BUNNY_GRID) - 2) + 0.5f);
+            z = origin + BUNNY_SPACING * (random.range(0, static_cast<int>(BUNNY_GRID) - 2) + 0.5f);
+        } while (std::abs(x) < BUNNY_SPACING * 1.5f && std::abs(z) < BUNNY_SPACING * 1.5f);
+
+        SceneObject wall;
+        Mat4::createTranslation(x, 0.0f, z, &wall.model);
+        wall.model.rotateY(random.range(0, 1) * 0.5f * math::PI);
+        wall.model.scale(wallSize);
+        wall.boundsMin.set(-0.5f, 0.0f, -0.5f);
+        wall.boundsMax.set(0.5f, 1.0f, 0.5f);
+        wall.model.transformPoint(Vec3(0.0f, 0.5f, 0.0f), &wall.center);
+        wall.radius = wallSize.length() * 0.5f;
+        wall.firstIndex = wallFirstIndex;
+        wall.indexCount = static_cast<uint>(_wallIndices.size());
+        wall.isWall = true;
+        _objects.push_back(wall);
+    }
+    _visible.resize(_objects.size());
+
+    // static world matrices, one dynamic offset per object
+    _worldBufferStride = TestBaseI::getAlignedUBOStride(_device, sizeof(Mat4));
+    _worldBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(_worldBufferStride * static_cast<uint>(_objects.size())),
+        _worldBufferStride,
+    });
+
+    uint stride = _worldBufferStride / sizeof(float);
+    vector<float> buffer(stride * _objects.size());
+    for (uint i = 0u; i < _objects.size(); i++) {
+        std::copy(_objects[i].model.m, _objects[i].model.m + 16, &buffer[i * stride]);
+    }
+    _worldBuffer->update(buffer.data(), 0, static_cast<uint>(buffer.size() * sizeof(float)));
+
+    _worldBufferView = _device->createBuffer({
+        _worldBuffer,
+        0,
+        sizeof(Mat4),
+    });
+}
+
+void OcclusionTest::createInputAssembler() {
+    gfx::Attribute position = {"a_position", gfx::Format::RGB32F, false, 0, false};
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes.emplace_back(std::move(position));
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+}
+
+void OcclusionTest::createPipelineState() {
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    dslInfo.bindings.push_back({1, gfx::DescriptorType::DYNAMIC_UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(static_cast<uint>(Binding::VIEW_PROJ), _viewProjBuffer);
+    _descriptorSet->bindBuffer(static_cast<uint>(Binding::WORLD), _worldBufferView);
+    _descriptorSet->update();
+
+    gfx::PipelineStateInfo pipelineStateInfo;
+    pipelineStateInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+    pipelineStateInfo.shader = _shader;
+    pipelineStateInfo.inputState = {_inputAssembler->getAttributes()};
+    pipelineStateInfo.renderPass = _fbo->getRenderPass();
+    pipelineStateInfo.depthStencilState.depthTest = true;
+    pipelineStateInfo.depthStencilState.depthWrite = true;
+    pipelineStateInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+    pipelineStateInfo.pipelineLayout = _pipelineLayout;
+    _pipelineState = _device->createPipelineState(pipelineStateInfo);
+}
+
+void OcclusionTest::tick() {
+    lookupTime();
+    uint steps = _clock.advance(hostThread.dt);
+    for (uint i = 0; i < steps; ++i) {
+        _prevTime = _time;
+        _time += _clock.step;
+    }
+    float time = _prevTime + (_time - _prevTime) * _clock.alpha;
+
+    // stand low in the middle of the field and turn around, so the nearest rows hide most of the rest
+    Vec3 eye(0.0f, 5.0f, 0.0f);
+    Vec3 target(100.0f * std::cos(time * 0.3f), 2.0f, 100.0f * std::sin(time * 0.3f));
+    Mat4 view;
+    Mat4::createLookAt(eye, target, Vec3(0.0f, 1.0f, 0.0f), &view);
+
+    Mat4 projection;
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 0.1f, 400.0f, &projection);
+    Mat4 viewProjection = projection * view;
+
+    Frustum frustum;
+    frustum.update(viewProjection);
+    _bunnyOccluders.clear();
+    for (uint i = 0u; i < _objects.size(); ++i) {
+        const SceneObject &object = _objects[i];
+        _visible[i] = frustum.intersectsSphere(object.center, object.radius);
+        if (!_visible[i]) {
+            _statsFrustumCulled++;
+        } else if (!object.isWall) {
+            _bunnyOccluders.push_back(i);
+        }
+    }
+
+#if USE_OCCLUSION_CULLING
+    // every wall on screen and the nearest bunnies go into the depth buffer before anything is tested
+    _culler.beginFrame(viewProjection);
+    for (uint i = 0u; i < _objects.size(); ++i) {
+        if (!_visible[i] || !_objects[i].isWall) continue;
+        _culler.addOccluder(_wallPositions.data(), 8u, _wallIndices.data(), static_cast<uint>(_wallIndices.size()), _objects[i].model);
+    }
+    uint occluderBunnies = std::min(static_cast<uint>(_bunnyOccluders.size()), OCCLUDER_BUNNIES);
+    std::partial_sort(_bunnyOccluders.begin(), _bunnyOccluders.begin() + occluderBunnies, _bunnyOccluders.end(), [&](uint a, uint b) {
+        return _objects[a].center.distanceSquared(eye) < _objects[b].center.distanceSquared(eye);
+    });
+    for (uint i = 0u; i < occluderBunnies; ++i) {
+        _culler.addOccluder(_bunnyOccluderPositions.data(), static_cast<uint>(_bunnyOccluderPositions.size() / 3u),
+                            _bunnyOccluderIndices.data(), static_cast<uint>(_bunnyOccluderIndices.size()), _objects[_bunnyOccluders[i]].model);
+    }
+    _culler.endOccluders();
+
+    for (uint i = 0u; i < _objects.size(); ++i) {
+        if (!_visible[i]) continue;
+        _visible[i] = _culler.isVisible(_objects[i].boundsMin, _objects[i].boundsMax, _objects[i].model);
+    }
+#endif
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    _viewProjBuffer->update(viewProjection.m, 0, sizeof(Mat4));
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("OcclusionTest", _fbo, renderArea);
+
+    commandBuffer->bindInputAssembler(_inputAssembler);
+    commandBuffer->bindPipelineState(_pipelineState);
+    for (uint i = 0u, dynamicOffset = 0u; i < _objects.size(); ++i, dynamicOffset += _worldBufferStride) {
+        if (!_visible[i]) continue;
+        commandBuffer->bindDescriptorSet(0, _descriptorSet, 1, &dynamicOffset);
+        _inputAssembler->setFirstIndex(_objects[i].firstIndex);
+        _inputAssembler->setIndexCount(_objects[i].indexCount);
+        commandBuffer->draw(_inputAssembler);
+        _statsDrawn++;
+        _statsTriangles += _objects[i].indexCount / 3u;
+    }
+
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+
+    _statsFrameTime += hostThread.dt;
+    if (++_statsFrames == 60u) {
+        OcclusionStats &stats = _culler.getStats();
+        CC_LOG_INFO("Occlusion (%s): %u objects, %u off screen, %u occluded, %u drawn, %.2fM triangles | %u occluders, %u of %u occluder triangles rasterized | %.3fms raster, %.3fms test, %.3fms frame",
+                    USE_OCCLUSION_CULLING ? "culled" : "baseline", static_cast<uint>(_objects.size()),
+                    _statsFrustumCulled / _statsFrames, stats.occluded / _statsFrames, _statsDrawn / _statsFrames, _statsTriangles * 1e-6f / _statsFrames,
+                    stats.occluders / _statsFrames, stats.rasterizedTriangles / _statsFrames, stats.occluderTriangles / _statsFrames,
+                    stats.rasterTime * 1000.f / _statsFrames, stats.testTime * 1000.f / _statsFrames, _statsFrameTime * 1000.f / _statsFrames);
+        stats.reset();
+        _statsFrames = 0u;
+        _statsFrustumCulled = 0u;
+        _statsDrawn = 0u;
+        _statsTriangles = 0u;
+        _statsFrameTime = 0.0f;
+    }
+}
+
+} // namespace cc
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "TestBase.h"
+#include "OcclusionCuller.h"
+
+namespace cc {
+
+class OcclusionTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(OcclusionTest)
+    OcclusionTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~OcclusionTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    // a bunny or a wall, both drawn from ranges of the shared index buffer
+    struct SceneObject {
+        Mat4 model;
+        Vec3 boundsMin; // model space box
+        Vec3 boundsMax;
+        Vec3 center; // world space bounding sphere
+        float radius = 0.0f;
+        uint firstIndex = 0u;
+        uint indexCount = 0u;
+        bool isWall = false;
+    };
+
+    void createShader();
+    void createBuffers();
+    void createInputAssembler();
+    void createPipelineState();
+
+    gfx::Shader* _shader = nullptr;
+    gfx::Buffer* _vertexBuffer = nullptr;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::Buffer* _viewProjBuffer = nullptr;
+    gfx::Buffer* _worldBuffer = nullptr;
+    gfx::Buffer* _worldBufferView = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+    gfx::PipelineState* _pipelineState = nullptr;
+
+    vector<SceneObject> _objects;
+    vector<uint8_t> _visible;
+    vector<uint> _bunnyOccluders;
+    // occluder geometry: walls whole, bunnies at their coarsest LOD with only the vertices it uses
+    vector<float> _wallPositions;
+    vector<uint> _wallIndices;
+    vector<float> _bunnyOccluderPositions;
+    vector<uint> _bunnyOccluderIndices;
+    OcclusionCuller _culler;
+    uint _worldBufferStride = 0u;
+
+    FixedStep _clock;
+    float _time = 0.0f;
+    float _prevTime = 0.0f;
+    uint _statsFrames = 0u;
+    uint _statsFrustumCulled = 0u;
+    uint _statsDrawn = 0u;
+    uint _statsTriangles = 0u;
+    float _statsFrameTime = 0.0f;
+};
+
+} // namespace cc
@@ -0,0 +1,275 @@
+#include "ParticleSystem.h"
+
+namespace cc {
+
+namespace {
+/**
+ * Generates a random vector with the given scale
+ * @param scale Length of the resulting vector. If ommitted, a unit vector will
+ * be returned
+ */
+Vec3 vec3Random(SeededRandom &random, float scale /* = 1.0f */) {
+    Vec3 out;
+    float r = random.rand_0_1() * 2.0f * cc::math::PI;
+    float z = (random.rand_0_1() * 2.0f) - 1.0f;
+    float zScale = sqrtf(1.0f - z * z) * scale;
+
+    out.x = cosf(r) * zScale;
+    out.y = sinf(r) * zScale;
+    out.z = z * scale;
+    return out;
+};
+
+Vec3 vec3ScaleAndAdd(const Vec3 &a, const Vec3 &b, float scale) {
+    Vec3 out;
+    out.x = a.x + (b.x * scale);
+    out.y = a.y + (b.y * scale);
+    out.z = a.z + (b.z * scale);
+    return out;
+};
+} // namespace
+
+ParticleSystem::ParticleSystem(uint maxParticles, uint maxEmitters)
+: _particles(maxParticles),
+  _emitters(maxEmitters) {
+    _freeEmitters.reserve(maxEmitters);
+    // hand out low slots first
+    for (uint i = maxEmitters; i > 0u; --i) {
+        _freeEmitters.push_back(i - 1);
+    }
+}
+
+uint ParticleSystem::addEmitter(const EmitterInfo &info) {
+    if (_freeEmitters.empty()) return INVALID_EMITTER;
+
+    uint id = _freeEmitters.back();
+    _freeEmitters.pop_back();
+
+    Emitter &emitter = _emitters[id];
+    emitter.info = info;
+    emitter.elapsed = 0.0f;
+    emitter.spawnAcc = 0.0f;
+    emitter.liveParticles = 0u;
+    emitter.spawned = 0u;
+    emitter.lod = EmitterLod();
+    emitter.tickSteps = 1u;
+    emitter.stepsSinceTick = 0u;
+    emitter.spawning = true;
+    emitter.inUse = true;
+
+    ++_emitterCount;
+    ++_stats.emittersCreated;
+    return id;
+}
+
+void ParticleSystem::stopEmitter(uint id) {
+    Emitter &emitter = _emitters[id];
+    if (!emitter.inUse) return;
+
+    emitter.spawning = false;
+    if (!emitter.liveParticles) releaseEmitter(id);
+}
+
+void ParticleSystem::releaseEmitter(uint id) {
+    _emitters[id].inUse = false;
+    _freeEmitters.push_back(id);
+
+    --_emitterCount;
+    ++_stats.emittersReleased;
+}
+
+void ParticleSystem::spawn(uint id, Emitter &emitter, float dt) {
+    const EmitterInfo &info = emitter.info;
+
+    emitter.spawnAcc += info.rate * dt;
+    uint count = static_cast<uint>(emitter.spawnAcc);
+    emitter.spawnAcc -= count;
+
+    uint available = getMaxParticles() - _particleCount;
+    if (count > available) {
+        _stats.dropped += count - available;
+        count = available;
+    }
+
+    for (uint i = 0u; i < count; ++i) {
+        Particle &p = _particles[_particleCount++];
+        p.position = info.position;
+        p.prevPosition = info.position;
+        p.velocity = vec3Random(_random, _random.range(info.minSpeed, info.maxSpeed));
+        p.age = 0.0f;
+        p.life = _random.range(info.minLife, info.maxLife);
+        p.emitter = id;
+        p.ordinal = emitter.spawned++;
+    }
+    emitter.liveParticles += count;
+    _stats.spawned += count;
+}
+
+void ParticleSystem::setCamera(const Vec3 &eye, const Mat4 &viewProjection) {
+    _eye = eye;
+
+    _frustum.update(viewProjection);
+}
+
+void ParticleSystem::updateLod() {
+    _stats.culledEmitters = 0u;
+    float gravity = _gravity.length();
+
+    for (Emitter &emitter : _emitters) {
+        if (!emitter.inUse) continue;
+
+        EmitterLod &lod = emitter.lod;
+        if (!_lodEnabled) {
+            lod = EmitterLod();
+            continue;
+        }
+
+        // conservative bounds: fastest particle flying for its whole life, plus free fall
+        const EmitterInfo &info = emitter.info;
+        float radius = info.maxSpeed * info.maxLife + 0.5f * gravity * info.maxLife * info.maxLife;
+
+        bool visible = _frustum.intersectsSphere(info.position, radius);
+
+        float distance = info.position.distance(_eye);
+        if (!visible) {
+            // keep culled emitters alive at the lowest rate so they are consistent when they return
+            lod.tickInterval = 8u;
+            lod.drawStride = 0u;
+            ++_stats.culledEmitters;
+        } else if (distance > _lodFarDistance) {
+            lod.tickInterval = 4u;
+            lod.drawStride = 4u;
+        } else if (distance > _lodMidDistance) {
+            lod.tickInterval = 2u;
+            lod.drawStride = 2u;
+        } else {
+            lod = EmitterLod();
+        }
+    }
+}
+
+void ParticleSystem::update(float dt) {
+    auto start = std::chrono::steady_clock::now();
+
+    updateLod();
+    ++_stepIndex;
+
+    for (uint id = 0u; id < _emitters.size(); ++id) {
+        Emitter &emitter = _emitters[id];
+        if (!emitter.inUse) continue;
+
+        // offsetting by id spreads the throttled emitters evenly over the steps
+        uint interval = emitter.lod.tickInterval;
+        emitter.stepDt = (_stepIndex + id) % interval ? 0.0f : dt * interval;
+        if (emitter.stepDt > 0.0f) {
+            emitter.tickSteps = interval;
+            emitter.stepsSinceTick = 0u;
+        } else {
+            ++emitter.stepsSinceTick;
+        }
+        if (!emitter.spawning || emitter.stepDt == 0.0f) continue;
+
+        spawn(id, emitter, emitter.stepDt);
+
+        emitter.elapsed += emitter.stepDt;
+        if (emitter.info.duration > 0.0f && emitter.elapsed >= emitter.info.duration) {
+            emitter.spawning = false;
+            if (!emitter.liveParticles) releaseEmitter(id);
+        }
+    }
+
+    _stats.spawnTime += TestBaseI::secondsSince(start);
+
+    if (_neighborMode != NeighborMode::NONE) applyNeighborForces();
+
+    start = std::chrono::steady_clock::now();
+
+    _stats.simulatedBaseline += _particleCount;
+    for (uint i = 0u; i < _particleCount;) {
+        Particle &p = _particles[i];
+        float stepDt = _emitters[p.emitter].stepDt;
+        if (stepDt == 0.0f) {
+            ++i;
+            continue;
+        }
+
+        ++_stats.simulated;
+        p.age += stepDt;
+
+        if (p.age >= p.life) {
+            Emitter &emitter = _emitters[p.emitter];
+            if (!--emitter.liveParticles && !emitter.spawning) releaseEmitter(p.emitter);
+
+            // swap-remove: the last live particle fills the hole and is visited next
+            p = _particles[--_particleCount];
+            ++_stats.killed;
+            continue;
+        }
+
+        p.prevPosition = p.position;
+        p.velocity = vec3ScaleAndAdd(p.velocity, _gravity, stepDt);
+        p.position = vec3ScaleAndAdd(p.position, p.velocity, stepDt);
+        collide(p);
+        ++i;
+    }
+
+    _stats.simulateTime += TestBaseI::secondsSince(start);
+}
+
+void ParticleSystem::applyNeighborForces() {
+    auto start = std::chrono::steady_clock::now();
+
+    SpatialHash::Strategy strategy = _neighborMode == NeighborMode::HASH_TABLE ? SpatialHash::Strategy::HASH_TABLE : SpatialHash::Strategy::COUNTING_SORT;
+    _grid.build(strategy, &_particles[0].position, _particleCount, sizeof(Particle), _interactionRadius);
+
+    _stats.gridBuildTime += TestBaseI::secondsSince(start);
+    start = std::chrono::steady_clock::now();
+
+    float radiusSq = _interactionRadius * _interactionRadius;
+    for (uint i = 0u; i < _particleCount; ++i) {
+        Particle &p = _particles[i];
+        float stepDt = _emitters[p.emitter].stepDt;
+        if (stepDt == 0.0f) continue;
+
+        Vec3 push;
+        _grid.forEachCandidate(p.position, [&](uint j) {
+            if (j == i) return;
+            Vec3 offset = p.position - _particles[j].position;
+            float distSq = offset.lengthSquared();
+            if (distSq >= radiusSq || distSq < 1e-12f) return;
+
+            // linear falloff separation, strongest when overlapping
+            float dist = std::sqrt(distSq);
+            push += offset * ((1.0f - dist / _interactionRadius) / dist);
+            ++_stats.neighborPairs;
+        });
+        p.velocity = vec3ScaleAndAdd(p.velocity, push, _interactionStrength * stepDt);
+    }
+
+    _stats.neighborTime += TestBaseI::secondsSince(start);
+}
+
+void ParticleSystem::collide(Particle &p) const {
+    for (const CollisionPlane &plane : _planes) {
+        float d = p.position.dot(plane.normal) - plane.distance;
+        if (d >= 0.0f) continue;
+
+        p.position = vec3ScaleAndAdd(p.position, plane.normal, -d);
+        float vn = p.velocity.dot(plane.normal);
+        if (vn < 0.0f) p.velocity = vec3ScaleAndAdd(p.velocity, plane.normal, -(1.0f + _restitution) * vn);
+    }
+
+    for (const CollisionSphere &sphere : _spheres) {
+        Vec3 offset = p.position - sphere.center;
+        float distSq = offset.lengthSquared();
+        if (distSq >= sphere.radius * sphere.radius || distSq < 1e-12f) continue;
+
+        float dist = std::sqrt(distSq);
+        Vec3 normal = offset * (1.0f / dist);
+        p.position = vec3ScaleAndAdd(sphere.center, normal, sphere.radius);
+        float vn = p.velocity.dot(normal);
+        if (vn < 0.0f) p.velocity = vec3ScaleAndAdd(p.velocity, normal, -(1.0f + _restitution) * vn);
+    }
+}
+
+} // namespace cc
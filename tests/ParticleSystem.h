@@ -0,0 +1,174 @@
+#pragma once
+
+#include "TestBase.h"
+#include "SpatialHash.h"
+
+namespace cc {
+
+struct EmitterInfo {
+    Vec3 position;
+    float rate = 50.0f;     // particles spawned per second
+    float duration = 1.0f;  // seconds the emitter keeps spawning, <= 0 spawns forever
+    float minLife = 1.0f;
+    float maxLife = 2.0f;
+    float minSpeed = 1.0f;
+    float maxSpeed = 10.0f;
+    uint texture = 0u;      // tile index in the particle texture atlas
+};
+
+struct Particle {
+    Vec3 position;
+    Vec3 prevPosition; // position before the last step, for render interpolation
+    Vec3 velocity;
+    float age = 0.0f;
+    float life = 0.0f;
+    uint emitter = 0u;
+    uint ordinal = 0u; // spawn order within the emitter, picks the survivors of draw LOD
+};
+
+struct CollisionPlane {
+    Vec3 normal;
+    float distance = 0.0f; // plane is dot(normal, p) == distance
+};
+
+struct CollisionSphere {
+    Vec3 center;
+    float radius = 1.0f;
+};
+
+// chosen per emitter from its distance to the camera and whether its bounds are on screen
+struct EmitterLod {
+    uint tickInterval = 1u; // simulated once every tickInterval steps, round-robin across emitters
+    uint drawStride = 1u;   // every drawStride-th particle is drawn, grown to keep coverage; 0 when culled
+};
+
+enum class NeighborMode : uint8_t {
+    NONE,
+    HASH_TABLE,    // grid built on tommy_hashlin
+    COUNTING_SORT, // grid built as a counting-sorted cell array
+};
+
+struct ParticleStats {
+    uint emittersCreated = 0u;
+    uint emittersReleased = 0u;
+    uint spawned = 0u;
+    uint killed = 0u;
+    uint dropped = 0u; // spawns rejected because the particle pool was full
+    float spawnTime = 0.0f;
+    float simulateTime = 0.0f;
+    float gridBuildTime = 0.0f;
+    float neighborTime = 0.0f;
+    uint neighborPairs = 0u;
+    uint simulated = 0u;         // particle updates actually run
+    uint simulatedBaseline = 0u; // particle updates a full-rate simulation would have run
+    uint culledEmitters = 0u;
+
+    void reset() { *this = ParticleStats(); }
+};
+
+/**
+ * Multi-emitter particle system backed by fixed-size pools.
+ *
+ * Emitter slots are recycled through a free-list, so adding or releasing an emitter is O(1).
+ * Live particles are kept densely packed at the front of the particle pool: spawning appends,
+ * killing swaps the last live particle into the hole, so the update loop never visits a dead slot.
+ */
+class ParticleSystem {
+public:
+    static const uint INVALID_EMITTER = ~0u;
+
+    ParticleSystem(uint maxParticles, uint maxEmitters);
+
+    uint addEmitter(const EmitterInfo &info);
+    // stops spawning; the slot returns to the free-list once its last particle dies
+    void stopEmitter(uint id);
+    void update(float dt);
+    inline void setSeed(uint seed) { _random.seed(seed); }
+
+    inline void setGravity(const Vec3 &gravity) { _gravity = gravity; }
+    inline void setRestitution(float restitution) { _restitution = restitution; }
+    inline void addPlane(const CollisionPlane &plane) { _planes.push_back(plane); }
+    inline void addSphere(const CollisionSphere &sphere) { _spheres.push_back(sphere); }
+
+    // particles closer than radius push each other apart
+    inline void setNeighborMode(NeighborMode mode) { _neighborMode = mode; }
+    inline void setInteraction(float radius, float strength) {
+        _interactionRadius = radius;
+        _interactionStrength = strength;
+    }
+    inline NeighborMode getNeighborMode() const { return _neighborMode; }
+
+    // emitters farther than midDistance tick at half rate, farther than farDistance at quarter rate
+    inline void setLodEnabled(bool enabled) { _lodEnabled = enabled; }
+    inline void setLodDistances(float midDistance, float farDistance) {
+        _lodMidDistance = midDistance;
+        _lodFarDistance = farDistance;
+    }
+    void setCamera(const Vec3 &eye, const Mat4 &viewProjection);
+    inline bool isLodEnabled() const { return _lodEnabled; }
+
+    inline const Particle *getParticles() const { return _particles.data(); }
+    inline uint getParticleCount() const { return _particleCount; }
+    inline uint getMaxParticles() const { return static_cast<uint>(_particles.size()); }
+    inline uint getEmitterCount() const { return _emitterCount; }
+    inline const EmitterInfo &getEmitterInfo(uint id) const { return _emitters[id].info; }
+    inline const EmitterLod &getEmitterLod(uint id) const { return _emitters[id].lod; }
+    // how far to draw the emitter's particles from prevPosition to position, alpha being the fraction of
+    // a step since the last update; a throttled emitter's step spans its whole interval, so its
+    // particles move through it one step at a time, up to tickInterval - 1 steps behind
+    inline float getInterpolation(uint id, float alpha) const {
+        const Emitter &emitter = _emitters[id];
+        return std::min((emitter.stepsSinceTick + alpha) / emitter.tickSteps, 1.0f);
+    }
+    inline ParticleStats &getStats() { return _stats; }
+
+private:
+    struct Emitter {
+        EmitterInfo info;
+        float elapsed = 0.0f;
+        float spawnAcc = 0.0f;
+        uint liveParticles = 0u;
+        uint spawned = 0u;
+        EmitterLod lod;
+        float stepDt = 0.0f; // time covered by this step, 0 if the emitter skips it
+        uint tickSteps = 1u; // steps covered by the last step the emitter ran
+        uint stepsSinceTick = 0u;
+        bool spawning = false;
+        bool inUse = false;
+    };
+
+    void updateLod();
+    void spawn(uint id, Emitter &emitter, float dt);
+    void releaseEmitter(uint id);
+    void applyNeighborForces();
+    void collide(Particle &p) const;
+
+    vector<Particle> _particles;
+    uint _particleCount = 0u;
+
+    vector<Emitter> _emitters;
+    vector<uint> _freeEmitters;
+    uint _emitterCount = 0u;
+
+    Vec3 _gravity;
+    float _restitution = 0.5f;
+    vector<CollisionPlane> _planes;
+    vector<CollisionSphere> _spheres;
+
+    NeighborMode _neighborMode = NeighborMode::NONE;
+    float _interactionRadius = 0.5f;
+    float _interactionStrength = 10.0f;
+    SpatialHash _grid;
+
+    bool _lodEnabled = false;
+    float _lodMidDistance = 40.0f;
+    float _lodFarDistance = 55.0f;
+    Vec3 _eye;
+    Frustum _frustum;
+    uint _stepIndex = 0u;
+
+    SeededRandom _random;
+    ParticleStats _stats;
+};
+
+} // namespace cc
@@ -1,4 +1,10 @@
 #include "ParticleTest.h"
+#include "RenderPassAnalyzer.h"
+
+// 0 streams every frame into a single orphaned region instead of a per-frame ring
+#define USE_VERTEX_RING 1
+// 0 simulates and draws every particle at full rate, the baseline for the LOD counters
+#define USE_PARTICLE_LOD 1
 
 namespace cc {
 
@@ -25,35 +31,12 @@ void fillRectWithColor(uint8_t *buf, uint32_t totalWidth, uint32_t totalHeight,
     }
 }
 
-/**
- * Generates a random vector with the given scale
- * @param scale Length of the resulting vector. If ommitted, a unit vector will
- * be returned
- */
-Vec3 vec3Random(float scale /* = 1.0f */) {
-    Vec3 out;
-    float r = cc::rand_0_1() * 2.0f * cc::math::PI;
-    float z = (cc::rand_0_1() * 2.0f) - 1.0f;
-    float zScale = sqrtf(1.0f - z * z) * scale;
-
-    out.x = cosf(r) * zScale;
-    out.y = sinf(r) * zScale;
-    out.z = z * scale;
-    return out;
-};
-
-Vec3 vec3ScaleAndAdd(const Vec3 &a, const Vec3 &b, float scale) {
-    Vec3 out;
-    out.x = a.x + (b.x * scale);
-    out.y = a.y + (b.y * scale);
-    out.z = a.z + (b.z * scale);
-    return out;
-};
 } // namespace
 
 void ParticleTest::destroy() {
+    CC_SAFE_DELETE(_particleSystem);
     CC_SAFE_DESTROY(_shader);
-    CC_SAFE_DESTROY(_vertexBuffer);
+    CC_SAFE_DELETE(_vertexStream);
     CC_SAFE_DESTROY(_indexBuffer);
     CC_SAFE_DESTROY(_inputAssembler);
     CC_SAFE_DESTROY(_pipelineState);
@@ -66,6 +49,16 @@ void ParticleTest::destroy() {
 }
 
 bool ParticleTest::initialize() {
+    _particleSystem = CC_NEW(ParticleSystem(MAX_QUAD_COUNT, MAX_EMITTER_COUNT));
+    _particleSystem->setGravity({0.0f, -9.8f, 0.0f});
+    _particleSystem->setRestitution(0.4f);
+    _particleSystem->addPlane({{0.0f, 1.0f, 0.0f}, 0.0f});
+    _particleSystem->addSphere({{0.0f, 0.0f, 0.0f}, 6.0f});
+    _particleSystem->setInteraction(0.5f, 20.0f);
+    _particleSystem->setSeed(SIMULATION_SEED);
+    _particleSystem->setLodEnabled(USE_PARTICLE_LOD);
+    _random.seed(SIMULATION_SEED + 1u);
+
     createShader();
     createVertexBuffer();
     createInputAssembler();
@@ -80,12 +73,16 @@ void ParticleTest::createShader() {
     sources.glsl4 = {
         R"(
             precision highp float;
-            layout(location = 0) in vec2 a_quad;
-            layout(location = 1) in vec3 a_position;
+            layout(location = 0) in vec4 a_quad;
+            layout(location = 1) in vec4 a_position;
             layout(location = 2) in vec4 a_color;
 
-            layout(set = 0, binding = 0) uniform MVP_Matrix {
-                mat4 u_model, u_view, u_projection;
+            layout(set = 0, binding = 0) uniform Model {
+                mat4 u_model;
+            };
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
 
             layout(location = 0) out vec4 v_color;
@@ -93,11 +90,13 @@ void ParticleTest::createShader() {
 
             void main() {
                 // billboard
-                vec4 pos = u_view * u_model * vec4(a_position, 1);
-                pos.xy += a_quad.xy;
-                pos = u_projection * pos;
+                // a_position.w scales the quad, far emitters draw fewer and larger particles
+                vec4 pos = cc_matView * u_model * vec4(a_position.xyz, 1);
+                pos.xy += a_quad.xy * a_position.w;
+                pos = cc_matProj * pos;
 
-                v_texcoord = vec2(a_quad * -0.5 + 0.5);
+                // a_quad.zw is the origin of the emitter's tile in the 2x2 atlas
+                v_texcoord = (a_quad.xy * -0.5 + 0.5) * 0.5 + a_quad.zw;
 
                 gl_Position = pos;
                 gl_PointSize = 2.0;
@@ -120,12 +119,16 @@ void ParticleTest::createShader() {
 
     sources.glsl3 = {
         R"(
-            in vec2 a_quad;
-            in vec3 a_position;
+            in vec4 a_quad;
+            in vec4 a_position;
             in vec4 a_color;
 
-            layout(std140) uniform MVP_Matrix {
-                mat4 u_model, u_view, u_projection;
+            layout(std140) uniform Model {
+                mat4 u_model;
+            };
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
 
             out vec4 v_color;
@@ -133,11 +136,13 @@ void ParticleTest::createShader() {
 
             void main() {
                 // billboard
-                vec4 pos = u_view * u_model * vec4(a_position, 1);
-                pos.xy += a_quad.xy;
-                pos = u_projection * pos;
+                // a_position.w scales the quad, far emitters draw fewer and larger particles
+                vec4 pos = cc_matView * u_model * vec4(a_position.xyz, 1);
+                pos.xy += a_quad.xy * a_position.w;
+                pos = cc_matProj * pos;
 
-                v_texcoord = vec2(a_quad * -0.5 + 0.5);
+                // a_quad.zw is the origin of the emitter's tile in the 2x2 atlas
+                v_texcoord = (a_quad.xy * -0.5 + 0.5) * 0.5 + a_quad.zw;
 
                 gl_Position = pos;
                 gl_PointSize = 2.0;
@@ -160,22 +165,24 @@ void ParticleTest::createShader() {
 
     sources.glsl1 = {
         R"(
-            attribute vec2 a_quad;
-            attribute vec3 a_position;
+            attribute vec4 a_quad;
+            attribute vec4 a_position;
             attribute vec4 a_color;
 
-            uniform mat4 u_model, u_view, u_projection;
+            uniform mat4 u_model, cc_matView, cc_matProj;
 
             varying vec4 v_color;
             varying vec2 v_texcoord;
 
             void main() {
                 // billboard
-                vec4 pos = u_view * u_model * vec4(a_position, 1);
-                pos.xy += a_quad.xy;
-                pos = u_projection * pos;
+                // a_position.w scales the quad, far emitters draw fewer and larger particles
+                vec4 pos = cc_matView * u_model * vec4(a_position.xyz, 1);
+                pos.xy += a_quad.xy * a_position.w;
+                pos = cc_matProj * pos;
 
-                v_texcoord = vec2(a_quad * -0.5 + 0.5);
+                // a_quad.zw is the origin of the emitter's tile in the 2x2 atlas
+                v_texcoord = (a_quad.xy * -0.5 + 0.5) * 0.5 + a_quad.zw;
 
                 gl_Position = pos;
                 gl_PointSize = 2.0;
@@ -209,16 +216,12 @@ void ParticleTest::createShader() {
     shaderStageList.emplace_back(std::move(fragmentShaderStage));
 
     gfx::AttributeList attributeList = {
-        {"a_quad", gfx::Format::RG32F, false, 0, false, 0},
-        {"a_position", gfx::Format::RGB32F, false, 0, false, 1},
+        {"a_quad", gfx::Format::RGBA32F, false, 0, false, 0},
+        {"a_position", gfx::Format::RGBA32F, false, 0, false, 1},
         {"a_color", gfx::Format::RGBA32F, false, 0, false, 2},
     };
-    gfx::UniformList mvpMatrix = {
-        {"u_model", gfx::Type::MAT4, 1},
-        {"u_view", gfx::Type::MAT4, 1},
-        {"u_projection", gfx::Type::MAT4, 1},
-    };
-    gfx::UniformBlockList uniformBlockList = {{0, 0, "MVP_Matrix", mvpMatrix, 1}};
+    gfx::UniformList model = {{"u_model", gfx::Type::MAT4, 1}};
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "Model", model, 1}, TestBaseI::getGlobalUniformBlock()};
 
     gfx::UniformSamplerList sampler = {{0, 1, "u_texture", gfx::Type::SAMPLER2D, 1}};
 
@@ -232,19 +235,17 @@ void ParticleTest::createShader() {
 }
 
 void ParticleTest::createVertexBuffer() {
-    // vertex buffer: _vbufferArray[MAX_QUAD_COUNT][4][VERTEX_STRIDE];
-    _vertexBuffer = _device->createBuffer({
-        gfx::BufferUsage::VERTEX,
-        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
-        sizeof(_vbufferArray),
-        VERTEX_STRIDE * sizeof(float),
-    });
+    // vertex buffer: MAX_QUAD_COUNT quads of 4 vertices per frame in flight, filled in host staging each tick and uploaded by one Buffer::update
+    _vertexStream = CC_NEW(StreamingBuffer(_device, gfx::BufferUsage::VERTEX, VERTEX_STRIDE * sizeof(float),
+                                           MAX_QUAD_COUNT * 4, FRAMES_IN_FLIGHT,
+                                           USE_VERTEX_RING ? StreamingBuffer::Mode::RING : StreamingBuffer::Mode::ORPHAN));
 
     // index buffer: _ibufferArray[MAX_QUAD_COUNT][6];
-    uint16_t dst = 0;
+    static_assert(MAX_QUAD_COUNT * 4 <= 65536, "quad vertices must be addressable with 16 bit indices");
+    uint dst = 0;
     uint16_t *p = _ibufferArray[0];
-    for (uint16_t i = 0; i < MAX_QUAD_COUNT; ++i) {
-        uint16_t baseIndex = i * 4;
+    for (uint i = 0; i < MAX_QUAD_COUNT; ++i) {
+        uint16_t baseIndex = static_cast<uint16_t>(i * 4);
         p[dst++] = baseIndex;
         p[dst++] = baseIndex + 1;
         p[dst++] = baseIndex + 2;
@@ -260,32 +261,26 @@ void ParticleTest::createVertexBuffer() {
     });
     _indexBuffer->update(_ibufferArray, 0, sizeof(_ibufferArray));
 
-    for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
-        _particles[i].velocity = vec3Random(cc::random(0.1f, 10.0f));
-        _particles[i].age = 0;
-        _particles[i].life = cc::random(1.0f, 10.0f);
-    }
-
     _uniformBuffer = _device->createBuffer({
         gfx::BufferUsage::UNIFORM,
         gfx::MemoryUsage::DEVICE,
-        TestBaseI::getUBOSize(3 * sizeof(Mat4)),
+        TestBaseI::getUBOSize(sizeof(Mat4)),
     });
-    Mat4 model, view;
-    Mat4::createLookAt(Vec3(30.0f, 20.0f, 30.0f), Vec3(0.0f, 2.5f, 0.0f), Vec3(0.0f, 1.0f, 0.f), &view);
+    Mat4 model;
+    _eye.set(30.0f, 20.0f, 30.0f);
+    Mat4::createLookAt(_eye, Vec3(0.0f, 2.5f, 0.0f), Vec3(0.0f, 1.0f, 0.f), &_view);
     _uniformBuffer->update(model.m, 0, sizeof(model));
-    _uniformBuffer->update(view.m, sizeof(model), sizeof(view));
 }
 
 void ParticleTest::createInputAssembler() {
-    gfx::Attribute position = {"a_position", gfx::Format::RGB32F, false, 0, false};
-    gfx::Attribute quad = {"a_quad", gfx::Format::RG32F, false, 0, false};
+    gfx::Attribute position = {"a_position", gfx::Format::RGBA32F, false, 0, false};
+    gfx::Attribute quad = {"a_quad", gfx::Format::RGBA32F, false, 0, false};
     gfx::Attribute color = {"a_color", gfx::Format::RGBA32F, false, 0, false};
     gfx::InputAssemblerInfo inputAssemblerInfo;
     inputAssemblerInfo.attributes.emplace_back(std::move(quad));
     inputAssemblerInfo.attributes.emplace_back(std::move(position));
     inputAssemblerInfo.attributes.emplace_back(std::move(color));
-    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexBuffer);
+    inputAssemblerInfo.vertexBuffers.emplace_back(_vertexStream->getBuffer());
     inputAssemblerInfo.indexBuffer = _indexBuffer;
     _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
 }
@@ -296,7 +291,7 @@ void ParticleTest::createPipeline() {
     dslInfo.bindings.push_back({1, gfx::DescriptorType::SAMPLER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
     _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
 
-    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout, TestBaseI::getGlobalDescriptorSetLayout()}});
 
     _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
 
@@ -327,11 +322,19 @@ void ParticleTest::createTexture() {
     const size_t LINE_HEIGHT = 128;
     const size_t BUFFER_SIZE = LINE_WIDHT * LINE_HEIGHT * 4;
     uint8_t *imageData = (uint8_t *)CC_MALLOC(BUFFER_SIZE);
-    fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, 0, 0, 128, 128, 0xD0, 0xD0, 0xD0);
-    fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, 0, 0, 64, 64, 0x50, 0x50, 0x50);
-    fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, 32, 32, 32, 32, 0xFF, 0x00, 0x00);
-    fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, 64, 64, 64, 64, 0x00, 0xFF, 0x00);
-    fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, 96, 96, 32, 32, 0x00, 0x00, 0xFF);
+    // one tile per emitter texture, same pattern with a different tint
+    const uint32_t TILE_SIZE = LINE_WIDHT / ATLAS_TILES_PER_LINE;
+    const uint8_t tints[][3] = {{0xFF, 0xFF, 0xFF}, {0xFF, 0x80, 0x40}, {0x40, 0xC0, 0xFF}, {0xC0, 0x60, 0xFF}};
+    for (uint32_t t = 0; t < ATLAS_TILES_PER_LINE * ATLAS_TILES_PER_LINE; ++t) {
+        const uint8_t *tint = tints[t];
+        uint32_t x = (t % ATLAS_TILES_PER_LINE) * TILE_SIZE;
+        uint32_t y = (t / ATLAS_TILES_PER_LINE) * TILE_SIZE;
+        fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, x, y, TILE_SIZE, TILE_SIZE, 0xD0 * tint[0] / 0xFF, 0xD0 * tint[1] / 0xFF, 0xD0 * tint[2] / 0xFF);
+        fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, x, y, TILE_SIZE / 2, TILE_SIZE / 2, 0x50 * tint[0] / 0xFF, 0x50 * tint[1] / 0xFF, 0x50 * tint[2] / 0xFF);
+        fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, x + TILE_SIZE / 4, y + TILE_SIZE / 4, TILE_SIZE / 4, TILE_SIZE / 4, tint[0], 0x00, 0x00);
+        fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, x + TILE_SIZE / 2, y + TILE_SIZE / 2, TILE_SIZE / 2, TILE_SIZE / 2, 0x00, tint[1], 0x00);
+        fillRectWithColor(imageData, LINE_WIDHT, LINE_HEIGHT, x + TILE_SIZE * 3 / 4, y + TILE_SIZE * 3 / 4, TILE_SIZE / 4, TILE_SIZE / 4, 0x00, 0x00, tint[2]);
+    }
 
     gfx::TextureInfo textureInfo;
     textureInfo.usage = gfx::TextureUsage::SAMPLED | gfx::TextureUsage::TRANSFER_DST;
@@ -357,70 +360,138 @@ void ParticleTest::createTexture() {
 
     // create sampler
     gfx::SamplerInfo samplerInfo;
-    samplerInfo.addressU = gfx::Address::WRAP;
-    samplerInfo.addressV = gfx::Address::WRAP;
+    samplerInfo.addressU = gfx::Address::CLAMP;
+    samplerInfo.addressV = gfx::Address::CLAMP;
     samplerInfo.mipFilter = gfx::Filter::LINEAR;
     _sampler = _device->createSampler(samplerInfo);
 }
 
+void ParticleTest::spawnEmitters(float dt) {
+    // keep a steady churn of short-lived emitters
+    _emitterAcc += EMITTERS_PER_SECOND * dt;
+    uint count = static_cast<uint>(_emitterAcc);
+    _emitterAcc -= count;
+
+    EmitterInfo info;
+    for (uint i = 0; i < count; ++i) {
+        info.position.set(_random.range(-20.0f, 20.0f), _random.range(0.0f, 10.0f), _random.range(-20.0f, 20.0f));
+        info.rate = _random.range(20.0f, 60.0f);
+        info.duration = _random.range(0.1f, 0.4f);
+        info.minLife = 0.5f;
+        info.maxLife = 1.5f;
+        info.minSpeed = 0.5f;
+        info.maxSpeed = 5.0f;
+        info.texture = _random.range(0, ATLAS_TILES_PER_LINE * ATLAS_TILES_PER_LINE - 1);
+        if (_particleSystem->addEmitter(info) == ParticleSystem::INVALID_EMITTER) break;
+    }
+}
+
 void ParticleTest::tick() {
     lookupTime();
 
     gfx::Color clearColor = {0.2f, 0.2f, 0.2f, 1.0f};
 
-    // update particles
-    for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
-        ParticleData &p = _particles[i];
-        p.position = std::move(vec3ScaleAndAdd(p.position, p.velocity, hostThread.dt));
-        p.age += hostThread.dt;
+    TestBaseI::updateGlobals(_view);
+    _particleSystem->setCamera(_eye, TestBaseI::getGlobals().viewProjection);
 
-        if (p.age >= p.life) {
-            p.age = 0;
-            p.position = Vec3::ZERO;
-        }
+    uint steps = _clock.advance(hostThread.dt);
+    for (uint i = 0; i < steps; ++i) {
+        spawnEmitters(_clock.step);
+        _particleSystem->update(_clock.step);
     }
 
-    // update vertex-buffer
-    float *pVbuffer = &_vbufferArray[0][0][0];
-    for (size_t i = 0; i < PARTICLE_COUNT; ++i) {
-        ParticleData &p = _particles[i];
+    // update vertex-buffer, straight into this frame's region of the stream
+    const Particle *particles = _particleSystem->getParticles();
+    uint particleCount = _particleSystem->getParticleCount();
+    _vertexStream->beginFrame();
+    float alpha = _clock.alpha;
+    uint drawCount = 0;
+    for (uint i = 0; i < particleCount; ++i) {
+        const Particle &p = particles[i];
+        const EmitterLod &lod = _particleSystem->getEmitterLod(p.emitter);
+        if (!lod.drawStride || p.ordinal % lod.drawStride) continue;
+
+        // grow survivors so the emitter covers roughly the same area
+        float size = std::sqrt(float(lod.drawStride));
+        float *pVbuffer = reinterpret_cast<float *>(_vertexStream->allocate(4));
+        ++drawCount;
+
+        uint tile = _particleSystem->getEmitterInfo(p.emitter).texture;
+        float tileU = float(tile % ATLAS_TILES_PER_LINE) / ATLAS_TILES_PER_LINE;
+        float tileV = float(tile / ATLAS_TILES_PER_LINE) / ATLAS_TILES_PER_LINE;
+        // render between the last two simulation steps of the particle's emitter
+        Vec3 position = p.prevPosition + (p.position - p.prevPosition) * _particleSystem->getInterpolation(p.emitter, alpha);
         for (size_t v = 0; v < 4; ++v) {
-            size_t offset = VERTEX_STRIDE * (4 * i + v);
+            size_t offset = VERTEX_STRIDE * v;
 
             // quad
             pVbuffer[offset + 0] = quadVerts[v][0];
             pVbuffer[offset + 1] = quadVerts[v][1];
+            pVbuffer[offset + 2] = tileU;
+            pVbuffer[offset + 3] = tileV;
 
             // pos
-            pVbuffer[offset + 2] = p.position.x;
-            pVbuffer[offset + 3] = p.position.y;
-            pVbuffer[offset + 4] = p.position.z;
+            pVbuffer[offset + 4] = position.x;
+            pVbuffer[offset + 5] = position.y;
+            pVbuffer[offset + 6] = position.z;
+            pVbuffer[offset + 7] = size;
 
             // color
-            pVbuffer[offset + 5] = 1;
-            pVbuffer[offset + 6] = 1;
-            pVbuffer[offset + 7] = 1;
-            pVbuffer[offset + 8] = 1.0f - p.age / p.life;
+            pVbuffer[offset + 8] = 1;
+            pVbuffer[offset + 9] = 1;
+            pVbuffer[offset + 10] = 1;
+            pVbuffer[offset + 11] = 1.0f - p.age / p.life;
         }
     }
 
-    Mat4 projection;
-    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
-    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 0.01f, 1000.0f, &projection);
-    _uniformBuffer->update(projection.m, sizeof(Mat4) * 2, sizeof(projection));
+    ParticleStats &stats = _particleSystem->getStats();
+    if (++_statsFrames == 60u) {
+        static const char *neighborModes[] = {"off", "tommy_hashlin", "counting sort"};
+        CC_LOG_INFO("Particles: %u live, %u emitters | per frame: %.3fms spawn, %.3fms simulate, %u spawned, %u killed, %u dropped, %u emitters created, %u released",
+                    particleCount, _particleSystem->getEmitterCount(),
+                    stats.spawnTime * 1000.f / _statsFrames, stats.simulateTime * 1000.f / _statsFrames,
+                    stats.spawned / _statsFrames, stats.killed / _statsFrames, stats.dropped / _statsFrames,
+                    stats.emittersCreated / _statsFrames, stats.emittersReleased / _statsFrames);
+        CC_LOG_INFO("Vertex stream: %u vertices (%.1fKB) staged and uploaded at vertex %u",
+                    _vertexStream->getUsedCount(), _vertexStream->getUsedCount() * VERTEX_STRIDE * sizeof(float) / 1024.f,
+                    _vertexStream->getFirstElement());
+        CC_LOG_INFO("Particle LOD (%s): %u simulated vs %u baseline, %u drawn vs %u baseline per frame, %u emitters culled",
+                    _particleSystem->isLodEnabled() ? "on" : "off",
+                    stats.simulated / _statsFrames, stats.simulatedBaseline / _statsFrames,
+                    drawCount, particleCount, stats.culledEmitters);
+        CC_LOG_INFO("Neighbor grid (%s): %.3fms build, %.3fms interactions, %u pairs per frame",
+                    neighborModes[static_cast<uint>(_particleSystem->getNeighborMode())],
+                    stats.gridBuildTime * 1000.f / _statsFrames, stats.neighborTime * 1000.f / _statsFrames,
+                    stats.neighborPairs / _statsFrames);
+        stats.reset();
+        _statsFrames = 0u;
+
+        // alternate grid build strategies so both are measured on the same workload
+        NeighborMode next = _particleSystem->getNeighborMode() == NeighborMode::COUNTING_SORT ? NeighborMode::HASH_TABLE : NeighborMode::COUNTING_SORT;
+        _particleSystem->setNeighborMode(next);
+    }
 
     _device->acquire();
 
-    _vertexBuffer->update(_vbufferArray, 0, sizeof(_vbufferArray));
+    if (drawCount) {
+        _vertexStream->flush();
+        // indices are region-relative, the base vertex selects this frame's region
+        _inputAssembler->setVertexOffset(_vertexStream->getFirstElement());
+        _inputAssembler->setIndexCount(drawCount * 6);
+    }
     gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
 
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("ParticleTest", _fbo, renderArea);
     commandBuffer->bindInputAssembler(_inputAssembler);
     commandBuffer->bindPipelineState(_pipelineState);
     commandBuffer->bindDescriptorSet(0, _descriptorSet);
-    commandBuffer->draw(_inputAssembler);
+    TestBaseI::bindGlobals(commandBuffer);
+    if (drawCount) {
+        commandBuffer->draw(_inputAssembler);
+    }
     commandBuffer->endRenderPass();
     commandBuffer->end();
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "TestBase.h"
+#include "ParticleSystem.h"
+#include "StreamingBuffer.h"
 
 namespace cc {
 
@@ -22,9 +24,9 @@ private:
     void createPipeline();
     void createInputAssembler();
     void createTexture();
+    void spawnEmitters(float dt);
 
     gfx::Shader* _shader = nullptr;
-    gfx::Buffer* _vertexBuffer = nullptr;
     gfx::Buffer* _indexBuffer = nullptr;
     gfx::Buffer* _uniformBuffer = nullptr;
     gfx::PipelineState* _pipelineState = nullptr;
@@ -35,21 +37,22 @@ private:
     gfx::Texture* _texture = nullptr;
     gfx::Sampler* _sampler = nullptr;
         
-#define MAX_QUAD_COUNT 1024
-#define VERTEX_STRIDE 9
-#define PARTICLE_COUNT 100
-    float _vbufferArray[MAX_QUAD_COUNT][4][VERTEX_STRIDE];
+#define MAX_QUAD_COUNT 16384
+#define VERTEX_STRIDE 12
+#define MAX_EMITTER_COUNT 4096
+#define EMITTERS_PER_SECOND 1000
+#define ATLAS_TILES_PER_LINE 2
+#define FRAMES_IN_FLIGHT 3
     uint16_t _ibufferArray[MAX_QUAD_COUNT][6];
-    
-    struct ParticleData
-    {
-        Vec3 position;
-        Vec3 velocity;
-        float age;
-        float life;
-    };
-    
-    ParticleData _particles[PARTICLE_COUNT];
+
+    StreamingBuffer *_vertexStream = nullptr;
+    Mat4 _view;
+    Vec3 _eye;
+    ParticleSystem *_particleSystem = nullptr;
+    float _emitterAcc = 0.0f;
+    FixedStep _clock;
+    SeededRandom _random;
+    uint _statsFrames = 0u;
 };
 
 } // namespace cc
@@ -0,0 +1,144 @@
+#include "PixelConvert.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #include <immintrin.h>
+    #define PIXEL_CONVERT_X86 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC compiles any intrinsic whatever /arch says, the CPU check alone guards them
+        #define PIXEL_CONVERT_TARGET(isa)
+    #else
+        #define PIXEL_CONVERT_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define PIXEL_CONVERT_NEON 1
+#endif
+
+namespace cc {
+
+void expandRGB8ToRGBA8Scalar(const uint8_t *src, uint8_t *dst, uint pixels) {
+    for (uint i = 0u; i < pixels; ++i) {
+        dst[i * 4u] = src[i * 3u];
+        dst[i * 4u + 1u] = src[i * 3u + 1u];
+        dst[i * 4u + 2u] = src[i * 3u + 2u];
+        dst[i * 4u + 3u] = 255u;
+    }
+}
+
+namespace {
+using ExpandKernel = void (*)(const uint8_t *src, uint8_t *dst, uint pixels);
+
+struct Kernel {
+    ExpandKernel expand = expandRGB8ToRGBA8Scalar;
+    const char *name = "scalar";
+};
+
+#if PIXEL_CONVERT_X86
+// 48 bytes in three loads, realigned so each register starts at a pixel
+PIXEL_CONVERT_TARGET("ssse3")
+void expandSSSE3(const uint8_t *src, uint8_t *dst, uint pixels) {
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000u));
+    uint i = 0u;
+    for (; i + 16u <= pixels; i += 16u) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(src + i * 3u);
+        __m128i *out = reinterpret_cast<__m128i *>(dst + i * 4u);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        _mm_storeu_si128(out, _mm_or_si128(_mm_shuffle_epi8(a, shuffle), alpha));
+        _mm_storeu_si128(out + 1, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), shuffle), alpha));
+        _mm_storeu_si128(out + 2, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), shuffle), alpha));
+        _mm_storeu_si128(out + 3, _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(c, 4), shuffle), alpha));
+    }
+    expandRGB8ToRGBA8Scalar(src + i * 3u, dst + i * 4u, pixels - i);
+}
+
+// the shuffle stays inside 128 bit lanes, so the permute first moves pixels 4 to 7 into the upper one
+PIXEL_CONVERT_TARGET("avx2")
+void expandAVX2(const uint8_t *src, uint8_t *dst, uint pixels) {
+    const __m256i spread = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                             0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xff000000u));
+    uint i = 0u;
+    // a load reads 32 bytes for the 24 it uses, stop before it runs past the end of src
+    for (; i + 11u <= pixels; i += 8u) {
+        __m256i rgb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 3u));
+        __m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(rgb, spread), shuffle), alpha);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 4u), rgba);
+    }
+    expandSSSE3(src + i * 3u, dst + i * 4u, pixels - i);
+}
+
+Kernel selectKernel() {
+    Kernel kernel;
+    bool ssse3 = false;
+    bool avx2 = false;
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    ssse3 = (info[2] & (1 << 9)) != 0;
+    // AVX state has to be enabled by the OS too, or the first ymm instruction faults
+    bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6u) == 6u;
+    if (avx && maxLeaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+    #else
+    __builtin_cpu_init();
+    ssse3 = __builtin_cpu_supports("ssse3");
+    avx2 = __builtin_cpu_supports("avx2");
+    #endif
+    if (avx2) {
+        kernel.expand = expandAVX2;
+        kernel.name = "AVX2";
+    } else if (ssse3) {
+        kernel.expand = expandSSSE3;
+        kernel.name = "SSSE3";
+    }
+    return kernel;
+}
+#elif PIXEL_CONVERT_NEON
+// vld3 deinterleaves 16 pixels into planes, vst4 interleaves them back with the alpha plane
+void expandNEON(const uint8_t *src, uint8_t *dst, uint pixels) {
+    const uint8x16_t alpha = vdupq_n_u8(255u);
+    uint i = 0u;
+    for (; i + 16u <= pixels; i += 16u) {
+        uint8x16x3_t rgb = vld3q_u8(src + i * 3u);
+        uint8x16x4_t rgba = {{rgb.val[0], rgb.val[1], rgb.val[2], alpha}};
+        vst4q_u8(dst + i * 4u, rgba);
+    }
+    expandRGB8ToRGBA8Scalar(src + i * 3u, dst + i * 4u, pixels - i);
+}
+
+Kernel selectKernel() {
+    Kernel kernel;
+    kernel.expand = expandNEON;
+    kernel.name = "NEON";
+    return kernel;
+}
+#else
+Kernel selectKernel() {
+    return Kernel();
+}
+#endif
+
+const Kernel &getKernel() {
+    static const Kernel kernel = selectKernel();
+    return kernel;
+}
+} // namespace
+
+void expandRGB8ToRGBA8(const uint8_t *src, uint8_t *dst, uint pixels) {
+    getKernel().expand(src, dst, pixels);
+}
+
+const char *getRGB8ToRGBA8Kernel() {
+    return getKernel().name;
+}
+
+} // namespace cc
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+/**
+ * RGB8 to RGBA8 with opaque alpha, for uploading the jpgs the tests load as RGBA8 textures.
+ *
+ * On x86 the kernel is picked once at runtime from cpuid, so no /arch or -m flags are needed: AVX2
+ * shuffles 8 pixels per lane pair, SSSE3 16 pixels per 3 loads and 4 stores. ARM builds with NEON
+ * deinterleave 16 pixels with vld3 and store them back with vst4. The tail and every other target
+ * run the scalar loop. dst holds pixels * 4 bytes and must not overlap src.
+ */
+void expandRGB8ToRGBA8(const uint8_t *src, uint8_t *dst, uint pixels);
+// the byte at a time reference
+void expandRGB8ToRGBA8Scalar(const uint8_t *src, uint8_t *dst, uint pixels);
+// for logs, "AVX2", "SSSE3", "NEON" or "scalar"
+const char *getRGB8ToRGBA8Kernel();
+
+} // namespace cc
@@ -0,0 +1,468 @@
+#include "PostProcessTest.h"
+#include "RenderPassAnalyzer.h"
+
+// 1 runs the per-pixel stages after the bloom chain as one shader, 0 gives each its own pass and target
+#define FUSE_POST_PASSES      1
+// 1 switches between fused and unfused every stats window, and logs what each costs
+#define POST_FUSION_BENCHMARK 1
+// mips of the bloom chain, the first at half resolution
+#define BLOOM_LEVELS          5u
+#define BLOOM_THRESHOLD       1.0f
+#define BLOOM_INTENSITY       0.6f
+
+namespace cc {
+
+namespace {
+struct PostUniforms {
+    Vec4 source; // uv scale and texel size of the sampled targets
+    Vec4 bloom;
+    Vec4 params; // time, aspect, bloom threshold, bloom intensity
+};
+
+// operate on color at uv of the rendered area, in order, and never look at the neighbours, so any
+// run of them fits in one shader
+struct PerPixelStage {
+    const char *name;
+    const char *code;
+    bool bloom; // samples the bloom chain
+    bool hdr;   // writes values past 1
+};
+
+const PerPixelStage PER_PIXEL_STAGES[] = {
+    {"composite", R"(
+        color += sampleBloom(uv, vec2(0.0)) * u_params.w;
+    )", true, true},
+    {"tone map", R"(
+        color = clamp(color * (2.51 * color + 0.03) / (color * (2.43 * color + 0.59) + 0.14), 0.0, 1.0);
+    )", false, false},
+    {"color grade", R"(
+        color = mix(vec3(dot(color, vec3(0.2126, 0.7152, 0.0722))), color, 1.15);
+        color = clamp((color - 0.5) * 1.08 + 0.5, 0.0, 1.0) * vec3(1.04, 1.0, 0.94);
+    )", false, false},
+    {"vignette", R"(
+        vec2 offset = uv - 0.5;
+        color *= clamp(1.0 - dot(offset, offset) * 1.2, 0.0, 1.0);
+    )", false, false},
+};
+
+// bright discs drifting over a dark gradient, well past 1 where the bloom should pick them up
+const char *SCENE_CODE = R"(
+    color = mix(vec3(0.02, 0.03, 0.08), vec3(0.15, 0.1, 0.2), uv.y);
+    for (int i = 0; i < 8; ++i) {
+        float f = float(i);
+        vec2 center = vec2(0.5 + 0.35 * sin(u_params.x * (0.3 + 0.05 * f) + f * 1.7),
+                           0.5 + 0.3 * cos(u_params.x * (0.4 + 0.03 * f) + f * 2.3));
+        float d = length((uv - center) * vec2(u_params.y, 1.0));
+        vec3 tint = 0.5 + 0.5 * sin(vec3(f, f + 2.1, f + 4.2));
+        color += tint * 6.0 * (1.0 - smoothstep(0.03, 0.04, d));
+    }
+)";
+
+// four bilinear taps around the centre, a 4x4 texel footprint that keeps small highlights from flickering
+const char *DOWNSAMPLE_CODE = R"(
+    color = (sampleSource(uv, vec2(-1.0, -1.0)) + sampleSource(uv, vec2(1.0, -1.0)) +
+             sampleSource(uv, vec2(-1.0, 1.0)) + sampleSource(uv, vec2(1.0, 1.0))) * 0.25;
+)";
+
+const char *PREFILTER_CODE = R"(
+    color = (sampleSource(uv, vec2(-1.0, -1.0)) + sampleSource(uv, vec2(1.0, -1.0)) +
+             sampleSource(uv, vec2(-1.0, 1.0)) + sampleSource(uv, vec2(1.0, 1.0))) * 0.25;
+    color = max(color - u_params.z, 0.0);
+)";
+
+// a 3x3 tent over the smaller level, added to this level's downsample
+const char *UPSAMPLE_CODE = R"(
+    color = sampleBloom(uv, vec2(0.0)) * 4.0;
+    color += (sampleBloom(uv, vec2(-1.0, 0.0)) + sampleBloom(uv, vec2(1.0, 0.0)) +
+              sampleBloom(uv, vec2(0.0, -1.0)) + sampleBloom(uv, vec2(0.0, 1.0))) * 2.0;
+    color += sampleBloom(uv, vec2(-1.0, -1.0)) + sampleBloom(uv, vec2(1.0, -1.0)) +
+             sampleBloom(uv, vec2(-1.0, 1.0)) + sampleBloom(uv, vec2(1.0, 1.0));
+    color = sampleSource(uv, vec2(0.0)) + color / 16.0;
+)";
+
+// taps stay inside the rendered part of the pooled targets
+const char *SAMPLE_HELPERS = R"(
+    vec3 sampleSource(vec2 uv, vec2 texels) {
+        vec2 coord = uv * u_source.xy + texels * u_source.zw;
+        return SAMPLE(u_sourceTexture, clamp(coord, u_source.zw * 0.5, u_source.xy - u_source.zw * 0.5)).rgb;
+    }
+    vec3 sampleBloom(vec2 uv, vec2 texels) {
+        vec2 coord = uv * u_bloom.xy + texels * u_bloom.zw;
+        return SAMPLE(u_bloomTexture, clamp(coord, u_bloom.zw * 0.5, u_bloom.xy - u_bloom.zw * 0.5)).rgb;
+    }
+)";
+
+float getMB(uint bytes) {
+    return bytes / 1048576.0f;
+}
+} // namespace
+
+void PostProcessTest::destroy() {
+    destroyFrameGraph();
+    CC_SAFE_DESTROY(_offscreenVertexBuffer);
+    CC_SAFE_DESTROY(_onscreenVertexBuffer);
+    CC_SAFE_DESTROY(_offscreenInputAssembler);
+    CC_SAFE_DESTROY(_onscreenInputAssembler);
+    CC_SAFE_DESTROY(_sampler);
+    CC_SAFE_DESTROY(_sceneDescriptorSetLayout);
+    CC_SAFE_DESTROY(_postDescriptorSetLayout);
+    CC_SAFE_DESTROY(_scenePipelineLayout);
+    CC_SAFE_DESTROY(_postPipelineLayout);
+}
+
+bool PostProcessTest::initialize() {
+    // without half float targets everything past 1 clips and only the brightest bloom survives
+    if (_device->hasFeature(gfx::Feature::COLOR_HALF_FLOAT)) _sceneFormat = gfx::Format::RGBA16F;
+
+    createSharedResources();
+    createFrameGraph(FUSE_POST_PASSES);
+    return true;
+}
+
+void PostProcessTest::createSharedResources() {
+    // one triangle over the target, UV space origin at top-left; offscreen targets are flipped
+    // like the offscreen projections, so a pass samples what the previous one drew where it drew it
+    float ySigns[] = {_device->getScreenSpaceSignY() * _device->getUVSpaceSignY(), _device->getScreenSpaceSignY()};
+    gfx::Buffer **vertexBuffers[] = {&_offscreenVertexBuffer, &_onscreenVertexBuffer};
+    gfx::InputAssembler **inputAssemblers[] = {&_offscreenInputAssembler, &_onscreenInputAssembler};
+    for (uint i = 0u; i < 2u; ++i) {
+        float ySign = ySigns[i];
+        float vertices[] = {-1, 4 * ySign, 0.0, -1.5,
+                            -1, -1 * ySign, 0.0, 1.0,
+                            4, -1 * ySign, 2.5, 1.0};
+        *vertexBuffers[i] = _device->createBuffer({
+            gfx::BufferUsage::VERTEX,
+            gfx::MemoryUsage::DEVICE,
+            sizeof(vertices),
+            4 * sizeof(float),
+        });
+        (*vertexBuffers[i])->update(vertices, 0, sizeof(vertices));
+
+        gfx::InputAssemblerInfo inputAssemblerInfo;
+        inputAssemblerInfo.attributes.push_back({"a_position", gfx::Format::RG32F, false, 0, false});
+        inputAssemblerInfo.attributes.push_back({"a_texCoord", gfx::Format::RG32F, false, 0, false});
+        inputAssemblerInfo.vertexBuffers.emplace_back(*vertexBuffers[i]);
+        *inputAssemblers[i] = _device->createInputAssembler(inputAssemblerInfo);
+    }
+
+    gfx::SamplerInfo samplerInfo;
+    samplerInfo.addressU = gfx::Address::CLAMP;
+    samplerInfo.addressV = gfx::Address::CLAMP;
+    _sampler = _device->createSampler(samplerInfo);
+
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    _sceneDescriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+    dslInfo.bindings.push_back({1, gfx::DescriptorType::SAMPLER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    dslInfo.bindings.push_back({2, gfx::DescriptorType::SAMPLER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
+    _postDescriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _scenePipelineLayout = _device->createPipelineLayout({{_sceneDescriptorSetLayout}});
+    _postPipelineLayout = _device->createPipelineLayout({{_postDescriptorSetLayout}});
+}
+
+gfx::Shader *PostProcessTest::getShader(const String &name, const String &code, bool sampled) {
+    for (const std::pair<String, gfx::Shader *> &shader : _shaders) {
+        if (shader.first == code) return shader.second;
+    }
+
+    String helpers = sampled ? SAMPLE_HELPERS : "";
+    String main = "void main() {\n vec2 uv = v_texCoord;\n vec3 color = vec3(0.0);\n" + code + "\n OUTPUT = vec4(color, 1.0);\n}\n";
+
+    ShaderSources sources;
+    sources.glsl4 = {
+        R"(
+            layout(location = 0) in vec2 a_position;
+            layout(location = 1) in vec2 a_texCoord;
+            layout(location = 0) out vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        String(R"(
+            precision mediump float;
+            layout(location = 0) in vec2 v_texCoord;
+            layout(set = 0, binding = 0) uniform Post {
+                vec4 u_source;
+                vec4 u_bloom;
+                vec4 u_params;
+            };
+            layout(location = 0) out vec4 o_color;
+            #define SAMPLE texture
+            #define OUTPUT o_color
+        )") + (sampled ? R"(
+            layout(set = 0, binding = 1) uniform sampler2D u_sourceTexture;
+            layout(set = 0, binding = 2) uniform sampler2D u_bloomTexture;
+        )" : "") + helpers + main,
+    };
+
+    sources.glsl3 = {
+        R"(
+            in vec2 a_position;
+            in vec2 a_texCoord;
+            out vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        String(R"(
+            precision mediump float;
+            in vec2 v_texCoord;
+            layout(std140) uniform Post {
+                vec4 u_source;
+                vec4 u_bloom;
+                vec4 u_params;
+            };
+            out vec4 o_color;
+            #define SAMPLE texture
+            #define OUTPUT o_color
+        )") + (sampled ? R"(
+            uniform sampler2D u_sourceTexture;
+            uniform sampler2D u_bloomTexture;
+        )" : "") + helpers + main,
+    };
+
+    sources.glsl1 = {
+        R"(
+            attribute vec2 a_position;
+            attribute vec2 a_texCoord;
+            varying vec2 v_texCoord;
+            void main() {
+                v_texCoord = a_texCoord;
+                gl_Position = vec4(a_position, 0, 1);
+            }
+        )",
+        String(R"(
+            precision mediump float;
+            varying vec2 v_texCoord;
+            uniform vec4 u_source;
+            uniform vec4 u_bloom;
+            uniform vec4 u_params;
+            #define SAMPLE texture2D
+            #define OUTPUT gl_FragColor
+        )") + (sampled ? R"(
+            uniform sampler2D u_sourceTexture;
+            uniform sampler2D u_bloomTexture;
+        )" : "") + helpers + main,
+    };
+
+    ShaderSource &source = TestBaseI::getAppropriateShaderSource(sources);
+
+    gfx::ShaderStageList shaderStageList;
+    gfx::ShaderStage vertexShaderStage;
+    vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+    vertexShaderStage.source = source.vert;
+    shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+    gfx::ShaderStage fragmentShaderStage;
+    fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+    fragmentShaderStage.source = source.frag;
+    shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+    gfx::AttributeList attributeList = {
+        {"a_position", gfx::Format::RG32F, false, 0, false, 0},
+        {"a_texCoord", gfx::Format::RG32F, false, 0, false, 1},
+    };
+    gfx::UniformBlockList uniformBlockList = {
+        {0, 0, "Post", {{"u_source", gfx::Type::FLOAT4, 1}, {"u_bloom", gfx::Type::FLOAT4, 1}, {"u_params", gfx::Type::FLOAT4, 1}}, 1},
+    };
+    gfx::UniformSamplerList samplers;
+    if (sampled) {
+        samplers.push_back({0, 1, "u_sourceTexture", gfx::Type::SAMPLER2D, 1});
+        samplers.push_back({0, 2, "u_bloomTexture", gfx::Type::SAMPLER2D, 1});
+    }
+
+    gfx::ShaderInfo shaderInfo;
+    shaderInfo.name = name;
+    shaderInfo.stages = std::move(shaderStageList);
+    shaderInfo.attributes = std::move(attributeList);
+    shaderInfo.blocks = std::move(uniformBlockList);
+    shaderInfo.samplers = std::move(samplers);
+    gfx::Shader *shader = _device->createShader(shaderInfo);
+    _shaders.emplace_back(code, shader);
+    return shader;
+}
+
+void PostProcessTest::createFrameGraph(bool fused) {
+    _fused = fused;
+    _frameGraph = CC_NEW(FrameGraph(_device));
+
+    // every pass draws over its whole target, nothing is ever cleared
+    auto addPostPass = [&](const String &name, FrameGraph::Handle source, FrameGraph::Handle bloom,
+                           FrameGraph::Handle output, const String &code, bool sampled) {
+        uint index = static_cast<uint>(_passes.size());
+        PostPass pass;
+        pass.name = name;
+        pass.source = source;
+        pass.bloom = bloom;
+        pass.offscreen = output != FrameGraph::BACKBUFFER;
+        pass.shader = getShader(name, code, sampled);
+        pass.pass = _frameGraph->addPass(name, [this, index](gfx::CommandBuffer *commandBuffer) {
+            const PostPass &pass = _passes[index];
+            gfx::InputAssembler *inputAssembler = pass.offscreen ? _offscreenInputAssembler : _onscreenInputAssembler;
+            commandBuffer->bindInputAssembler(inputAssembler);
+            commandBuffer->bindPipelineState(pass.pipelineState);
+            commandBuffer->bindDescriptorSet(0, pass.descriptorSet);
+            commandBuffer->draw(inputAssembler);
+            TestBaseI::getRenderPassAnalyzer()->draw(true);
+        });
+        if (sampled) _frameGraph->read(pass.pass, source);
+        if (bloom) _frameGraph->read(pass.pass, bloom);
+        _frameGraph->writeColor(pass.pass, output);
+        _passes.push_back(pass);
+    };
+
+    FrameGraph::Handle scene = _frameGraph->createTexture("scene color", _sceneFormat);
+    addPostPass("scene", 0u, 0u, scene, SCENE_CODE, false);
+
+    // bloom: threshold into half resolution, halve down the levels, then back up adding each level
+    vector<FrameGraph::Handle> levels;
+    vector<float> scales;
+    FrameGraph::Handle source = scene;
+    float scale = 0.5f;
+    for (uint i = 0u; i < BLOOM_LEVELS; ++i, scale *= 0.5f) {
+        FrameGraph::Handle level = _frameGraph->createTexture("bloom down " + std::to_string(i), _sceneFormat, scale);
+        addPostPass(i ? "bloom down" : "bloom prefilter", source, 0u, level, i ? DOWNSAMPLE_CODE : PREFILTER_CODE, true);
+        levels.push_back(level);
+        scales.push_back(scale);
+        source = level;
+    }
+    FrameGraph::Handle bloom = levels.back();
+    for (uint i = BLOOM_LEVELS - 1u; i-- > 0u;) {
+        FrameGraph::Handle level = _frameGraph->createTexture("bloom up " + std::to_string(i), _sceneFormat, scales[i]);
+        addPostPass("bloom up", levels[i], bloom, level, UPSAMPLE_CODE, true);
+        bloom = level;
+    }
+
+    // fused, the stages run back to back in the pass that presents; unfused, every stage
+    // round-trips its result through a full resolution target
+    source = scene;
+    String name;
+    String code = "color = sampleSource(uv, vec2(0.0));\n";
+    bool samplesBloom = false;
+    uint stageCount = sizeof(PER_PIXEL_STAGES) / sizeof(PER_PIXEL_STAGES[0]);
+    for (uint i = 0u; i < stageCount; ++i) {
+        const PerPixelStage &stage = PER_PIXEL_STAGES[i];
+        name += name.empty() ? stage.name : String(" + ") + stage.name;
+        code += stage.code;
+        samplesBloom = samplesBloom || stage.bloom;
+
+        bool last = i + 1u == stageCount;
+        if (fused && !last) continue;
+        FrameGraph::Handle output = FrameGraph::BACKBUFFER;
+        if (!last) output = _frameGraph->createTexture(stage.name, stage.hdr ? _sceneFormat : gfx::Format::RGBA8);
+        addPostPass(name, source, samplesBloom ? bloom : 0u, output, code, true);
+
+        source = output;
+        name.clear();
+        code = "color = sampleSource(uv, vec2(0.0));\n";
+        samplesBloom = false;
+    }
+
+    _frameGraph->compile();
+
+    for (PostPass &pass : _passes) {
+        bool sampled = pass.source != 0u;
+        pass.uniformBuffer = _device->createBuffer({
+            gfx::BufferUsage::UNIFORM,
+            gfx::MemoryUsage::DEVICE,
+            TestBaseI::getUBOSize(sizeof(PostUniforms)),
+        });
+        pass.descriptorSet = _device->createDescriptorSet({sampled ? _postDescriptorSetLayout : _sceneDescriptorSetLayout});
+        pass.descriptorSet->bindBuffer(0, pass.uniformBuffer);
+
+        gfx::PipelineStateInfo pipelineInfo;
+        pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+        pipelineInfo.shader = pass.shader;
+        pipelineInfo.inputState.attributes = _offscreenInputAssembler->getAttributes();
+        pipelineInfo.renderPass = _frameGraph->getRenderPass(pass.pass);
+        pipelineInfo.depthStencilState.depthTest = false;
+        pipelineInfo.depthStencilState.depthWrite = false;
+        pipelineInfo.rasterizerState.cullMode = gfx::CullMode::NONE;
+        pipelineInfo.pipelineLayout = sampled ? _postPipelineLayout : _scenePipelineLayout;
+        pass.pipelineState = _device->createPipelineState(pipelineInfo);
+    }
+    updateBindings();
+}
+
+void PostProcessTest::destroyFrameGraph() {
+    for (PostPass &pass : _passes) {
+        CC_SAFE_DESTROY(pass.uniformBuffer);
+        CC_SAFE_DESTROY(pass.descriptorSet);
+        CC_SAFE_DESTROY(pass.pipelineState);
+    }
+    _passes.clear();
+    for (std::pair<String, gfx::Shader *> &shader : _shaders) CC_SAFE_DESTROY(shader.second);
+    _shaders.clear();
+    CC_SAFE_DELETE(_frameGraph);
+}
+
+void PostProcessTest::updateBindings() {
+    for (PostPass &pass : _passes) {
+        if (!pass.source) continue;
+        pass.descriptorSet->bindSampler(1, _sampler);
+        pass.descriptorSet->bindSampler(2, _sampler);
+        pass.descriptorSet->bindTexture(1, _frameGraph->getTexture(pass.source));
+        // the slot has to hold something even when the shader doesn't sample it
+        pass.descriptorSet->bindTexture(2, _frameGraph->getTexture(pass.bloom ? pass.bloom : pass.source));
+        pass.descriptorSet->update();
+    }
+}
+
+void PostProcessTest::resize(uint width, uint height) {
+    TestBaseI::resize(width, height);
+
+    _frameGraph->resize(width, height);
+    updateBindings();
+}
+
+void PostProcessTest::tick() {
+    lookupTime();
+    _time += hostThread.dt;
+
+    // the first frame after a rebuild pays for the targets and pipelines, leave it out
+    if (_statsFrames++) _statsFrameTime += hostThread.dt;
+    if (_statsFrames == 61u) {
+        CC_LOG_INFO("PostProcessTest %s: %u passes, %u intermediate targets, %.1fMB allocated for %.1fMB of intermediates | %.3fms per frame",
+                    _fused ? "fused" : "unfused", static_cast<uint>(_passes.size()), _frameGraph->getTextureCount(),
+                    getMB(_frameGraph->getAllocatedBytes()), getMB(_frameGraph->getAttachmentBytes()),
+                    _statsFrameTime * 1000.f / 60u);
+        _statsFrames = 0u;
+        _statsFrameTime = 0.0f;
+#if POST_FUSION_BENCHMARK
+        destroyFrameGraph();
+        createFrameGraph(!_fused);
+#endif
+    }
+
+    // mediump time runs out of precision within minutes, the discs' paths don't mind a wrap
+    float time = std::fmod(_time, 600.0f);
+    float aspect = float(_device->getWidth()) / float(std::max(_device->getHeight(), 1u));
+    for (PostPass &pass : _passes) {
+        PostUniforms uniforms;
+        uniforms.params.set(time, aspect, BLOOM_THRESHOLD, BLOOM_INTENSITY);
+        FrameGraph::Handle textures[] = {pass.source, pass.bloom};
+        Vec4 *scales[] = {&uniforms.source, &uniforms.bloom};
+        for (uint i = 0u; i < 2u; ++i) {
+            if (!textures[i]) continue;
+            const gfx::Texture *texture = _frameGraph->getTexture(textures[i]);
+            Vec2 uvScale = _frameGraph->getUVScale(textures[i]);
+            scales[i]->set(uvScale.x, uvScale.y, 1.0f / texture->getWidth(), 1.0f / texture->getHeight());
+        }
+        pass.uniformBuffer->update(&uniforms, 0, sizeof(uniforms));
+    }
+
+    _device->acquire();
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    _frameGraph->execute(commandBuffer);
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+}
+
+} // namespace cc
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "TestBase.h"
+#include "FrameGraph.h"
+
+namespace cc {
+
+class PostProcessTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(PostProcessTest)
+    PostProcessTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~PostProcessTest() = default;
+
+public:
+     virtual bool initialize() override;
+     virtual void destroy() override;
+     virtual void tick() override;
+     virtual void resize(uint width, uint height) override;
+
+private:
+    // one full screen draw of the frame graph, running one or more stages of the post stack
+    struct PostPass {
+        String name;
+        FrameGraph::Handle pass = 0u;
+        FrameGraph::Handle source = 0u;
+        FrameGraph::Handle bloom = 0u; // 0 when the pass samples no bloom
+        bool offscreen = true;
+        gfx::Shader *shader = nullptr; // owned by _shaders
+        gfx::Buffer *uniformBuffer = nullptr;
+        gfx::DescriptorSet *descriptorSet = nullptr;
+        gfx::PipelineState *pipelineState = nullptr;
+    };
+
+    void createSharedResources();
+    void createFrameGraph(bool fused);
+    void destroyFrameGraph();
+    gfx::Shader *getShader(const String &name, const String &code, bool sampled);
+    void updateBindings();
+
+    gfx::Format _sceneFormat = gfx::Format::RGBA8;
+    bool _fused = true;
+    FrameGraph *_frameGraph = nullptr;
+    vector<PostPass> _passes; // the scene first
+    vector<std::pair<String, gfx::Shader *>> _shaders; // by fragment code
+
+    gfx::Buffer *_offscreenVertexBuffer = nullptr;
+    gfx::Buffer *_onscreenVertexBuffer = nullptr;
+    gfx::InputAssembler *_offscreenInputAssembler = nullptr;
+    gfx::InputAssembler *_onscreenInputAssembler = nullptr;
+    gfx::Sampler *_sampler = nullptr;
+    gfx::DescriptorSetLayout *_sceneDescriptorSetLayout = nullptr;
+    gfx::DescriptorSetLayout *_postDescriptorSetLayout = nullptr;
+    gfx::PipelineLayout *_scenePipelineLayout = nullptr;
+    gfx::PipelineLayout *_postPipelineLayout = nullptr;
+
+    float _time = 0.0f;
+    uint _statsFrames = 0u;
+    float _statsFrameTime = 0.0f;
+};
+
+} // namespace cc
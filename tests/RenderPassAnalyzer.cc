@@ -0,0 +1,233 @@
+#include "RenderPassAnalyzer.h"
+
+namespace cc {
+
+namespace {
+const char *getLoadOpName(gfx::LoadOp loadOp) {
+    switch (loadOp) {
+        case gfx::LoadOp::LOAD: return "LOAD";
+        case gfx::LoadOp::CLEAR: return "CLEAR";
+        default: return "DISCARD";
+    }
+}
+
+const char *getStoreOpName(gfx::StoreOp storeOp) {
+    return storeOp == gfx::StoreOp::STORE ? "STORE" : "DISCARD";
+}
+
+float toMB(uint bytes) {
+    return float(bytes) / (1024.0f * 1024.0f);
+}
+} // namespace
+
+void RenderPassAnalyzer::record(const String &name, gfx::Framebuffer *framebuffer, const gfx::Rect &renderArea) {
+    Pass pass;
+    pass.name = name;
+    _passes.push_back(pass);
+
+    gfx::RenderPass *renderPass = framebuffer->getRenderPass();
+    const gfx::ColorAttachmentList &colorAttachments = renderPass->getColorAttachments();
+    const vector<gfx::Texture *> &colorTextures = framebuffer->getColorTextures();
+
+    // single-sample color attachments of a multisampled pass are resolve targets
+    uint samples = 1u;
+    for (const gfx::ColorAttachment &attachment : colorAttachments) samples = std::max(samples, attachment.sampleCount);
+
+    for (uint i = 0u; i < colorAttachments.size(); ++i) {
+        const gfx::ColorAttachment &attachment = colorAttachments[i];
+        uint resource = getResource(i < colorTextures.size() ? colorTextures[i] : nullptr, false);
+        addUse(resource, i, attachment.loadOp, attachment.storeOp, samples > 1u && attachment.sampleCount == 1u,
+               attachment.format, attachment.sampleCount, renderArea);
+    }
+
+    const gfx::DepthStencilAttachment &depthStencil = renderPass->getDepthStencilAttachment();
+    if (depthStencil.format == gfx::Format::UNKNOWN) return;
+    // depth and stencil live in one attachment, whichever aspect loads or stores moves all of it
+    gfx::LoadOp loadOp = gfx::LoadOp::DISCARD;
+    if (depthStencil.depthLoadOp == gfx::LoadOp::LOAD || depthStencil.stencilLoadOp == gfx::LoadOp::LOAD) {
+        loadOp = gfx::LoadOp::LOAD;
+    } else if (depthStencil.depthLoadOp == gfx::LoadOp::CLEAR || depthStencil.stencilLoadOp == gfx::LoadOp::CLEAR) {
+        loadOp = gfx::LoadOp::CLEAR;
+    }
+    gfx::StoreOp storeOp = gfx::StoreOp::DISCARD;
+    if (depthStencil.depthStoreOp == gfx::StoreOp::STORE || depthStencil.stencilStoreOp == gfx::StoreOp::STORE) {
+        storeOp = gfx::StoreOp::STORE;
+    }
+    addUse(getResource(framebuffer->getDepthStencilTexture(), true), ~0u, loadOp, storeOp, false,
+           depthStencil.format, depthStencil.sampleCount, renderArea);
+}
+
+void RenderPassAnalyzer::read(gfx::Texture *texture) {
+    CCASSERT(!_passes.empty(), "RenderPassAnalyzer: read outside a recorded pass");
+    _passes.back().reads.push_back(getResource(texture, false));
+}
+
+void RenderPassAnalyzer::draw(bool coversRenderArea) {
+    CCASSERT(!_passes.empty(), "RenderPassAnalyzer: draw outside a recorded pass");
+    Pass &pass = _passes.back();
+    if (!pass.draws++) pass.covered = coversRenderArea;
+}
+
+uint RenderPassAnalyzer::getResource(gfx::Texture *texture, bool depthStencil) {
+    // sampled textures are matched by pointer alone, the swapchain images are never sampled
+    for (uint i = 0u; i < _resources.size(); ++i) {
+        const Resource &resource = _resources[i];
+        if (resource.texture != texture) continue;
+        if (texture || resource.depthStencil == depthStencil) return i;
+    }
+    Resource resource;
+    resource.texture = texture;
+    resource.swapchain = !texture;
+    resource.depthStencil = depthStencil;
+    _resources.push_back(resource);
+    return static_cast<uint>(_resources.size() - 1u);
+}
+
+void RenderPassAnalyzer::addUse(uint resource, uint attachment, gfx::LoadOp loadOp, gfx::StoreOp storeOp, bool resolve,
+                                gfx::Format format, uint samples, const gfx::Rect &renderArea) {
+    Use use;
+    use.pass = static_cast<uint>(_passes.size() - 1u);
+    use.resource = resource;
+    use.attachment = attachment;
+    use.loadOp = loadOp;
+    use.storeOp = storeOp;
+    use.resolve = resolve;
+    use.bytes = gfx::FormatSize(format, renderArea.width, renderArea.height, 1u) * samples;
+    _uses.push_back(use);
+}
+
+void RenderPassAnalyzer::analyze() {
+    _reports.clear();
+    _bytesPerFrame = 0u;
+    vector<bool> consumed(_passes.size(), false);
+
+    for (uint i = 0u; i < _uses.size(); ++i) {
+        const Use &use = _uses[i];
+        const Resource &resource = _resources[use.resource];
+        if (use.loadOp == gfx::LoadOp::LOAD) _bytesPerFrame += use.bytes;
+        if (use.storeOp == gfx::StoreOp::STORE) _bytesPerFrame += use.bytes;
+
+        if (use.loadOp == gfx::LoadOp::LOAD) {
+            bool written = false;
+            for (uint j = 0u; j < i && !written; ++j) {
+                written = _uses[j].resource == use.resource && _uses[j].pass < use.pass && _uses[j].storeOp == gfx::StoreOp::STORE;
+            }
+            if (!written) _reports.push_back({Finding::LOADED_UNWRITTEN, i, 0u});
+        }
+
+        if (use.loadOp == gfx::LoadOp::CLEAR && use.attachment != ~0u && !use.resolve && _passes[use.pass].covered) {
+            _reports.push_back({Finding::CLEARED_OVERWRITTEN, i, 0u});
+        }
+
+        if (use.storeOp != gfx::StoreOp::STORE) continue;
+
+        // the next pass that touches the resource decides whether the store was needed
+        uint overwrite = ~0u;
+        bool read = false;
+        for (uint pass = use.pass + 1u; pass < _passes.size() && !read && overwrite == ~0u; ++pass) {
+            const vector<uint> &reads = _passes[pass].reads;
+            read = std::find(reads.begin(), reads.end(), use.resource) != reads.end();
+            for (uint j = i + 1u; j < _uses.size() && !read && overwrite == ~0u; ++j) {
+                if (_uses[j].pass != pass || _uses[j].resource != use.resource) continue;
+                if (_uses[j].loadOp == gfx::LoadOp::LOAD) {
+                    read = true;
+                } else {
+                    overwrite = j;
+                }
+            }
+        }
+
+        if (read || (overwrite == ~0u && resource.swapchain && !resource.depthStencil)) {
+            consumed[use.pass] = true;
+        } else if (overwrite != ~0u) {
+            _reports.push_back({Finding::STORED_OVERWRITTEN, i, overwrite});
+        } else {
+            _reports.push_back({Finding::STORED_UNREAD, i, 0u});
+        }
+    }
+
+    for (uint pass = 0u; pass < _passes.size(); ++pass) {
+        if (!consumed[pass]) _reports.push_back({Finding::REDUNDANT_PASS, pass, 0u});
+    }
+}
+
+void RenderPassAnalyzer::endFrame() {
+    if (_passes.empty()) return;
+    analyze();
+
+    bool changed = _passes.size() != _loggedPasses.size() || _uses != _loggedUses || _reports != _loggedReports;
+    for (uint i = 0u; i < _passes.size() && !changed; ++i) changed = _passes[i].name != _loggedPasses[i];
+    if (changed) {
+        log();
+        _loggedPasses.clear();
+        for (const Pass &pass : _passes) _loggedPasses.push_back(pass.name);
+        _loggedUses = _uses;
+        _loggedReports = _reports;
+    }
+
+    _statsBytes += toMB(_bytesPerFrame);
+    if (++_statsFrames == RENDER_PASS_ANALYZER_STATS_FRAMES) {
+        CC_LOG_INFO("RenderPassAnalyzer: %.2fMB moved per frame on average", _statsBytes / _statsFrames);
+        _statsFrames = 0u;
+        _statsBytes = 0.0f;
+    }
+
+    _passes.clear();
+    _uses.clear();
+    _resources.clear();
+}
+
+void RenderPassAnalyzer::reset() {
+    _passes.clear();
+    _uses.clear();
+    _resources.clear();
+    _reports.clear();
+    _loggedPasses.clear();
+    _loggedUses.clear();
+    _loggedReports.clear();
+    _bytesPerFrame = 0u;
+    _statsFrames = 0u;
+    _statsBytes = 0.0f;
+}
+
+String RenderPassAnalyzer::describe(const Use &use) const {
+    String description = "'" + _passes[use.pass].name + "' ";
+    description += use.attachment == ~0u ? String("depth stencil") : "color " + std::to_string(use.attachment);
+    if (use.resolve) description += " resolve";
+    if (_resources[use.resource].swapchain) description += " (swapchain)";
+    return description;
+}
+
+void RenderPassAnalyzer::log() const {
+    CC_LOG_INFO("RenderPassAnalyzer: %u passes, %.2fMB moved per frame", static_cast<uint>(_passes.size()), toMB(_bytesPerFrame));
+    for (const Use &use : _uses) {
+        CC_LOG_INFO("    %s: %s/%s, %.2fMB loaded, %.2fMB stored", describe(use).c_str(), getLoadOpName(use.loadOp),
+                    getStoreOpName(use.storeOp), toMB(use.loadOp == gfx::LoadOp::LOAD ? use.bytes : 0u),
+                    toMB(use.storeOp == gfx::StoreOp::STORE ? use.bytes : 0u));
+    }
+    for (const Report &report : _reports) {
+        switch (report.finding) {
+            case Finding::STORED_UNREAD:
+                CC_LOG_INFO("    %s is stored but nothing reads it, StoreOp::DISCARD saves %.2fMB",
+                            describe(_uses[report.use]).c_str(), toMB(_uses[report.use].bytes));
+                break;
+            case Finding::STORED_OVERWRITTEN:
+                CC_LOG_INFO("    %s is stored but %s overwrites it unread, StoreOp::DISCARD saves %.2fMB",
+                            describe(_uses[report.use]).c_str(), describe(_uses[report.other]).c_str(), toMB(_uses[report.use].bytes));
+                break;
+            case Finding::LOADED_UNWRITTEN:
+                CC_LOG_INFO("    %s loads what no earlier pass stored this frame, LoadOp::CLEAR or DISCARD saves %.2fMB",
+                            describe(_uses[report.use]).c_str(), toMB(_uses[report.use].bytes));
+                break;
+            case Finding::CLEARED_OVERWRITTEN:
+                CC_LOG_INFO("    %s is cleared and then drawn over completely, LoadOp::DISCARD is enough",
+                            describe(_uses[report.use]).c_str());
+                break;
+            case Finding::REDUNDANT_PASS:
+                CC_LOG_INFO("    '%s' is redundant, nothing uses what it writes", _passes[report.use].name.c_str());
+                break;
+        }
+    }
+}
+
+} // namespace cc
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "TestBase.h"
+
+// the bandwidth average is logged every this many frames
+#define RENDER_PASS_ANALYZER_STATS_FRAMES 60u
+
+namespace cc {
+
+/**
+ * Records the render passes of a frame and reports the load and store ops that cost bandwidth for
+ * nothing, which on tilers is memory traffic the GPU would otherwise keep on chip.
+ *
+ * Call record() right after each beginRenderPass, read() for every attachment texture the pass
+ * samples and draw() for its draws, then endFrame() once the frame is submitted. Attachments are
+ * matched across passes by texture, with the swapchain images standing in for null framebuffer
+ * entries. At the end of the frame it flags
+ *  - stores nothing reads afterwards, only the swapchain color is presented,
+ *  - stores a later pass clears or discards before anything reads them,
+ *  - loads of contents no earlier pass wrote this frame,
+ *  - clears the first draw covers completely, when the pass reports a covering draw,
+ *  - passes none of whose writes are ever used,
+ * and estimates the bytes each attachment moves between tile memory and DRAM: a load reads it, a
+ * store writes it, every sample of it when multisampled, and a resolve writes the single-sample
+ * attachment. Clears and discards cost nothing. Contents kept for the next frame count as unread.
+ *
+ * The report is logged whenever the passes or findings change, the bandwidth average every
+ * RENDER_PASS_ANALYZER_STATS_FRAMES.
+ */
+class RenderPassAnalyzer {
+public:
+    RenderPassAnalyzer() = default;
+
+    void record(const String &name, gfx::Framebuffer *framebuffer, const gfx::Rect &renderArea);
+    // in the last recorded pass
+    void read(gfx::Texture *texture);
+    void draw(bool coversRenderArea = false);
+    void endFrame();
+    // forgets the last report, for the next test
+    void reset();
+
+    uint getBytesPerFrame() const { return _bytesPerFrame; }
+
+private:
+    enum class Finding {
+        STORED_UNREAD,
+        STORED_OVERWRITTEN,
+        LOADED_UNWRITTEN,
+        CLEARED_OVERWRITTEN,
+        REDUNDANT_PASS,
+    };
+
+    struct Report {
+        Finding finding = Finding::REDUNDANT_PASS;
+        uint use = 0u;
+        uint other = 0u; // the overwriting use
+        bool operator==(const Report &rhs) const { return finding == rhs.finding && use == rhs.use && other == rhs.other; }
+    };
+
+    struct Use {
+        uint pass = 0u;
+        uint resource = 0u;
+        uint attachment = 0u; // color index, or ~0u for depth stencil
+        gfx::LoadOp loadOp = gfx::LoadOp::DISCARD;
+        gfx::StoreOp storeOp = gfx::StoreOp::DISCARD;
+        bool resolve = false;
+        uint bytes = 0u; // every sample of the render area
+        bool operator==(const Use &rhs) const {
+            return pass == rhs.pass && resource == rhs.resource && attachment == rhs.attachment &&
+                   loadOp == rhs.loadOp && storeOp == rhs.storeOp && resolve == rhs.resolve;
+        }
+    };
+
+    struct Pass {
+        String name;
+        vector<uint> reads; // resources
+        uint draws = 0u;
+        bool covered = false; // the first draw covers the render area
+    };
+
+    // a texture, or null with swapchain set for the swapchain images
+    struct Resource {
+        gfx::Texture *texture = nullptr;
+        bool swapchain = false;
+        bool depthStencil = false;
+    };
+
+    uint getResource(gfx::Texture *texture, bool depthStencil);
+    void addUse(uint resource, uint attachment, gfx::LoadOp loadOp, gfx::StoreOp storeOp, bool resolve,
+                gfx::Format format, uint samples, const gfx::Rect &renderArea);
+    void analyze();
+    String describe(const Use &use) const;
+    void log() const;
+
+    vector<Pass> _passes;
+    vector<Use> _uses;
+    vector<Resource> _resources;
+    vector<Report> _reports;
+
+    // what was logged last, passes by name
+    vector<String> _loggedPasses;
+    vector<Use> _loggedUses;
+    vector<Report> _loggedReports;
+
+    uint _bytesPerFrame = 0u;
+    uint _statsFrames = 0u;
+    float _statsBytes = 0.0f;
+};
+
+} // namespace cc
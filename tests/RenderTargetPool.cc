@@ -0,0 +1,151 @@
+#include "RenderTargetPool.h"
+
+namespace cc {
+
+namespace {
+uint roundUpToBucket(uint size) {
+    return (std::max(size, 1u) + RENDER_TARGET_BUCKET - 1u) / RENDER_TARGET_BUCKET * RENDER_TARGET_BUCKET;
+}
+} // namespace
+
+RenderTargetPool::RenderTargetPool(gfx::Device *device)
+: _device(device) {
+}
+
+RenderTargetPool::~RenderTargetPool() {
+    destroy();
+}
+
+bool RenderTargetPool::fits(const gfx::Texture *texture, uint width, uint height) const {
+    uint textureWidth = texture->getWidth();
+    uint textureHeight = texture->getHeight();
+    if (textureWidth < width || textureHeight < height) return false;
+    // measured against what acquire would allocate for the extent, so a new target always fits its own
+    // request, however much rounding adds to small ones
+    return float(textureWidth) * float(textureHeight) <= RENDER_TARGET_SLACK * float(roundUpToBucket(width)) * float(roundUpToBucket(height));
+}
+
+gfx::Texture *RenderTargetPool::acquire(gfx::Format format, uint width, uint height, gfx::TextureUsage usage, gfx::SampleCount samples) {
+    ++_textureRequests;
+
+    // the tightest free target that fits
+    uint best = ~0u;
+    float bestPixels = 0.0f;
+    for (uint i = 0u; i < _targets.size(); ++i) {
+        const Target &target = _targets[i];
+        if (target.inUse || target.format != format || target.usage != usage || target.samples != samples) continue;
+        if (!fits(target.texture, width, height)) continue;
+        float pixels = float(target.texture->getWidth()) * float(target.texture->getHeight());
+        if (best == ~0u || pixels < bestPixels) {
+            best = i;
+            bestPixels = pixels;
+        }
+    }
+    if (best != ~0u) {
+        _targets[best].inUse = true;
+        return _targets[best].texture;
+    }
+
+    ++_textureAllocations;
+    gfx::TextureInfo textureInfo;
+    textureInfo.type = gfx::TextureType::TEX2D;
+    textureInfo.usage = usage;
+    textureInfo.format = format;
+    textureInfo.width = roundUpToBucket(width);
+    textureInfo.height = roundUpToBucket(height);
+    textureInfo.samples = samples;
+
+    Target target;
+    target.texture = _device->createTexture(textureInfo);
+    target.format = format;
+    target.usage = usage;
+    target.samples = samples;
+    target.inUse = true;
+    _targets.push_back(target);
+    return target.texture;
+}
+
+void RenderTargetPool::release(gfx::Texture *texture) {
+    for (Target &target : _targets) {
+        if (target.texture != texture) continue;
+        target.inUse = false;
+        target.releasedFrame = _frame;
+        return;
+    }
+    CCASSERT(false, "RenderTargetPool: released a texture the pool doesn't own");
+}
+
+gfx::Framebuffer *RenderTargetPool::getFramebuffer(const gfx::FramebufferInfo &info) {
+    ++_framebufferRequests;
+    for (const CachedFramebuffer &cached : _framebuffers) {
+        if (cached.info.renderPass == info.renderPass && cached.info.colorTextures == info.colorTextures &&
+            cached.info.depthStencilTexture == info.depthStencilTexture) {
+            return cached.framebuffer;
+        }
+    }
+
+    ++_framebufferAllocations;
+    CachedFramebuffer cached;
+    cached.info = info;
+    cached.framebuffer = _device->createFramebuffer(info);
+    _framebuffers.push_back(cached);
+    return cached.framebuffer;
+}
+
+void RenderTargetPool::releaseRenderPass(gfx::RenderPass *renderPass) {
+    for (uint i = 0u; i < _framebuffers.size();) {
+        if (_framebuffers[i].info.renderPass == renderPass) {
+            CC_SAFE_DESTROY(_framebuffers[i].framebuffer);
+            _framebuffers.erase(_framebuffers.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void RenderTargetPool::tick() {
+    ++_frame;
+    for (uint i = 0u; i < _targets.size();) {
+        const Target &target = _targets[i];
+        if (!target.inUse && _frame - target.releasedFrame > RENDER_TARGET_RETIRE_FRAMES) {
+            destroyTarget(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void RenderTargetPool::destroyTarget(uint index) {
+    gfx::Texture *texture = _targets[index].texture;
+    for (uint i = 0u; i < _framebuffers.size();) {
+        const gfx::FramebufferInfo &info = _framebuffers[i].info;
+        if (info.depthStencilTexture == texture || std::find(info.colorTextures.begin(), info.colorTextures.end(), texture) != info.colorTextures.end()) {
+            CC_SAFE_DESTROY(_framebuffers[i].framebuffer);
+            _framebuffers.erase(_framebuffers.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+    CC_SAFE_DESTROY(texture);
+    _targets.erase(_targets.begin() + index);
+}
+
+void RenderTargetPool::destroy() {
+    for (CachedFramebuffer &cached : _framebuffers) {
+        CC_SAFE_DESTROY(cached.framebuffer);
+    }
+    _framebuffers.clear();
+    for (Target &target : _targets) {
+        CC_SAFE_DESTROY(target.texture);
+    }
+    _targets.clear();
+}
+
+void RenderTargetPool::resetStats() {
+    _textureRequests = 0u;
+    _textureAllocations = 0u;
+    _framebufferRequests = 0u;
+    _framebufferAllocations = 0u;
+}
+
+} // namespace cc
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "TestBase.h"
+
+// new targets are rounded up to a multiple of this many pixels per side
+#define RENDER_TARGET_BUCKET        64u
+// a pooled target is reused while it has at most this many times the pixels of the bucket-rounded request
+#define RENDER_TARGET_SLACK         2.0f
+// released targets and their framebuffers are destroyed after this many frames unused
+#define RENDER_TARGET_RETIRE_FRAMES 120u
+
+namespace cc {
+
+/**
+ * Render targets keyed by format, usage and sample count, sized with hysteresis so a window drag
+ * doesn't reallocate on every resize event.
+ *
+ * acquire() hands back a released target that covers the requested extent without wasting more
+ * than RENDER_TARGET_SLACK, and only allocates, rounded up to the bucket, when none does. Callers
+ * render into the top-left of a target and scale sampling by the used fraction. Released targets
+ * stay around for RENDER_TARGET_RETIRE_FRAMES, so dragging back to an earlier size finds them, and
+ * framebuffers are cached on their exact attachments and destroyed with them.
+ */
+class RenderTargetPool {
+public:
+    explicit RenderTargetPool(gfx::Device *device);
+    ~RenderTargetPool();
+
+    gfx::Texture *acquire(gfx::Format format, uint width, uint height, gfx::TextureUsage usage,
+                          gfx::SampleCount samples = gfx::SampleCount::X1);
+    // back to the pool, the caller must not use it again unless acquire returns it
+    void release(gfx::Texture *texture);
+    // the target can keep serving this extent
+    bool fits(const gfx::Texture *texture, uint width, uint height) const;
+
+    // an existing framebuffer with exactly these attachments, or a new one
+    gfx::Framebuffer *getFramebuffer(const gfx::FramebufferInfo &info);
+    // destroys every cached framebuffer of the render pass, before the pass itself goes
+    void releaseRenderPass(gfx::RenderPass *renderPass);
+
+    // once per frame, retires what stayed unused too long
+    void tick();
+    void destroy();
+
+    uint getTextureRequests() const { return _textureRequests; }
+    uint getTextureAllocations() const { return _textureAllocations; }
+    uint getFramebufferRequests() const { return _framebufferRequests; }
+    uint getFramebufferAllocations() const { return _framebufferAllocations; }
+    void resetStats();
+
+private:
+    struct Target {
+        gfx::Texture *texture = nullptr;
+        gfx::Format format = gfx::Format::UNKNOWN;
+        gfx::TextureUsage usage = gfx::TextureUsageBit::NONE;
+        gfx::SampleCount samples = gfx::SampleCount::X1;
+        bool inUse = false;
+        uint releasedFrame = 0u;
+    };
+
+    struct CachedFramebuffer {
+        gfx::FramebufferInfo info;
+        gfx::Framebuffer *framebuffer = nullptr;
+    };
+
+    void destroyTarget(uint index);
+
+    gfx::Device *_device = nullptr;
+    vector<Target> _targets;
+    vector<CachedFramebuffer> _framebuffers;
+    uint _frame = 0u;
+
+    uint _textureRequests = 0u;
+    uint _textureAllocations = 0u;
+    uint _framebufferRequests = 0u;
+    uint _framebufferAllocations = 0u;
+};
+
+} // namespace cc
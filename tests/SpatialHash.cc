@@ -0,0 +1,57 @@
+#include "SpatialHash.h"
+
+namespace cc {
+
+SpatialHash::~SpatialHash() {
+    if (_hashlinInitialized) tommy_hashlin_done(&_hashlin);
+}
+
+void SpatialHash::build(Strategy strategy, const Vec3 *positions, uint count, uint stride, float cellSize) {
+    _strategy = strategy;
+    _invCellSize = 1.0f / cellSize;
+
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(positions);
+    if (_pointHash.size() < count) _pointHash.resize(count);
+    for (uint i = 0u; i < count; ++i) {
+        const Vec3 &p = *reinterpret_cast<const Vec3 *>(base + i * stride);
+        _pointHash[i] = cellHash(cellCoord(p.x), cellCoord(p.y), cellCoord(p.z));
+    }
+
+    if (strategy == Strategy::HASH_TABLE) {
+        // tommy_hashlin has no clear(), tearing down and re-initializing is the rebuild cost
+        if (_hashlinInitialized) tommy_hashlin_done(&_hashlin);
+        tommy_hashlin_init(&_hashlin);
+        _hashlinInitialized = true;
+
+        if (_nodes.size() < count) _nodes.resize(count);
+        for (uint i = 0u; i < count; ++i) {
+            tommy_hashlin_insert(&_hashlin, &_nodes[i], reinterpret_cast<void *>(static_cast<uintptr_t>(i)), _pointHash[i]);
+        }
+        return;
+    }
+
+    // power of two table with at least twice as many buckets as points
+    uint tableSize = 64u;
+    while (tableSize < count * 2u) tableSize <<= 1;
+    _tableMask = tableSize - 1u;
+
+    _cellStart.assign(tableSize + 1u, 0u);
+    if (_sorted.size() < count) _sorted.resize(count);
+
+    for (uint i = 0u; i < count; ++i) {
+        ++_cellStart[(_pointHash[i] & _tableMask) + 1u];
+    }
+    for (uint b = 0u; b < tableSize; ++b) {
+        _cellStart[b + 1u] += _cellStart[b];
+    }
+    // scatter using the bucket starts as cursors, then shift them back
+    for (uint i = 0u; i < count; ++i) {
+        _sorted[_cellStart[_pointHash[i] & _tableMask]++] = i;
+    }
+    for (uint b = tableSize; b > 0u; --b) {
+        _cellStart[b] = _cellStart[b - 1u];
+    }
+    _cellStart[0] = 0u;
+}
+
+} // namespace cc
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "TestBase.h"
+
+extern "C" {
+#include "external/tommyds/tommyhash.h"
+#include "external/tommyds/tommyhashlin.h"
+}
+
+namespace cc {
+
+/**
+ * Uniform grid over points, rebuilt from scratch every frame.
+ *
+ * Two interchangeable build strategies are provided so their cost can be compared:
+ * HASH_TABLE links every point into a tommy_hashlin keyed by its cell hash,
+ * COUNTING_SORT buckets point indices into a flat array ordered by cell hash.
+ * Queries visit every point in the 3x3x3 cells around a position; callers are expected
+ * to do the exact distance test, hash collisions only ever add candidates.
+ */
+class SpatialHash {
+public:
+    enum class Strategy : uint8_t {
+        HASH_TABLE,
+        COUNTING_SORT,
+    };
+
+    SpatialHash() = default;
+    ~SpatialHash();
+
+    void build(Strategy strategy, const Vec3 *positions, uint count, uint stride, float cellSize);
+
+    template <typename Visitor>
+    void forEachCandidate(const Vec3 &position, Visitor &&visit);
+
+    inline Strategy getStrategy() const { return _strategy; }
+
+private:
+    inline int cellCoord(float v) const { return static_cast<int>(std::floor(v * _invCellSize)); }
+    static inline uint cellHash(int x, int y, int z) {
+        return tommy_inthash_u32((static_cast<uint>(x) * 73856093u) ^ (static_cast<uint>(y) * 19349663u) ^ (static_cast<uint>(z) * 83492791u));
+    }
+
+    Strategy _strategy = Strategy::COUNTING_SORT;
+    float _invCellSize = 1.0f;
+
+    // HASH_TABLE
+    tommy_hashlin _hashlin;
+    bool _hashlinInitialized = false;
+    vector<tommy_hashlin_node> _nodes;
+
+    // COUNTING_SORT
+    uint _tableMask = 0u;
+    vector<uint> _cellStart;
+    vector<uint> _pointHash;
+    vector<uint> _sorted;
+};
+
+template <typename Visitor>
+void SpatialHash::forEachCandidate(const Vec3 &position, Visitor &&visit) {
+    int cx = cellCoord(position.x);
+    int cy = cellCoord(position.y);
+    int cz = cellCoord(position.z);
+
+    for (int z = cz - 1; z <= cz + 1; ++z) {
+        for (int y = cy - 1; y <= cy + 1; ++y) {
+            for (int x = cx - 1; x <= cx + 1; ++x) {
+                uint hash = cellHash(x, y, z);
+
+                if (_strategy == Strategy::HASH_TABLE) {
+                    for (tommy_hashlin_node *node = tommy_hashlin_bucket(&_hashlin, hash); node; node = node->next) {
+                        if (node->key == hash) visit(static_cast<uint>(reinterpret_cast<uintptr_t>(node->data)));
+                    }
+                } else {
+                    uint bucket = hash & _tableMask;
+                    for (uint i = _cellStart[bucket]; i < _cellStart[bucket + 1]; ++i) {
+                        // several cells may share a bucket, the full hash tells them apart
+                        if (_pointHash[_sorted[i]] == hash) visit(_sorted[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace cc
@@ -1,4 +1,5 @@
 #include "StencilTest.h"
+#include "RenderPassAnalyzer.h"
 
 namespace cc {
 
@@ -51,12 +52,15 @@ void StencilTest::createShader() {
             layout(location = 1) in vec2 a_texCoord;
             layout(set = 0, binding = 0) uniform World_Matrix {
                 mat4 u_worldMatrix;
-                mat4 u_projMatrix;
+            };
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
             layout(location = 0) out vec2 v_texCoord;
             void main () {
                 v_texCoord = a_texCoord;
-                gl_Position = u_projMatrix * u_worldMatrix * vec4(a_position, 0, 1);
+                gl_Position = cc_matProj * u_worldMatrix * vec4(a_position, 0, 1);
             }
         )",
         R"(
@@ -76,12 +80,15 @@ void StencilTest::createShader() {
             in vec2 a_texCoord;
             layout(std140) uniform World_Matrix {
                 mat4 u_worldMatrix;
-                mat4 u_projMatrix;
+            };
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
             };
             out vec2 v_texCoord;
             void main () {
                 v_texCoord = a_texCoord;
-                gl_Position = u_projMatrix * u_worldMatrix * vec4(a_position, 0, 1);
+                gl_Position = cc_matProj * u_worldMatrix * vec4(a_position, 0, 1);
             }
         )",
         R"(
@@ -102,11 +109,11 @@ void StencilTest::createShader() {
             varying vec2 v_texCoord;
 
             uniform mat4 u_worldMatrix;
-            uniform mat4 u_projMatrix;
+            uniform mat4 cc_matProj;
 
             void main () {
                 v_texCoord = a_texCoord;
-                gl_Position = u_projMatrix * u_worldMatrix * vec4(a_position, 0, 1);
+                gl_Position = cc_matProj * u_worldMatrix * vec4(a_position, 0, 1);
             }
         )",
         R"(
@@ -136,8 +143,8 @@ void StencilTest::createShader() {
         {"a_position", gfx::Format::RG32F, false, 0, false, 0},
         {"a_texCoord", gfx::Format::RG32F, false, 0, false, 1},
     };
-    gfx::UniformList worldMatrix = {{"u_worldMatrix", gfx::Type::MAT4, 1}, {"u_projMatrix", gfx::Type::MAT4, 1}};
-    gfx::UniformBlockList uniformBlockList = {{0, 0, "World_Matrix", worldMatrix, 1}};
+    gfx::UniformList worldMatrix = {{"u_worldMatrix", gfx::Type::MAT4, 1}};
+    gfx::UniformBlockList uniformBlockList = {{0, 0, "World_Matrix", worldMatrix, 1}, TestBaseI::getGlobalUniformBlock()};
     gfx::UniformSamplerList sampler = {{0, 1, "u_texture", gfx::Type::SAMPLER2D, 1}};
 
     gfx::ShaderInfo shaderInfo;
@@ -168,7 +175,7 @@ void StencilTest::createBuffers() {
     gfx::BufferInfo uniformBufferInfo = {
         gfx::BufferUsage::UNIFORM,
         gfx::MemoryUsage::HOST | gfx::MemoryUsage::DEVICE,
-        TestBaseI::getUBOSize(sizeof(Mat4) * 2),
+        TestBaseI::getUBOSize(sizeof(Mat4)),
     };
 
     Mat4 transform[BINDING_COUNT];
@@ -180,6 +187,7 @@ void StencilTest::createBuffers() {
         _uniformBuffer[i] = _device->createBuffer(uniformBufferInfo);
         _uniformBuffer[i]->update(&transform[i], 0, sizeof(transform[i]));
     }
+    TestBaseI::setOrthographicCamera(-1, 1, -1, 1, -1, 1);
 }
 
 void StencilTest::createTextures() {
@@ -188,7 +196,8 @@ void StencilTest::createTextures() {
     stencilImage->autorelease();
     bool ret = stencilImage->initWithImageFile("stencil.jpg");
     assert(ret);
-    auto stencilImageData = TestBaseI::RGB2RGBA(stencilImage);
+    unsigned char *stencilImageData = TestBaseI::getUploadStaging(stencilImage->getWidth() * stencilImage->getHeight() * 4u);
+    TestBaseI::RGB2RGBA(stencilImage, stencilImageData);
 
     gfx::BufferTextureCopy labelTextureRegion;
     labelTextureRegion.buffTexHeight = stencilImage->getHeight();
@@ -214,7 +223,8 @@ void StencilTest::createTextures() {
     img->autorelease();
     ret = img->initWithImageFile("uv_checker_02.jpg");
     assert(ret);
-    auto imgData = TestBaseI::RGB2RGBA(img);
+    unsigned char *imgData = TestBaseI::getUploadStaging(img->getWidth() * img->getHeight() * 4u);
+    TestBaseI::RGB2RGBA(img, imgData);
 
     gfx::TextureInfo textureInfo;
     textureInfo.usage = gfx::TextureUsage::SAMPLED | gfx::TextureUsage::TRANSFER_DST;
@@ -238,9 +248,6 @@ void StencilTest::createTextures() {
     // create sampler
     gfx::SamplerInfo samplerInfo;
     _sampler = _device->createSampler(samplerInfo);
-
-    delete[] imgData;
-    delete[] stencilImageData;
 }
 
 void StencilTest::createInputAssembler() {
@@ -257,7 +264,7 @@ void StencilTest::createPipelineState() {
     dslInfo.bindings.push_back({1, gfx::DescriptorType::SAMPLER, 1, gfx::ShaderStageFlagBit::FRAGMENT});
     _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
 
-    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout, TestBaseI::getGlobalDescriptorSetLayout()}});
 
     gfx::Texture *texView[BINDING_COUNT] = {_labelTexture, _uvCheckerTexture};
     for (uint i = 0; i < BINDING_COUNT; i++) {
@@ -381,22 +388,19 @@ void StencilTest::tick() {
     _dt += hostThread.dt;
     gfx::Color clearColor = {1.0f, 0, 0, 1.0f};
 
-    Mat4 proj;
-    TestBaseI::createOrthographic(-1, 1, -1, 1, -1, 1, &proj);
-
     _device->acquire();
 
-    for (uint i = 0; i < BINDING_COUNT; i++) {
-        _uniformBuffer[i]->update(&proj, sizeof(Mat4), sizeof(Mat4));
-    }
+    TestBaseI::updateGlobals();
 
     gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
 
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("StencilTest", _fbo, renderArea);
 
     commandBuffer->bindInputAssembler(_inputAssembler);
+    TestBaseI::bindGlobals(commandBuffer);
 
     // draw label
     Vec4 relativeViewport{1.f / 6.f, 0.5f, 1.f / 3.f, 0.5f};
@@ -0,0 +1,50 @@
+#include "StreamingBuffer.h"
+
+namespace cc {
+
+StreamingBuffer::StreamingBuffer(gfx::Device *device, gfx::BufferUsage usage, uint stride, uint frameCapacity, uint framesInFlight, Mode mode)
+: _mode(mode),
+  _stride(stride),
+  _frameCapacity(frameCapacity),
+  _regionCount(mode == Mode::RING ? std::max(framesInFlight, 1u) : 1u) {
+    _buffer = device->createBuffer({
+        usage,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        _regionCount * _frameCapacity * _stride,
+        _stride,
+    });
+    _staging = (uint8_t *)CC_MALLOC(_frameCapacity * _stride);
+    // so the first beginFrame() lands on region 0
+    _region = _regionCount - 1u;
+}
+
+StreamingBuffer::~StreamingBuffer() {
+    CC_SAFE_DESTROY(_buffer);
+    CC_SAFE_FREE(_staging);
+}
+
+void StreamingBuffer::beginFrame() {
+    _region = (_region + 1u) % _regionCount;
+    _used = 0u;
+    _uploadedBytes = 0u;
+}
+
+uint8_t *StreamingBuffer::allocate(uint count) {
+    if (_used + count > _frameCapacity) return nullptr;
+
+    uint8_t *data = _staging + _used * _stride;
+    _used += count;
+    return data;
+}
+
+void StreamingBuffer::flush() {
+    uint bytes = _used * _stride;
+    if (bytes <= _uploadedBytes) return;
+
+    // only the tail written since the last flush goes up
+    uint regionOffset = _region * _frameCapacity * _stride;
+    _buffer->update(_staging + _uploadedBytes, regionOffset + _uploadedBytes, bytes - _uploadedBytes);
+    _uploadedBytes = bytes;
+}
+
+} // namespace cc
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "TestBase.h"
+
+namespace cc {
+
+/**
+ * Per-frame streaming storage for dynamic vertex data.
+ *
+ * RING keeps one region per frame in flight inside a single GPU buffer, so the region written
+ * this frame is never one the GPU may still be reading. ORPHAN always writes region 0 and leaves
+ * it to the driver to rename the storage behind the update.
+ *
+ * gfx buffers cannot be persistently mapped, so producers write straight into a host-side staging
+ * region the size of one frame and flush() uploads exactly the bytes written into the current GPU
+ * region. Draws address the region through getFirstElement() (e.g. as a base vertex).
+ */
+class StreamingBuffer {
+public:
+    enum class Mode : uint8_t {
+        RING,
+        ORPHAN,
+    };
+
+    StreamingBuffer(gfx::Device *device, gfx::BufferUsage usage, uint stride, uint frameCapacity, uint framesInFlight, Mode mode);
+    ~StreamingBuffer();
+
+    // moves to the next region and discards anything allocated last frame
+    void beginFrame();
+    // returns write space for count elements, or nullptr if this frame's region is full
+    uint8_t *allocate(uint count);
+    void flush();
+
+    inline gfx::Buffer *getBuffer() const { return _buffer; }
+    inline Mode getMode() const { return _mode; }
+    inline uint getFrameCapacity() const { return _frameCapacity; }
+    // element index where the current frame's region starts in the GPU buffer
+    inline uint getFirstElement() const { return _region * _frameCapacity; }
+    inline uint getUsedCount() const { return _used; }
+    inline uint getUploadedBytes() const { return _uploadedBytes; }
+
+private:
+    gfx::Buffer *_buffer = nullptr;
+    uint8_t *_staging = nullptr;
+    Mode _mode = Mode::RING;
+    uint _stride = 0u;
+    uint _frameCapacity = 0u;
+    uint _regionCount = 1u;
+    uint _region = 0u;
+    uint _used = 0u;
+    uint _uploadedBytes = 0u;
+};
+
+} // namespace cc
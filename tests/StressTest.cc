@@ -1,4 +1,5 @@
 #include "StressTest.h"
+#include "RenderPassAnalyzer.h"
 
 namespace cc {
 
@@ -46,7 +47,7 @@ void StressTest::destroy() {
     _worldBuffers.clear();
 #endif
 
-    CC_SAFE_DESTROY(_uniformBufferVP);
+    CC_SAFE_DESTROY(_uniformBufferColor);
     CC_SAFE_DESTROY(_shader);
     CC_SAFE_DESTROY(_descriptorSetLayout);
     CC_SAFE_DESTROY(_pipelineLayout);
@@ -74,16 +75,19 @@ void StressTest::createShader() {
         R"(
             precision mediump float;
             layout(location = 0) in vec2 a_position;
-            layout(set = 0, binding = 0) uniform ViewProj { mat4 u_viewProj; vec4 u_color; };
             layout(set = 0, binding = 1) uniform World { vec4 u_world; };
+            layout(set = 1, binding = 0) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
 
             void main() {
-                gl_Position = u_viewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
+                gl_Position = cc_matViewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
             }
         )",
         R"(
             precision mediump float;
-            layout(set = 0, binding = 0) uniform ViewProj { mat4 u_viewProj; vec4 u_color; };
+            layout(set = 0, binding = 0) uniform Color { vec4 u_color; };
             layout(location = 0) out vec4 o_color;
 
             void main() {
@@ -96,16 +100,19 @@ void StressTest::createShader() {
         R"(
             precision mediump float;
             in vec2 a_position;
-            layout(std140) uniform ViewProj { mat4 u_viewProj; vec4 u_color; };
             layout(std140) uniform World { vec4 u_world; };
+            layout(std140) uniform CCGlobal {
+                mat4 cc_matView, cc_matProj, cc_matViewProj;
+                vec4 cc_time, cc_screenSize, cc_surfaceTransform;
+            };
 
             void main() {
-                gl_Position = u_viewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
+                gl_Position = cc_matViewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
             }
         )",
         R"(
             precision mediump float;
-            layout(std140) uniform ViewProj { mat4 u_viewProj; vec4 u_color; };
+            layout(std140) uniform Color { vec4 u_color; };
 
             out vec4 o_color;
             void main() {
@@ -118,11 +125,11 @@ void StressTest::createShader() {
         R"(
             precision mediump float;
             attribute vec2 a_position;
-            uniform mat4 u_viewProj;
+            uniform mat4 cc_matViewProj;
             uniform vec4 u_world;
 
             void main() {
-                gl_Position = u_viewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
+                gl_Position = cc_matViewProj * vec4(a_position + u_world.xy, 0.0, 1.0);
             }
         )",
         R"(
@@ -149,11 +156,9 @@ void StressTest::createShader() {
     shaderStageList.emplace_back(std::move(fragmentShaderStage));
 
     gfx::UniformBlockList uniformBlockList = {
-        {0, 0, "ViewProj", {
-            {"u_viewProj", gfx::Type::MAT4, 1},
-            {"u_color", gfx::Type::FLOAT4, 1},
-        }, 1},
+        {0, 0, "Color", {{"u_color", gfx::Type::FLOAT4, 1}}, 1},
         {0, 1, "World", {{"u_world", gfx::Type::FLOAT4, 1}}, 1},
+        TestBaseI::getGlobalUniformBlock(),
     };
     gfx::AttributeList attributeList = {{"a_position", gfx::Format::RG32F, false, 0, false, 0}};
 
@@ -229,16 +234,15 @@ void StressTest::createVertexBuffer() {
     }
 #endif
 
-    gfx::BufferInfo uniformBufferVPInfo = {
+    gfx::BufferInfo uniformBufferColorInfo = {
         gfx::BufferUsage::UNIFORM,
         gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
-        TestBaseI::getUBOSize(sizeof(Mat4) + sizeof(Vec4)),
+        TestBaseI::getUBOSize(sizeof(Vec4)),
     };
-    _uniformBufferVP = _device->createBuffer(uniformBufferVPInfo);
+    _uniformBufferColor = _device->createBuffer(uniformBufferColorInfo);
 
-    Mat4 VP;
-    TestBaseI::createOrthographic(-1, 1, -1, 1, -1, 1, &VP);
-    _uniformBufferVP->update(VP.m, 0, sizeof(Mat4));
+    // the harness rebuilds the projection every frame, which also follows screen rotation
+    TestBaseI::setOrthographicCamera(-1, 1, -1, 1, -1, 1);
 }
 
 void StressTest::createInputAssembler() {
@@ -258,18 +262,18 @@ void StressTest::createPipeline() {
         1, gfx::ShaderStageFlagBit::VERTEX});
     _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
 
-    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout, TestBaseI::getGlobalDescriptorSetLayout()}});
 
 #if USE_DYNAMIC_UNIFORM_BUFFER
     _uniDescriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
-    _uniDescriptorSet->bindBuffer(0, _uniformBufferVP);
+    _uniDescriptorSet->bindBuffer(0, _uniformBufferColor);
     _uniDescriptorSet->bindBuffer(1, _uniWorldBufferView);
     _uniDescriptorSet->update();
 #else
     _descriptorSets.resize(_worldBuffers.size());
     for (uint i = 0u; i < _worldBuffers.size(); ++i) {
         _descriptorSets[i] = _device->createDescriptorSet({_descriptorSetLayout});
-        _descriptorSets[i]->bindBuffer(0, _uniformBufferVP);
+        _descriptorSets[i]->bindBuffer(0, _uniformBufferColor);
         _descriptorSets[i]->bindBuffer(1, _worldBuffers[i]);
         _descriptorSets[i]->update();
     }
@@ -321,21 +325,18 @@ void StressTest::tick()
 
     Vec4 color{0.f, 0.f, 0.f, 1.f};
     HSV2RGB((hostThread.frameAcc * 20) % 360, .5f, 1.f, color.x, color.y, color.z);
-    _uniformBufferVP->update(&color, sizeof(Mat4), sizeof(Vec4));
-
-    /* un-toggle this to support dynamic screen rotation *
-    Mat4 VP;
-    TestBaseI::createOrthographic(-1, 1, -1, 1, -1, 1, &VP);
-    _uniformBufferVP->update(VP.m, 0, sizeof(Mat4));
-    /* */
+    _uniformBufferColor->update(&color, 0, sizeof(Vec4));
+    TestBaseI::updateGlobals();
 
     gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
 
     auto commandBuffer = _commandBuffers[0];
     commandBuffer->begin();
     commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("StressTest", _fbo, renderArea);
     commandBuffer->bindInputAssembler(_inputAssembler);
     commandBuffer->bindPipelineState(_pipelineState);
+    TestBaseI::bindGlobals(commandBuffer);
 
     /* *
     uint drawCountPerThread = MODELS_PER_LINE * MODELS_PER_LINE / taskCount;
@@ -26,7 +26,7 @@ class StressTest: public TestBaseI
 
     gfx::Shader *_shader = nullptr;
     gfx::Buffer *_vertexBuffer = nullptr;
-    gfx::Buffer *_uniformBufferVP = nullptr;
+    gfx::Buffer *_uniformBufferColor = nullptr;
 
     gfx::Buffer *_uniWorldBuffer = nullptr, *_uniWorldBufferView = nullptr;
     gfx::DescriptorSet* _uniDescriptorSet = nullptr;
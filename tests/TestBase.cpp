@@ -1,4 +1,6 @@
 #include "TestBase.h"
+#include "RenderPassAnalyzer.h"
+#include "PixelConvert.h"
 
 #include "tests/ClearScreenTest.h"
 #include "tests/BasicTriangleTest.h"
@@ -8,6 +10,13 @@
 #include "tests/BlendTest.h"
 #include "tests/ParticleTest.h"
 #include "tests/BunnyTest.h"
+#include "tests/MeshLoadTest.h"
+#include "tests/MeshletTest.h"
+#include "tests/VertexThroughputTest.h"
+#include "tests/InstancedBunnyTest.h"
+#include "tests/OcclusionTest.h"
+#include "tests/DepthPrepassTest.h"
+#include "tests/PostProcessTest.h"
 #include "tests/StressTest.h"
 
 //#define USE_GLES3
@@ -47,12 +56,29 @@ std::vector<TestBaseI::createFunc> TestBaseI::g_tests =
     BlendTest::create,
     ParticleTest::create,
     BunnyTest::create,
+    MeshLoadTest::create,
+    MeshletTest::create,
+    VertexThroughputTest::create,
+    InstancedBunnyTest::create,
+    OcclusionTest::create,
+    DepthPrepassTest::create,
+    PostProcessTest::create,
 };
 
 gfx::Device *TestBaseI::_device         = nullptr;
 gfx::Framebuffer *TestBaseI::_fbo       = nullptr;
 gfx::RenderPass *TestBaseI::_renderPass = nullptr;
+Framebuffer *TestBaseI::_multisampleFBOs[MSAA_VARIANT_COUNT] = {};
 std::vector<gfx::CommandBuffer *> TestBaseI::_commandBuffers;
+std::vector<unsigned char> TestBaseI::_uploadStaging;
+
+gfx::Buffer *TestBaseI::_globalBuffer                           = nullptr;
+gfx::DescriptorSetLayout *TestBaseI::_globalDescriptorSetLayout = nullptr;
+gfx::DescriptorSet *TestBaseI::_globalDescriptorSet             = nullptr;
+GlobalUniforms TestBaseI::_globals;
+GlobalCamera TestBaseI::_globalCamera;
+
+RenderPassAnalyzer *TestBaseI::_renderPassAnalyzer = nullptr;
 
 FrameRate TestBaseI::hostThread;
 FrameRate TestBaseI::deviceThread;
@@ -83,10 +109,11 @@ TestBaseI::TestBaseI(const WindowInfo &info)
 
         gfx::DepthStencilAttachment &depthStencilAttachment = renderPassInfo.depthStencilAttachment;
         depthStencilAttachment.format = _device->getDepthStencilFormat();
+        // no test reads the depth back, storing it only writes the tile out to memory
         depthStencilAttachment.depthLoadOp = gfx::LoadOp::CLEAR;
-        depthStencilAttachment.depthStoreOp = gfx::StoreOp::STORE;
+        depthStencilAttachment.depthStoreOp = gfx::StoreOp::DISCARD;
         depthStencilAttachment.stencilLoadOp = gfx::LoadOp::CLEAR;
-        depthStencilAttachment.stencilStoreOp = gfx::StoreOp::STORE;
+        depthStencilAttachment.stencilStoreOp = gfx::StoreOp::DISCARD;
         depthStencilAttachment.sampleCount = 1;
         depthStencilAttachment.beginLayout = gfx::TextureLayout::UNDEFINED;
         depthStencilAttachment.endLayout = gfx::TextureLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
@@ -98,10 +125,31 @@ TestBaseI::TestBaseI(const WindowInfo &info)
         _fbo = _device->createFramebuffer(fboInfo);
     }
 
+    if (_renderPassAnalyzer == nullptr) {
+        _renderPassAnalyzer = CC_NEW(RenderPassAnalyzer);
+    }
+
     if (!_commandBuffers.size()) {
         _commandBuffers.push_back(_device->getCommandBuffer());
     }
 
+    if (_globalBuffer == nullptr) {
+        _globalBuffer = _device->createBuffer({
+            gfx::BufferUsage::UNIFORM,
+            gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+            getUBOSize(sizeof(GlobalUniforms)),
+        });
+
+        gfx::DescriptorSetLayoutInfo dslInfo;
+        dslInfo.bindings.push_back({0, gfx::DescriptorType::UNIFORM_BUFFER, 1,
+            gfx::ShaderStageFlagBit::VERTEX | gfx::ShaderStageFlagBit::FRAGMENT});
+        _globalDescriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+        _globalDescriptorSet = _device->createDescriptorSet({_globalDescriptorSetLayout});
+        _globalDescriptorSet->bindBuffer(0, _globalBuffer);
+        _globalDescriptorSet->update();
+    }
+
     hostThread.prevTime = std::chrono::steady_clock::now();
     deviceThread.prevTime = std::chrono::steady_clock::now();
 }
@@ -109,6 +157,12 @@ TestBaseI::TestBaseI(const WindowInfo &info)
 void TestBaseI::destroyGlobal()
 {
     CC_SAFE_DESTROY(g_test);
+    for (Framebuffer *&framebuffer : _multisampleFBOs) CC_SAFE_DELETE(framebuffer);
+    CC_SAFE_DELETE(_renderPassAnalyzer);
+    std::vector<unsigned char>().swap(_uploadStaging);
+    CC_SAFE_DESTROY(_globalDescriptorSet);
+    CC_SAFE_DESTROY(_globalDescriptorSetLayout);
+    CC_SAFE_DESTROY(_globalBuffer);
     CC_SAFE_DESTROY(_fbo);
     CC_SAFE_DESTROY(_renderPass);
     CC_SAFE_DESTROY(_device);
@@ -118,10 +172,32 @@ void TestBaseI::nextTest(const WindowInfo& windowInfo)
 {
     g_nextTestIndex = g_nextTestIndex % g_tests.size();
     CC_SAFE_DESTROY(g_test);
+    for (Framebuffer *&framebuffer : _multisampleFBOs) CC_SAFE_DELETE(framebuffer);
+    std::vector<unsigned char>().swap(_uploadStaging);
+    _globals = GlobalUniforms();
+    _globalCamera = GlobalCamera();
+    if (_renderPassAnalyzer) _renderPassAnalyzer->reset();
     g_test = g_tests[g_nextTestIndex](windowInfo);
     g_nextTestIndex++;
 }
 
+void TestBaseI::resize(uint width, uint height) {
+    _device->resize(width, height);
+
+    for (Framebuffer *framebuffer : _multisampleFBOs) {
+        if (!framebuffer || !framebuffer->framebuffer) continue;
+        framebuffer->colorTex->resize(width, height);
+        framebuffer->depthStencilTex->resize(width, height);
+
+        gfx::FramebufferInfo fboInfo;
+        fboInfo.renderPass = framebuffer->renderPass;
+        fboInfo.colorTextures = {framebuffer->colorTex, nullptr};
+        fboInfo.depthStencilTexture = framebuffer->depthStencilTex;
+        framebuffer->framebuffer->destroy();
+        framebuffer->framebuffer->initialize(fboInfo);
+    }
+}
+
 void TestBaseI::toggleMultithread()
 {
     static bool multithreaded = true;
@@ -140,23 +216,150 @@ void TestBaseI::onTick()
     if (g_test)
     {
         g_test->tick();
+        _renderPassAnalyzer->endFrame();
+    }
+}
+
+namespace {
+uint getMultisampleVariant(gfx::SampleCount samples) {
+    for (uint i = 0u; i < MSAA_VARIANT_COUNT; ++i) {
+        if (MSAA_SAMPLE_COUNTS[i] == samples) return i;
     }
+    CCASSERT(false, "no swapchain framebuffer for this sample count");
+    return 0u;
+}
+} // namespace
+
+bool TestBaseI::isMultisampleSupported(gfx::SampleCount samples) {
+    if (samples == gfx::SampleCount::X1) return true;
+    switch (_device->getGfxAPI()) {
+        case gfx::API::GLES2:
+            return false;
+        case gfx::API::GLES3:
+            // GL_MAX_SAMPLES is at least 4
+            return samples == gfx::SampleCount::X2 || samples == gfx::SampleCount::X4;
+        default:
+            return samples == gfx::SampleCount::X4;
+    }
+}
+
+uint TestBaseI::getNextMultisampleVariant(uint variant) {
+    do {
+        variant = (variant + 1u) % MSAA_VARIANT_COUNT;
+    } while (!isMultisampleSupported(MSAA_SAMPLE_COUNTS[variant]));
+    return variant;
+}
+
+gfx::RenderPass *TestBaseI::getRenderPass(gfx::SampleCount samples) {
+    CCASSERT(isMultisampleSupported(samples), "sample count not supported by this backend");
+    uint variant = getMultisampleVariant(samples);
+    if (!variant) return _renderPass;
+
+    Framebuffer *&framebuffer = _multisampleFBOs[variant];
+    if (!framebuffer) framebuffer = CC_NEW(Framebuffer);
+    if (framebuffer->renderPass) return framebuffer->renderPass;
+
+    gfx::RenderPassInfo renderPassInfo;
+    gfx::ColorAttachment colorAttachment;
+    colorAttachment.format = _device->getColorFormat();
+    colorAttachment.sampleCount = static_cast<uint>(samples);
+    colorAttachment.loadOp = gfx::LoadOp::CLEAR;
+    colorAttachment.storeOp = gfx::StoreOp::DISCARD;
+    colorAttachment.beginLayout = gfx::TextureLayout::UNDEFINED;
+    colorAttachment.endLayout = gfx::TextureLayout::COLOR_ATTACHMENT_OPTIMAL;
+    renderPassInfo.colorAttachments.emplace_back(colorAttachment);
+
+    // the swapchain image, written by the resolve alone
+    gfx::ColorAttachment resolveAttachment;
+    resolveAttachment.format = _device->getColorFormat();
+    resolveAttachment.sampleCount = 1;
+    resolveAttachment.loadOp = gfx::LoadOp::DISCARD;
+    resolveAttachment.storeOp = gfx::StoreOp::STORE;
+    resolveAttachment.beginLayout = gfx::TextureLayout::UNDEFINED;
+    resolveAttachment.endLayout = gfx::TextureLayout::PRESENT_SRC;
+    renderPassInfo.colorAttachments.emplace_back(resolveAttachment);
+
+    gfx::DepthStencilAttachment &depthStencilAttachment = renderPassInfo.depthStencilAttachment;
+    depthStencilAttachment.format = _device->getDepthStencilFormat();
+    depthStencilAttachment.sampleCount = static_cast<uint>(samples);
+    depthStencilAttachment.depthLoadOp = gfx::LoadOp::CLEAR;
+    depthStencilAttachment.depthStoreOp = gfx::StoreOp::DISCARD;
+    depthStencilAttachment.stencilLoadOp = gfx::LoadOp::CLEAR;
+    depthStencilAttachment.stencilStoreOp = gfx::StoreOp::DISCARD;
+    depthStencilAttachment.beginLayout = gfx::TextureLayout::UNDEFINED;
+    depthStencilAttachment.endLayout = gfx::TextureLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    gfx::SubPassInfo subPass;
+    subPass.colors.push_back(0);
+    subPass.resolves.push_back(1);
+    subPass.depthStencil = 2;
+    renderPassInfo.subPasses.emplace_back(subPass);
+
+    framebuffer->renderPass = _device->createRenderPass(renderPassInfo);
+    return framebuffer->renderPass;
 }
 
-unsigned char *TestBaseI::RGB2RGBA(Image *img) {
-    int size = img->getWidth() * img->getHeight();
-    const unsigned char *srcData = img->getData();
-    unsigned char *dstData = new unsigned char[size * 4];
-    for (int i = 0; i < size; i++) {
-        dstData[i * 4] = srcData[i * 3];
-        dstData[i * 4 + 1] = srcData[i * 3 + 1];
-        dstData[i * 4 + 2] = srcData[i * 3 + 2];
-        dstData[i * 4 + 3] = 255u;
+gfx::Framebuffer *TestBaseI::getFramebuffer(gfx::SampleCount samples) {
+    uint variant = getMultisampleVariant(samples);
+    // one variant holds multisampled memory at a time
+    for (uint i = 1u; i < MSAA_VARIANT_COUNT; ++i) {
+        Framebuffer *framebuffer = _multisampleFBOs[i];
+        if (i == variant || !framebuffer) continue;
+        CC_SAFE_DESTROY(framebuffer->framebuffer);
+        CC_SAFE_DESTROY(framebuffer->depthStencilTex);
+        CC_SAFE_DESTROY(framebuffer->colorTex);
     }
-    return dstData;
+    if (!variant) return _fbo;
+
+    gfx::RenderPass *renderPass = getRenderPass(samples);
+    Framebuffer *framebuffer = _multisampleFBOs[variant];
+    if (framebuffer->framebuffer) return framebuffer->framebuffer;
+
+    // transient: on tilers the samples can live in tile memory and never reach DRAM
+    gfx::TextureInfo textureInfo;
+    textureInfo.type = gfx::TextureType::TEX2D;
+    textureInfo.usage = gfx::TextureUsageBit::COLOR_ATTACHMENT | gfx::TextureUsageBit::TRANSIENT_ATTACHMENT;
+    textureInfo.format = _device->getColorFormat();
+    textureInfo.width = _device->getWidth();
+    textureInfo.height = _device->getHeight();
+    textureInfo.samples = samples;
+    framebuffer->colorTex = _device->createTexture(textureInfo);
+
+    textureInfo.usage = gfx::TextureUsageBit::DEPTH_STENCIL_ATTACHMENT | gfx::TextureUsageBit::TRANSIENT_ATTACHMENT;
+    textureInfo.format = _device->getDepthStencilFormat();
+    framebuffer->depthStencilTex = _device->createTexture(textureInfo);
+
+    gfx::FramebufferInfo fboInfo;
+    fboInfo.renderPass = renderPass;
+    fboInfo.colorTextures = {framebuffer->colorTex, nullptr};
+    fboInfo.depthStencilTexture = framebuffer->depthStencilTex;
+    framebuffer->framebuffer = _device->createFramebuffer(fboInfo);
+    return framebuffer->framebuffer;
 }
 
-void TestBaseI::modifyProjectionBasedOnDevice(Mat4 &projection, bool isOffscreen) {
+void TestBaseI::getMultisampleCost(gfx::SampleCount samples, uint &attachmentBytes, uint &resolveBytes) {
+    uint count = static_cast<uint>(samples);
+    uint colorBytes = gfx::FormatSize(_device->getColorFormat(), _device->getWidth(), _device->getHeight(), 1u);
+    uint depthBytes = gfx::FormatSize(_device->getDepthStencilFormat(), _device->getWidth(), _device->getHeight(), 1u);
+    attachmentBytes = count > 1u ? (colorBytes + depthBytes) * count : 0u;
+    // every sample read once and the resolved pixel written; an upper bound on tilers, where the reads stay on chip
+    resolveBytes = count > 1u ? colorBytes * (count + 1u) : 0u;
+}
+
+void TestBaseI::RGB2RGBA(Image *img, unsigned char *dst) {
+    expandRGB8ToRGBA8(img->getData(), dst, img->getWidth() * img->getHeight());
+}
+
+unsigned char *TestBaseI::getUploadStaging(uint size) {
+    if (_uploadStaging.size() < size) {
+        // nothing in it is worth copying over
+        _uploadStaging.clear();
+        _uploadStaging.resize(size);
+    }
+    return _uploadStaging.data();
+}
+
+void TestBaseI::modifyProjectionBasedOnDevice(Mat4 &projection, bool isOffscreen, bool reversedZ) {
     float minZ = _device->getClipSpaceMinZ();
     float signY = _device->getScreenSpaceSignY() * (isOffscreen ? _device->getUVSpaceSignY() : 1);
     float orientation = (float)_device->getSurfaceTransform();
@@ -166,6 +369,14 @@ void TestBaseI::modifyProjectionBasedOnDevice(Mat4 &projection, bool isOffscreen
     Mat4::createScale(1.0f, signY, 0.5f - 0.5f * minZ, &scale);
     Mat4::createRotationZ(orientation * MATH_PIOVER2, &rot);
     projection = rot * scale * trans * projection;
+
+    if (reversedZ) {
+        // z' = (1 + minZ) * w - z flips [minZ, 1]; depth never mixes with x and y so it commutes with rot
+        Mat4 reverse;
+        reverse.m[10] = -1.0f;
+        reverse.m[14] = 1.0f + minZ;
+        projection = reverse * projection;
+    }
 }
 
 #ifndef DEFAULT_MATRIX_MATH
@@ -206,10 +417,17 @@ void TestBaseI::createOrthographic(float left, float right, float bottom, float
 #endif
 }
 
-void TestBaseI::createPerspective(float fov, float aspect, float zNear, float ZFar, Mat4 *dst, bool isOffscreen) {
+void TestBaseI::createPerspective(float fov, float aspect, float zNear, float ZFar, Mat4 *dst, bool isOffscreen, bool reversedZ) {
 #ifdef DEFAULT_MATRIX_MATH
-    Mat4::createPerspective(MATH_DEG_TO_RAD(fov), aspect, zNear, ZFar, dst);
-    TestBaseI::modifyProjectionBasedOnDevice(*dst, isOffscreen);
+    if (std::isinf(ZFar)) {
+        // the limit of the GL matrix as far goes to infinity, x and y don't depend on it
+        Mat4::createPerspective(MATH_DEG_TO_RAD(fov), aspect, zNear, zNear * 2.0f, dst);
+        dst->m[10] = -1.0f;
+        dst->m[14] = -2.0f * zNear;
+    } else {
+        Mat4::createPerspective(MATH_DEG_TO_RAD(fov), aspect, zNear, ZFar, dst);
+    }
+    TestBaseI::modifyProjectionBasedOnDevice(*dst, isOffscreen, reversedZ);
 #else
     float minZ = _device->getClipSpaceMinZ();
     float signY = _device->getScreenSpaceSignY() * (isOffscreen ? _device->getUVSpaceSignY() : 1);
@@ -228,9 +446,13 @@ void TestBaseI::createPerspective(float fov, float aspect, float zNear, float ZF
     dst->m[1] = x * preTransform[1];
     dst->m[4] = y * preTransform[2];
     dst->m[5] = y * preTransform[3];
-    dst->m[10] = (ZFar - minZ * zNear) * nf;
+    dst->m[10] = std::isinf(ZFar) ? -1.0f : (ZFar - minZ * zNear) * nf;
     dst->m[11] = -1.0f;
-    dst->m[14] = ZFar * zNear * nf * (1.0f - minZ);
+    dst->m[14] = std::isinf(ZFar) ? -zNear * (1.0f - minZ) : ZFar * zNear * nf * (1.0f - minZ);
+    if (reversedZ) {
+        dst->m[10] = -(1.0f + minZ) - dst->m[10];
+        dst->m[14] = -dst->m[14];
+    }
 #endif
 }
 
@@ -312,4 +534,60 @@ uint TestBaseI::getAlignedUBOStride(gfx::Device *device, uint stride) {
     return (stride + alignment - 1) / alignment * alignment;
 }
 
+void TestBaseI::setPerspectiveCamera(float fov, float zNear, float zFar, bool reversedZ) {
+    _globalCamera.orthographic = false;
+    _globalCamera.fov = fov;
+    _globalCamera.zNear = zNear;
+    _globalCamera.zFar = zFar;
+    _globalCamera.reversedZ = reversedZ;
+}
+
+void TestBaseI::setOrthographicCamera(float left, float right, float bottom, float top, float zNear, float zFar) {
+    _globalCamera.orthographic = true;
+    _globalCamera.reversedZ = false;
+    _globalCamera.left = left;
+    _globalCamera.right = right;
+    _globalCamera.bottom = bottom;
+    _globalCamera.top = top;
+    _globalCamera.zNear = zNear;
+    _globalCamera.zFar = zFar;
+}
+
+void TestBaseI::updateGlobals(const Mat4 &view) {
+    gfx::Extent size = getOrientedSurfaceSize();
+    const GlobalCamera &camera = _globalCamera;
+    if (camera.orthographic) {
+        createOrthographic(camera.left, camera.right, camera.bottom, camera.top, camera.zNear, camera.zFar, &_globals.projection);
+    } else {
+        createPerspective(camera.fov, 1.0f * size.width / size.height, camera.zNear, camera.zFar, &_globals.projection, false, camera.reversedZ);
+    }
+    _globals.view = view;
+    Mat4::multiply(_globals.projection, view, &_globals.viewProjection);
+
+    _globals.time.x += hostThread.dt;
+    _globals.time.y = hostThread.dt;
+    _globals.time.z += 1.0f;
+    _globals.screenSize.set(float(size.width), float(size.height), 1.0f / size.width, 1.0f / size.height);
+    _globals.surfaceTransform.set(float(_device->getSurfaceTransform()), _device->getClipSpaceMinZ(),
+                                  _device->getScreenSpaceSignY(), _device->getUVSpaceSignY());
+
+    _globalBuffer->update(&_globals, 0, sizeof(GlobalUniforms));
+}
+
+void TestBaseI::bindGlobals(gfx::CommandBuffer *commandBuffer) {
+    commandBuffer->bindDescriptorSet(GLOBAL_SET, _globalDescriptorSet);
+}
+
+const gfx::UniformBlock &TestBaseI::getGlobalUniformBlock() {
+    static const gfx::UniformBlock block = {GLOBAL_SET, 0, "CCGlobal", {
+        {"cc_matView", gfx::Type::MAT4, 1},
+        {"cc_matProj", gfx::Type::MAT4, 1},
+        {"cc_matViewProj", gfx::Type::MAT4, 1},
+        {"cc_time", gfx::Type::FLOAT4, 1},
+        {"cc_screenSize", gfx::Type::FLOAT4, 1},
+        {"cc_surfaceTransform", gfx::Type::FLOAT4, 1},
+    }, 1};
+    return block;
+}
+
 } // namespace cc
@@ -1,10 +1,15 @@
 #pragma once
 #include "Core.h"
 #include "cocos2d.h"
+#include <random>
 
 #define NANOSECONDS_PER_SECOND 1000000000
 #define NANOSECONDS_60FPS      16666667L
 
+// 1 takes exactly one fixed step per frame, so benchmarks replay the same workload every run
+#define DETERMINISTIC_SIMULATION 0
+#define SIMULATION_SEED          20200821u
+
 namespace cc {
     typedef struct WindowInfo {
         intptr_t windowHandle;
@@ -13,6 +18,8 @@ namespace cc {
         int physicalHeight;
     } WindowInfo;
 
+    class RenderPassAnalyzer;
+
     struct Framebuffer {
         gfx::RenderPass *renderPass = nullptr;
         gfx::Texture *colorTex = nullptr;
@@ -46,6 +53,101 @@ namespace cc {
         float timeAcc = 0.f;
     };
 
+    // Simulation clock decoupled from the frame rate: advance() returns how many fixed steps
+    // to run this frame, alpha is how far rendering sits between the last two steps.
+    struct FixedStep {
+        float step = 1.0f / 60.0f;
+        uint maxSteps = 4u; // drops time after a hitch instead of spiralling
+        bool deterministic = DETERMINISTIC_SIMULATION;
+
+        float acc = 0.f;
+        float alpha = 1.f;
+
+        uint advance(float dt) {
+            if (deterministic) return 1u;
+
+            acc += dt;
+            uint steps = static_cast<uint>(acc / step);
+            if (steps > maxSteps) {
+                steps = maxSteps;
+                acc = step * steps;
+            }
+            acc -= step * steps;
+            alpha = acc / step;
+            return steps;
+        }
+    };
+
+    // cc::random shares one engine that can't be reseeded, simulations own one of these instead
+    struct SeededRandom {
+        explicit SeededRandom(uint seed = SIMULATION_SEED) : engine(seed) {}
+
+        void seed(uint seed) { engine.seed(seed); }
+        float range(float min, float max) { return std::uniform_real_distribution<float>(min, max)(engine); }
+        int range(int min, int max) { return std::uniform_int_distribution<int>(min, max)(engine); }
+        float rand_0_1() { return range(0.0f, 1.0f); }
+
+        std::mt19937 engine;
+    };
+
+    // Gribb-Hartmann: planes are sums and differences of the view projection rows, normalized, inside when dot >= 0
+    struct Frustum {
+        Vec4 planes[6];
+
+        void update(const Mat4 &viewProjection) {
+            const float *m = viewProjection.m;
+            for (uint i = 0u; i < 3u; ++i) {
+                planes[i * 2] = Vec4(m[3] + m[i], m[7] + m[4 + i], m[11] + m[8 + i], m[15] + m[12 + i]);
+                planes[i * 2 + 1] = Vec4(m[3] - m[i], m[7] - m[4 + i], m[11] - m[8 + i], m[15] - m[12 + i]);
+            }
+            for (Vec4 &plane : planes) {
+                float invLength = 1.0f / std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+                plane.x *= invLength;
+                plane.y *= invLength;
+                plane.z *= invLength;
+                plane.w *= invLength;
+            }
+        }
+
+        bool intersectsSphere(const Vec3 &center, float radius) const {
+            for (const Vec4 &plane : planes) {
+                if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+            }
+            return true;
+        }
+    };
+
+// descriptor set reserved for the harness globals, tests keep their own bindings in set 0
+#define GLOBAL_SET 1u
+
+    // per frame constants shared by every test, std140 layout of the CCGlobal block at GLOBAL_SET binding 0
+    struct GlobalUniforms {
+        Mat4 view;
+        Mat4 projection;
+        Mat4 viewProjection;
+        Vec4 time;             // seconds since the test started, frame delta, frame index
+        Vec4 screenSize;       // oriented surface width and height, then their reciprocals
+        Vec4 surfaceTransform; // quarter turns of the surface, clip space min z, screen space and uv space sign y
+    };
+
+    // the projection is rebuilt from this every frame, so resizes and rotation need nothing from the test
+    struct GlobalCamera {
+        bool orthographic = false;
+        float fov = 60.0f;
+        float left = -1.0f;
+        float right = 1.0f;
+        float bottom = -1.0f;
+        float top = 1.0f;
+        float zNear = 0.01f;
+        float zFar = 1000.0f;
+        bool reversedZ = false;
+    };
+
+    // the sample counts TestBaseI has swapchain framebuffers for, see TestBaseI::getFramebuffer; gfx can't
+    // report the device limit, so 8x, guaranteed by no backend, is left out
+    const gfx::SampleCount MSAA_SAMPLE_COUNTS[] = {gfx::SampleCount::X1, gfx::SampleCount::X2, gfx::SampleCount::X4};
+#define MSAA_VARIANT_COUNT 3u
+
 #define DEFINE_CREATE_METHOD(className)                \
     static TestBaseI *create(const WindowInfo &info) { \
         TestBaseI *test = CC_NEW(className(info));     \
@@ -65,13 +167,20 @@ namespace cc {
         virtual bool initialize() { return true; }
         virtual void tick() {}
         virtual void destroy() {}
-        virtual void resize(uint width, uint height) { _device->resize(width, height); }
+        virtual void resize(uint width, uint height);
 
         static void lookupTime(FrameRate &statistics = hostThread) {
             statistics.curTime = std::chrono::steady_clock::now();
             statistics.dt = float(std::chrono::duration_cast<std::chrono::nanoseconds>(statistics.curTime - statistics.prevTime).count()) / NANOSECONDS_PER_SECOND;
             statistics.prevTime = statistics.curTime;
         }
+        // on the clock lookupTime reads, for timing stretches of a frame
+        static float millisecondsSince(const std::chrono::steady_clock::time_point &start) {
+            return float(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) / 1000000.f;
+        }
+        static float secondsSince(const std::chrono::steady_clock::time_point &start) {
+            return float(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) / NANOSECONDS_PER_SECOND;
+        }
         static gfx::Device *getDevice() { return _device; }
         static void destroyGlobal();
 
@@ -79,10 +188,16 @@ namespace cc {
         static void toggleMultithread();
         static void onTouchEnd(const WindowInfo& windowInfo);
         static void onTick();
-        static unsigned char *RGB2RGBA(Image *img);
-        static void modifyProjectionBasedOnDevice(Mat4 &projection, bool isOffscreen = false);
+        // expands the RGB8 image into dst, which holds width * height * 4 bytes
+        static void RGB2RGBA(Image *img, unsigned char *dst);
+        // host memory for texture uploads, kept until the test changes; copyBuffersToTexture is done
+        // with its data when it returns, so every upload can reuse it
+        static unsigned char *getUploadStaging(uint size);
+        // reversedZ maps near to depth 1 and far to the clip space min z, to be drawn with GREATER and cleared to 0
+        static void modifyProjectionBasedOnDevice(Mat4 &projection, bool isOffscreen = false, bool reversedZ = false);
         static void createOrthographic(float left, float right, float bottom, float top, float near, float ZFar, Mat4 *dst, bool isOffscreen = false);
-        static void createPerspective(float fov, float aspect, float near, float ZFar, Mat4 *dst, bool isOffscreen = false);
+        // ZFar may be infinity; with reversedZ that puts window depth at near / distance on every backend
+        static void createPerspective(float fov, float aspect, float near, float ZFar, Mat4 *dst, bool isOffscreen = false, bool reversedZ = false);
         static gfx::Extent getOrientedSurfaceSize();
         static gfx::Viewport getViewportBasedOnDevice(const Vec4 &relativeArea);
         static uint getUBOSize(uint size);
@@ -90,6 +205,33 @@ namespace cc {
         static ShaderSource &getAppropriateShaderSource(ShaderSources &sources);
         static uint getAlignedUBOStride(gfx::Device *device, uint stride);
 
+        // variants of _renderPass that draw into multisampled color and depth and resolve the color
+        // into the swapchain; the samples are never stored. X1 is _renderPass itself
+        static gfx::RenderPass *getRenderPass(gfx::SampleCount samples);
+        // allocates the attachments of this variant and frees those of the others, beginRenderPass
+        // needs a clear color for the resolve attachment too
+        static gfx::Framebuffer *getFramebuffer(gfx::SampleCount samples);
+        // memory of the multisampled attachments, and the bytes a resolve reads and writes per frame
+        static void getMultisampleCost(gfx::SampleCount samples, uint &attachmentBytes, uint &resolveBytes);
+        // whether the backend guarantees color and depth attachments with this many samples: none past
+        // X1 on GLES2, up to X4 on GLES3, and X4 on Vulkan and Metal, where X2 is optional
+        static bool isMultisampleSupported(gfx::SampleCount samples);
+        // the next index into MSAA_SAMPLE_COUNTS the device supports, wrapping around to X1
+        static uint getNextMultisampleVariant(uint variant);
+
+        // the camera is reset to a 60 degree perspective whenever the test changes
+        static void setPerspectiveCamera(float fov, float zNear, float zFar, bool reversedZ = false);
+        static void setOrthographicCamera(float left, float right, float bottom, float top, float zNear, float zFar);
+        // fills the globals and uploads them in one update, once per frame after lookupTime
+        static void updateGlobals(const Mat4 &view = Mat4::IDENTITY);
+        static void bindGlobals(gfx::CommandBuffer *commandBuffer);
+        static const GlobalUniforms &getGlobals() { return _globals; }
+        static gfx::DescriptorSetLayout *getGlobalDescriptorSetLayout() { return _globalDescriptorSetLayout; }
+        // to append to ShaderInfo::blocks of shaders that declare CCGlobal
+        static const gfx::UniformBlock &getGlobalUniformBlock();
+        // record every render pass right after beginning it, the frame is analyzed after tick
+        static RenderPassAnalyzer *getRenderPassAnalyzer() { return _renderPassAnalyzer; }
+
         // FPS calculation
         static FrameRate hostThread;
         static FrameRate deviceThread;
@@ -101,8 +243,18 @@ namespace cc {
         static gfx::Device *_device;
         static gfx::Framebuffer* _fbo;
         static std::vector<gfx::CommandBuffer *> _commandBuffers;
+        static std::vector<unsigned char> _uploadStaging;
 
         static gfx::RenderPass *_renderPass;
+        static Framebuffer *_multisampleFBOs[MSAA_VARIANT_COUNT]; // the first stays empty, X1 is _fbo
+
+        static gfx::Buffer *_globalBuffer;
+        static gfx::DescriptorSetLayout *_globalDescriptorSetLayout;
+        static gfx::DescriptorSet *_globalDescriptorSet;
+        static GlobalUniforms _globals;
+        static GlobalCamera _globalCamera;
+
+        static RenderPassAnalyzer *_renderPassAnalyzer;
     };
 
 } // namespace cc
@@ -0,0 +1,395 @@
+#include "VertexThroughputTest.h"
+#include "RenderPassAnalyzer.h"
+
+// the sweep goes up by 10x from SWEEP_MIN_TRIANGLES for every shape and vertex format
+#define SWEEP_MIN_TRIANGLES 10000u
+#define SWEEP_MAX_TRIANGLES 1000000u
+#define FRAMES_PER_CONFIG   120u
+// frames after a switch left out of the average, they pay for the upload
+#define WARMUP_FRAMES       10u
+// copies drawn per frame, each small on screen so the sweep measures vertices rather than fill
+#define DRAWS_PER_FRAME     4u
+
+namespace cc {
+
+namespace {
+const uint SHAPE_COUNT = static_cast<uint>(GeometryShape::COUNT);
+const uint FORMAT_COUNT = static_cast<uint>(VertexFormat::COUNT);
+} // namespace
+
+void VertexThroughputTest::destroy() {
+    destroyGeometry();
+    for (gfx::PipelineState *&pipelineState : _pipelineStates) CC_SAFE_DESTROY(pipelineState);
+    for (gfx::Shader *&shader : _shaders) CC_SAFE_DESTROY(shader);
+    CC_SAFE_DESTROY(_descriptorSet);
+    CC_SAFE_DESTROY(_uniformBufferView);
+    CC_SAFE_DESTROY(_uniformBuffer);
+    CC_SAFE_DESTROY(_descriptorSetLayout);
+    CC_SAFE_DESTROY(_pipelineLayout);
+}
+
+bool VertexThroughputTest::initialize() {
+    for (uint triangles = SWEEP_MIN_TRIANGLES; triangles <= SWEEP_MAX_TRIANGLES; triangles *= 10u) {
+        _triangleCounts.push_back(triangles);
+    }
+
+    createShaders();
+    createPipelines();
+    loadConfig(0u);
+    return true;
+}
+
+void VertexThroughputTest::createShaders() {
+
+    ShaderSources positionSources;
+    positionSources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+            layout(set = 0, binding = 0) uniform MVP { mat4 u_mvp, u_model; };
+            layout(location = 0) out vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.5 + 0.5;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_color;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    positionSources.glsl3 = {
+        R"(
+            in vec3 a_position;
+            layout(std140) uniform MVP { mat4 u_mvp, u_model; };
+            out vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.5 + 0.5;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_color;
+            out vec4 o_color;
+            void main () {
+                o_color = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    positionSources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            uniform mat4 u_mvp, u_model;
+            varying vec3 v_color;
+
+            void main () {
+                v_color = a_position * 0.5 + 0.5;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_color;
+
+            void main () {
+                gl_FragColor = vec4(v_color, 1);
+            }
+        )",
+    };
+
+    ShaderSources fullSources;
+    fullSources.glsl4 = {
+        R"(
+            layout(location = 0) in vec3 a_position;
+            layout(location = 1) in vec3 a_normal;
+            layout(location = 2) in vec2 a_texCoord;
+            layout(set = 0, binding = 0) uniform MVP { mat4 u_mvp, u_model; };
+            layout(location = 0) out vec3 v_normal;
+            layout(location = 1) out vec2 v_texCoord;
+
+            void main () {
+                v_normal = (u_model * vec4(a_normal, 0)).xyz;
+                v_texCoord = a_texCoord;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            layout(location = 0) in vec3 v_normal;
+            layout(location = 1) in vec2 v_texCoord;
+            layout(location = 0) out vec4 o_color;
+            void main () {
+                vec2 cell = floor(v_texCoord * 16.0);
+                float checker = mod(cell.x + cell.y, 2.0) * 0.3 + 0.7;
+                float diffuse = max(dot(normalize(v_normal), normalize(vec3(0.4, 1.0, 0.6))), 0.0) * 0.8 + 0.2;
+                o_color = vec4(vec3(checker * diffuse), 1);
+            }
+        )",
+    };
+
+    fullSources.glsl3 = {
+        R"(
+            in vec3 a_position;
+            in vec3 a_normal;
+            in vec2 a_texCoord;
+            layout(std140) uniform MVP { mat4 u_mvp, u_model; };
+            out vec3 v_normal;
+            out vec2 v_texCoord;
+
+            void main () {
+                v_normal = (u_model * vec4(a_normal, 0)).xyz;
+                v_texCoord = a_texCoord;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            in vec3 v_normal;
+            in vec2 v_texCoord;
+            out vec4 o_color;
+            void main () {
+                vec2 cell = floor(v_texCoord * 16.0);
+                float checker = mod(cell.x + cell.y, 2.0) * 0.3 + 0.7;
+                float diffuse = max(dot(normalize(v_normal), normalize(vec3(0.4, 1.0, 0.6))), 0.0) * 0.8 + 0.2;
+                o_color = vec4(vec3(checker * diffuse), 1);
+            }
+        )",
+    };
+
+    fullSources.glsl1 = {
+        R"(
+            attribute vec3 a_position;
+            attribute vec3 a_normal;
+            attribute vec2 a_texCoord;
+            uniform mat4 u_mvp, u_model;
+            varying vec3 v_normal;
+            varying vec2 v_texCoord;
+
+            void main () {
+                v_normal = (u_model * vec4(a_normal, 0)).xyz;
+                v_texCoord = a_texCoord;
+                gl_Position = u_mvp * vec4(a_position, 1);
+            }
+        )",
+        R"(
+            precision mediump float;
+            varying vec3 v_normal;
+            varying vec2 v_texCoord;
+
+            void main () {
+                vec2 cell = floor(v_texCoord * 16.0);
+                float checker = mod(cell.x + cell.y, 2.0) * 0.3 + 0.7;
+                float diffuse = max(dot(normalize(v_normal), normalize(vec3(0.4, 1.0, 0.6))), 0.0) * 0.8 + 0.2;
+                gl_FragColor = vec4(vec3(checker * diffuse), 1);
+            }
+        )",
+    };
+
+    gfx::UniformBlockList uniformBlockList = {
+        {0, 0, "MVP", {{"u_mvp", gfx::Type::MAT4, 1}, {"u_model", gfx::Type::MAT4, 1}}, 1},
+    };
+    gfx::AttributeList attributeLists[2] = {
+        {{"a_position", gfx::Format::RGB32F, false, 0, false, 0}},
+        {
+            {"a_position", gfx::Format::RGB32F, false, 0, false, 0},
+            {"a_normal", gfx::Format::RGB32F, false, 0, false, 1},
+            {"a_texCoord", gfx::Format::RG32F, false, 0, false, 2},
+        },
+    };
+    ShaderSources *sources[2] = {&positionSources, &fullSources};
+    const char *names[2] = {"Vertex Throughput Position", "Vertex Throughput Full"};
+
+    for (uint i = 0u; i < 2u; ++i) {
+        ShaderSource &source = TestBaseI::getAppropriateShaderSource(*sources[i]);
+
+        gfx::ShaderStageList shaderStageList;
+        gfx::ShaderStage vertexShaderStage;
+        vertexShaderStage.stage = gfx::ShaderStageFlagBit::VERTEX;
+        vertexShaderStage.source = source.vert;
+        shaderStageList.emplace_back(std::move(vertexShaderStage));
+
+        gfx::ShaderStage fragmentShaderStage;
+        fragmentShaderStage.stage = gfx::ShaderStageFlagBit::FRAGMENT;
+        fragmentShaderStage.source = source.frag;
+        shaderStageList.emplace_back(std::move(fragmentShaderStage));
+
+        gfx::ShaderInfo shaderInfo;
+        shaderInfo.name = names[i];
+        shaderInfo.stages = std::move(shaderStageList);
+        shaderInfo.attributes = attributeLists[i];
+        shaderInfo.blocks = uniformBlockList;
+        _shaders[i] = _device->createShader(shaderInfo);
+    }
+}
+
+void VertexThroughputTest::createPipelines() {
+    _uniformStride = TestBaseI::getAlignedUBOStride(_device, 2 * sizeof(Mat4));
+    _uniformBuffer = _device->createBuffer({
+        gfx::BufferUsage::UNIFORM,
+        gfx::MemoryUsage::DEVICE | gfx::MemoryUsage::HOST,
+        TestBaseI::getUBOSize(_uniformStride * DRAWS_PER_FRAME),
+        _uniformStride,
+    });
+    _uniformBufferView = _device->createBuffer({
+        _uniformBuffer,
+        0,
+        2 * sizeof(Mat4),
+    });
+
+    gfx::DescriptorSetLayoutInfo dslInfo;
+    dslInfo.bindings.push_back({0, gfx::DescriptorType::DYNAMIC_UNIFORM_BUFFER, 1, gfx::ShaderStageFlagBit::VERTEX});
+    _descriptorSetLayout = _device->createDescriptorSetLayout(dslInfo);
+
+    _pipelineLayout = _device->createPipelineLayout({{_descriptorSetLayout}});
+
+    _descriptorSet = _device->createDescriptorSet({_descriptorSetLayout});
+    _descriptorSet->bindBuffer(0, _uniformBufferView);
+    _descriptorSet->update();
+
+    // one pipeline per vertex format, the attribute layouts come straight from the generator
+    for (uint format = 0u; format < FORMAT_COUNT; ++format) {
+        GeometryBuffers layout;
+        layout.reset(static_cast<VertexFormat>(format), 0u, 0u);
+
+        gfx::PipelineStateInfo pipelineInfo;
+        pipelineInfo.primitive = gfx::PrimitiveMode::TRIANGLE_LIST;
+        pipelineInfo.shader = _shaders[layout.hasNormals() ? 1 : 0];
+        pipelineInfo.inputState = {layout.attributes};
+        pipelineInfo.renderPass = _fbo->getRenderPass();
+        pipelineInfo.depthStencilState.depthTest = true;
+        pipelineInfo.depthStencilState.depthWrite = true;
+        pipelineInfo.depthStencilState.depthFunc = gfx::ComparisonFunc::LESS;
+        pipelineInfo.pipelineLayout = _pipelineLayout;
+        _pipelineStates[format] = _device->createPipelineState(pipelineInfo);
+    }
+}
+
+void VertexThroughputTest::destroyGeometry() {
+    CC_SAFE_DESTROY(_inputAssembler);
+    CC_SAFE_DESTROY(_indexBuffer);
+    for (gfx::Buffer *&buffer : _vertexBuffers) CC_SAFE_DESTROY(buffer);
+    _vertexBuffers.clear();
+}
+
+void VertexThroughputTest::loadConfig(uint config) {
+    destroyGeometry();
+
+    uint countIndex = config % _triangleCounts.size();
+    uint shape = config / _triangleCounts.size() % SHAPE_COUNT;
+    uint format = config / _triangleCounts.size() / SHAPE_COUNT;
+
+    auto start = std::chrono::steady_clock::now();
+    generateGeometry(_geometry, static_cast<GeometryShape>(shape), _triangleCounts[countIndex], static_cast<VertexFormat>(format));
+    float generateTime = TestBaseI::millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    gfx::InputAssemblerInfo inputAssemblerInfo;
+    inputAssemblerInfo.attributes = _geometry.attributes;
+    for (size_t i = 0u; i < _geometry.streams.size(); ++i) {
+        gfx::Buffer *buffer = _device->createBuffer({
+            gfx::BufferUsage::VERTEX,
+            gfx::MemoryUsage::DEVICE,
+            static_cast<uint>(_geometry.streams[i].size()),
+            _geometry.strides[i],
+        });
+        buffer->update(_geometry.streams[i].data(), 0, static_cast<uint>(_geometry.streams[i].size()));
+        _vertexBuffers.push_back(buffer);
+        inputAssemblerInfo.vertexBuffers.push_back(buffer);
+    }
+
+    _indexBuffer = _device->createBuffer({
+        gfx::BufferUsage::INDEX,
+        gfx::MemoryUsage::DEVICE,
+        static_cast<uint>(_geometry.indices.size()),
+        _geometry.indexStride,
+    });
+    _indexBuffer->update(_geometry.indices.data(), 0, static_cast<uint>(_geometry.indices.size()));
+    inputAssemblerInfo.indexBuffer = _indexBuffer;
+    _inputAssembler = _device->createInputAssembler(inputAssemblerInfo);
+
+    CC_LOG_INFO("VertexThroughputTest: %s, %s, %u triangles, %u vertices: %.1fms generate, %.1fms upload",
+                getShapeName(static_cast<GeometryShape>(shape)), getVertexFormatName(_geometry.format), _geometry.indexCount / 3u, _geometry.vertexCount, generateTime, TestBaseI::millisecondsSince(start));
+
+    _config = config;
+    _frames = 0u;
+    _measuredFrames = 0u;
+    _measuredTime = 0.0f;
+}
+
+void VertexThroughputTest::logConfig() {
+    if (!_measuredFrames) return;
+
+    uint vertexBytes = 0u;
+    for (uint stride : _geometry.strides) vertexBytes += stride;
+    float seconds = _measuredTime / _measuredFrames;
+    float triangles = float(_geometry.indexCount / 3u) * DRAWS_PER_FRAME;
+    float vertices = float(_geometry.vertexCount) * DRAWS_PER_FRAME;
+    CC_LOG_INFO("VertexThroughputTest: %s, %s, %u triangles x %u draws: %.3fms per frame, %.1fM triangles/s, %.1fM vertices/s, %.1fMB vertex data per frame",
+                getShapeName(static_cast<GeometryShape>(_config / _triangleCounts.size() % SHAPE_COUNT)), getVertexFormatName(_geometry.format),
+                _geometry.indexCount / 3u, DRAWS_PER_FRAME, seconds * 1000.f, triangles / seconds * 1e-6f, vertices / seconds * 1e-6f,
+                vertices * vertexBytes / (1024.f * 1024.f));
+}
+
+void VertexThroughputTest::tick() {
+    lookupTime();
+    _time += hostThread.dt;
+
+    if (++_frames > WARMUP_FRAMES) {
+        _measuredTime += hostThread.dt;
+        ++_measuredFrames;
+    }
+    if (_frames == FRAMES_PER_CONFIG) {
+        logConfig();
+        loadConfig((_config + 1u) % (_triangleCounts.size() * SHAPE_COUNT * FORMAT_COUNT));
+    }
+
+    Mat4 view, projection, viewProjection;
+    Mat4::createLookAt(Vec3(0.0f, 0.0f, 10.0f), Vec3::ZERO, Vec3(0.0f, 1.0f, 0.0f), &view);
+    gfx::Extent orientedSize = TestBaseI::getOrientedSurfaceSize();
+    TestBaseI::createPerspective(60.0f, 1.0f * orientedSize.width / orientedSize.height, 1.0f, 100.0f, &projection);
+    Mat4::multiply(projection, view, &viewProjection);
+
+    // a 2x2 block of tumbling copies in the middle of the screen, DRAWS_PER_FRAME beyond 4 overlap
+    vector<float> uniforms(_uniformStride / sizeof(float) * DRAWS_PER_FRAME);
+    for (uint i = 0u; i < DRAWS_PER_FRAME; ++i) {
+        Mat4 model, mvp;
+        Mat4::createTranslation(i % 2u ? 1.5f : -1.5f, i / 2u % 2u ? 1.5f : -1.5f, 0.0f, &model);
+        model.rotateY(_time * 0.7f + i);
+        model.rotateX(0.5f);
+        Mat4::multiply(viewProjection, model, &mvp);
+        float *dst = &uniforms[i * _uniformStride / sizeof(float)];
+        std::copy(mvp.m, mvp.m + 16, dst);
+        std::copy(model.m, model.m + 16, dst + 16);
+    }
+
+    gfx::Color clearColor = {0.1f, 0.1f, 0.1f, 1.0f};
+
+    _device->acquire();
+
+    _uniformBuffer->update(uniforms.data(), 0, static_cast<uint>(uniforms.size() * sizeof(float)));
+    gfx::Rect renderArea = {0, 0, _device->getWidth(), _device->getHeight()};
+
+    auto commandBuffer = _commandBuffers[0];
+    commandBuffer->begin();
+    commandBuffer->beginRenderPass(_fbo->getRenderPass(), _fbo, renderArea, &clearColor, 1.0f, 0);
+    getRenderPassAnalyzer()->record("VertexThroughputTest", _fbo, renderArea);
+    commandBuffer->bindInputAssembler(_inputAssembler);
+    commandBuffer->bindPipelineState(_pipelineStates[static_cast<uint>(_geometry.format)]);
+    for (uint i = 0u, dynamicOffset = 0u; i < DRAWS_PER_FRAME; ++i, dynamicOffset += _uniformStride) {
+        commandBuffer->bindDescriptorSet(0, _descriptorSet, 1, &dynamicOffset);
+        commandBuffer->draw(_inputAssembler);
+    }
+    commandBuffer->endRenderPass();
+    commandBuffer->end();
+
+    _device->getQueue()->submit(_commandBuffers);
+    _device->present();
+}
+
+} // namespace cc
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "TestBase.h"
+#include "Geometry.h"
+
+namespace cc {
+
+class VertexThroughputTest: public TestBaseI
+{
+public:
+    DEFINE_CREATE_METHOD(VertexThroughputTest)
+    VertexThroughputTest(const WindowInfo& info) : TestBaseI(info) {};
+    ~VertexThroughputTest() = default;
+
+public:
+     virtual void tick() override;
+     virtual bool initialize() override;
+     virtual void destroy() override;
+
+private:
+    void createShaders();
+    void createPipelines();
+    void destroyGeometry();
+    void loadConfig(uint config);
+    void logConfig();
+
+    gfx::Shader* _shaders[2] = {nullptr, nullptr}; // position only, full vertex
+    gfx::Buffer* _uniformBuffer = nullptr;
+    gfx::Buffer* _uniformBufferView = nullptr;
+    gfx::DescriptorSet* _descriptorSet = nullptr;
+    gfx::DescriptorSetLayout* _descriptorSetLayout = nullptr;
+    gfx::PipelineLayout* _pipelineLayout = nullptr;
+    gfx::PipelineState* _pipelineStates[static_cast<uint>(VertexFormat::COUNT)] = {};
+
+    vector<gfx::Buffer*> _vertexBuffers;
+    gfx::Buffer* _indexBuffer = nullptr;
+    gfx::InputAssembler* _inputAssembler = nullptr;
+
+    GeometryBuffers _geometry;
+    vector<uint> _triangleCounts;
+    uint _config = 0u;
+    uint _uniformStride = 0u;
+    uint _frames = 0u;
+    uint _measuredFrames = 0u;
+    float _measuredTime = 0.0f;
+    float _time = 0.0f;
+};
+
+} // namespace cc